@@ -0,0 +1,194 @@
+/**
+*  @file      allocs.cpp
+*  @brief     The allocation-count regression test for each category of cgoggles
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "argh.h"
+#include "utils.h"
+#include "requests.h"
+#include "context.h"
+#include "snapshot.h"
+#include "sysroot.h"
+#include "timings.h"
+
+/**
+* @brief Reads the allocation budget of each category, one "CATEGORY FIXED PER-ROW" per line, skipping comments
+*
+* @param  p     The path to the budget file
+* @param  o     The fixed and per-row budgets, by category
+* @return true  The file was read successfully
+* @return false The file was NOT read successfully
+*/
+bool readBudgets(const std::string &p, std::map<std::string, std::pair<std::uint64_t, std::uint64_t>> *o)
+{
+  std::ifstream file(p);
+  std::string line;
+  std::string cat;
+  std::uint64_t fixed;
+  std::uint64_t perRow;
+
+  if (!file.good())
+  {
+    return false;
+  }
+  while (std::getline(file, line))
+  {
+    std::istringstream ss(line);
+    if (line.empty() || line[0] == '#' || !(ss >> cat >> fixed))
+    {
+      continue;
+    }
+    // A category which does not grow with the computer has no per-row budget
+    perRow = ss >> perRow ? perRow : 0;
+    (*o)[cat] = std::make_pair(fixed, perRow);
+  }
+  return true;
+}
+
+/**
+* @brief Counts the rows a category was collected for, like its CPUs, drives or IRQs, which its allocations may grow with
+*
+* @param  snap The snapshot the category was collected into
+* @param  cat  The category
+* @return std::uint64_t The number of rows, or 0 if the category does not grow with the computer
+*/
+std::uint64_t categoryRows(Snapshot *snap, const std::string &cat)
+{
+  std::uint64_t rows = 0;
+
+  if (cat == "CPU")
+  {
+    rows = snap->cpu.topology.threads;
+  }
+  else if (cat == "CPU.USAGE")
+  {
+    rows = snap->cpuUsage.cpus.size();
+  }
+  else if (cat == "CPU.POWER")
+  {
+    // Each idle state of each CPU is read apart from the CPU's other files
+    for (std::size_t i = 0; i < snap->cpuPower.cores.size(); ++i)
+    {
+      rows += 1 + snap->cpuPower.cores[i].idleNames.size();
+    }
+  }
+  else if (cat == "GPU")
+  {
+    rows = snap->gpu.controllers.size();
+  }
+  else if (cat == "RAM")
+  {
+    rows = snap->ram.chips.size();
+  }
+  else if (cat == "SENSORS")
+  {
+    rows = snap->sensors.sensors.size();
+  }
+  else if (cat == "STORAGE")
+  {
+    rows = snap->storage.drives.size();
+  }
+  else if (cat == "STORAGE.IO")
+  {
+    rows = snap->disks.Rows();
+  }
+  else if (cat == "NET")
+  {
+    rows = snap->net.interfaces.size();
+  }
+  else if (cat == "FS")
+  {
+    rows = snap->fs.fsList.size();
+  }
+  else if (cat == "PROC")
+  {
+    rows = snap->proc.count;
+  }
+  else if (cat == "NUMA")
+  {
+    rows = snap->numa.nodes.size();
+  }
+  else if (cat == "KERNEL")
+  {
+    rows = snap->kernel.vulnerabilities.size();
+  }
+  else if (cat == "CGROUPS")
+  {
+    rows = snap->cgroups.nodes.size();
+  }
+  else if (cat == "SCHED")
+  {
+    rows = snap->sched.cpus.size() + snap->sched.pids.size();
+  }
+  else if (cat == "IRQ")
+  {
+    rows = snap->irq.irqs.labels.size() + snap->irq.soft.labels.size();
+  }
+  return rows;
+}
+
+/**
+* @brief Collects each category once, and samples those measured over time, failing if any allocates more than its budget for its rows
+*
+* @param argc The count of arguments
+* @param argv The value of arguments
+* @return int The exit code
+*/
+int main(int argc, const char *argv[])
+{
+  argh::parser cmdl(argc, argv, argh::parser::PREFER_PARAM_FOR_UNREG_OPTION);
+  std::string budgetPath;
+  std::string rootPath;
+  std::map<std::string, std::pair<std::uint64_t, std::uint64_t>> budgets;
+  std::vector<std::string> cats;
+  std::string request = "ALL";
+  std::uint64_t before;
+  std::uint64_t used;
+  std::uint64_t rows;
+  std::uint64_t allowed;
+  bool failed = false;
+  Context ctx;
+  cmdl("budget", "allocs.budget") >> budgetPath;
+  cmdl("root", "") >> rootPath;
+  Sysroot root = rootPath.empty() ? Sysroot() : Sysroot(rootPath);
+  // A fake root, like one with thousands of CPUs, checks that the per-row budgets hold on a larger computer
+  SysrootScope rootScope(rootPath.empty() ? nullptr : &root);
+
+  if (!readBudgets(budgetPath, &budgets))
+  {
+    std::cerr << "allocs: cannot read the budgets from " << budgetPath << std::endl;
+    return EXIT_FAILURE;
+  }
+  parseRequests(&ctx, &request);
+  gatherCategories(&ctx, &cats);
+
+  // Only the allocations of the calling thread are counted, so the workers of a parallel walk are left out
+  std::cout << std::left << std::setw(12) << "category" << std::right << std::setw(8) << "rows" << std::setw(10) << "allocs" << std::setw(10) << "budget" << '\n';
+  for (std::size_t i = 0; i < cats.size(); ++i)
+  {
+    Snapshot snap;
+    before = heapAllocations;
+    collectCategory(&ctx, &snap, cats[i]);
+    if (sampledCategory(cats[i]))
+    {
+      sampleCategory(&ctx, &snap, cats[i]);
+    }
+    used = heapAllocations - before;
+    rows = categoryRows(&snap, cats[i]);
+
+    auto budget = budgets.find(cats[i]);
+    allowed = budget == budgets.end() ? 0 : budget->second.first + budget->second.second * rows;
+    bool over = budget == budgets.end() || used > allowed;
+    failed = failed || over;
+    std::cout << std::left << std::setw(12) << cats[i] << std::right << std::setw(8) << rows << std::setw(10) << used << std::setw(10)
+              << (budget == budgets.end() ? std::string("none") : std::to_string(allowed)) << (over ? "  FAIL" : "") << '\n';
+  }
+  std::cout << (failed ? "FAIL" : "PASS") << std::endl;
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,142 @@
+/**
+*  @file      arena.cpp
+*  @brief     The implementation for the Arena class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "arena.h"
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new Arena object with 4 KiB blocks
+*/
+Arena::Arena()
+{
+  blockSize = 4096;
+  used = 0;
+  capacity = 0;
+}
+
+/**
+* @brief Construct a new Arena object with the given block size
+*
+* @param size The size of each block
+*/
+Arena::Arena(std::size_t size)
+{
+  blockSize = size;
+  used = 0;
+  capacity = 0;
+}
+
+/**
+* @brief Construct a new Arena object from another Arena object
+*
+* @param o The Arena object to move from
+*/
+Arena::Arena(Arena &&o)
+{
+  blocks = std::move(o.blocks);
+  blockSize = o.blockSize;
+  used = o.used;
+  capacity = o.capacity;
+  o.used = 0;
+  o.capacity = 0;
+}
+#pragma endregion "Constructors"
+
+#pragma region "Operators"
+/**
+* @brief Moves another Arena object into this one
+*
+* @param o The Arena object to move from
+*/
+void Arena::operator=(Arena &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  blocks = std::move(o.blocks);
+  blockSize = o.blockSize;
+  used = o.used;
+  capacity = o.capacity;
+  o.used = 0;
+  o.capacity = 0;
+}
+#pragma endregion "Operators"
+
+#pragma region "Methods"
+/**
+* @brief Reserves memory that lives as long as the arena
+*
+* @param  size  The amount of memory to allocate
+* @param  align The alignment of the memory
+* @return void* A pointer to the allocated memory
+*/
+void *Arena::Allocate(std::size_t size, std::size_t align)
+{
+  std::size_t start = (used + align - 1) & ~(align - 1);
+
+  if (blocks.empty() || start + size > capacity)
+  {
+    capacity = std::max(blockSize, size + align);
+    blocks.emplace_back(new char[capacity]);
+    start = 0;
+  }
+
+  used = start + size;
+  return blocks.back().get() + start;
+}
+
+/**
+* @brief Copies a string into the arena
+*
+* @param  s           The characters to copy
+* @param  len         The number of characters
+* @return const char* The NUL-terminated copy
+*/
+const char *Arena::Store(const char *s, std::size_t len)
+{
+  char *o = static_cast<char *>(Allocate(len + 1, 1));
+  std::memcpy(o, s, len);
+  o[len] = '\0';
+  return o;
+}
+
+/**
+* @brief Copies a string into the arena
+*
+* @param  s           The string to copy
+* @return const char* The NUL-terminated copy
+*/
+const char *Arena::Store(const std::string &s)
+{
+  return Store(s.data(), s.size());
+}
+
+/**
+* @brief Releases everything in the arena at once
+*/
+void Arena::Reset()
+{
+  blocks.clear();
+  used = 0;
+  capacity = 0;
+}
+
+/**
+* @brief Gets the number of blocks the arena has allocated
+*
+* @return std::size_t The number of blocks
+*/
+std::size_t Arena::Blocks()
+{
+  return blocks.size();
+}
+#pragma endregion "Methods"
@@ -0,0 +1,41 @@
+/**
+*  @file      arena.h
+*  @brief     The interface for the Arena class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_ARENA_H_
+#define CGOGGLES_ARENA_H_
+
+#include "pch.h"
+
+/**
+* @brief Represents a bump allocator whose memory is released all at once
+*/
+class Arena
+{
+private:
+  std::vector<std::unique_ptr<char[]>> blocks;
+  std::size_t blockSize;
+  std::size_t used;
+  std::size_t capacity;
+
+public:
+  Arena();
+  Arena(std::size_t size);
+  Arena(const Arena &o) = delete;
+  Arena(Arena &&o);
+  void operator=(const Arena &o) = delete;
+  void operator=(Arena &&o);
+  void *Allocate(std::size_t size, std::size_t align = alignof(std::max_align_t));
+  const char *Store(const char *s, std::size_t len);
+  const char *Store(const std::string &s);
+  void Reset();
+  std::size_t Blocks();
+};
+
+#endif // CGOGGLES_ARENA_H_
@@ -0,0 +1,370 @@
+/**
+*  @file      bench.cpp
+*  @brief     The benchmarks for the parsers, formatting and output of cgoggles
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "argh.h"
+#include "utils.h"
+#include "processor.h"
+#include "ramlist.h"
+#include "storagelist.h"
+#include "fslist.h"
+#include "requests.h"
+#include "context.h"
+#include "snapshot.h"
+#include "timerwheel.h"
+
+/**
+* @brief Represents the timed samples of a single benchmark
+*/
+class Benchmark
+{
+public:
+  Benchmark(const std::string &nm, const std::size_t &itm);
+  std::string name;
+  std::size_t items;
+  std::vector<std::uint64_t> samples;
+};
+
+/**
+* @brief A stream buffer which throws away everything written to it
+*/
+class NullBuffer : public std::streambuf
+{
+protected:
+  int overflow(int c) override { return c; }
+  std::streamsize xsputn(const char *, std::streamsize n) override { return n; }
+};
+
+/**
+* @brief Construct a new, empty Benchmark object
+*
+* @param nm  The name of the benchmark
+* @param itm The number of items processed by each run
+*/
+Benchmark::Benchmark(const std::string &nm, const std::size_t &itm)
+{
+  name = nm;
+  items = itm;
+  samples = std::vector<std::uint64_t>();
+}
+
+/**
+* @brief Times a function until it has run for long enough to be measured
+*
+* @param results The list of benchmarks to add to
+* @param name    The name of the benchmark
+* @param items   The number of items processed by each run
+* @param budget  The minimum time to spend running, in milliseconds
+* @param fn      The function to time
+*/
+void runBenchmark(std::vector<Benchmark> *results, const std::string &name, const std::size_t &items, const std::uint64_t &budget, const std::function<void()> &fn)
+{
+  Benchmark bench(name, items);
+  std::uint64_t spent = 0;
+  std::chrono::steady_clock::time_point start;
+
+  fn(); // Warm the caches and the allocator
+  while (bench.samples.size() < 5 || (spent < budget * 1000000 && bench.samples.size() < 100000))
+  {
+    start = std::chrono::steady_clock::now();
+    fn();
+    bench.samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+    spent += bench.samples.back();
+  }
+
+  std::sort(bench.samples.begin(), bench.samples.end());
+  std::cerr << name << ": " << bench.samples.size() << " runs" << std::endl;
+  results->push_back(bench);
+}
+
+/**
+* @brief Gets a percentile from a sorted list of samples, using the nearest rank
+*
+* @param  samples       The sorted samples
+* @param  pct           The percentile to get, from 0 to 100
+* @return std::uint64_t The sample at that percentile
+*/
+std::uint64_t percentile(std::vector<std::uint64_t> *samples, const double &pct)
+{
+  std::size_t rank = std::size_t(std::ceil(pct / 100 * samples->size()));
+  return (*samples)[rank ? rank - 1 : 0];
+}
+
+/**
+* @brief Outputs the benchmarks as JSON
+*
+* @param results The benchmarks to output
+* @param stream  The output stream
+*/
+void outputBenchmarks(std::vector<Benchmark> *results, std::ostream &stream)
+{
+  stream << "{\"benchmarks\":[";
+  for (std::size_t i = 0; i < results->size(); ++i)
+  {
+    Benchmark &bench = (*results)[i];
+    std::uint64_t sum = 0;
+    for (std::size_t j = 0; j < bench.samples.size(); ++j)
+    {
+      sum += bench.samples[j];
+    }
+
+    stream << (i ? ",\n" : "\n")
+           << "{\"name\":\"" << bench.name << '"'
+           << ",\"items\":" << bench.items
+           << ",\"runs\":" << bench.samples.size()
+           << ",\"min_ns\":" << bench.samples.front()
+           << ",\"p50_ns\":" << percentile(&bench.samples, 50)
+           << ",\"p90_ns\":" << percentile(&bench.samples, 90)
+           << ",\"p99_ns\":" << percentile(&bench.samples, 99)
+           << ",\"max_ns\":" << bench.samples.back()
+           << ",\"mean_ns\":" << sum / bench.samples.size() << '}';
+  }
+  stream << "\n]}" << std::endl;
+}
+
+/**
+* @brief Reads a captured fixture, exiting if it is missing
+*
+* @param  dir         The directory holding the fixtures
+* @param  name        The name of the fixture
+* @return std::string The contents of the fixture
+*/
+std::string readFixture(const std::string &dir, const std::string &name)
+{
+  std::string text;
+  if (!readFile(dir + "/" + name, &text))
+  {
+    std::cerr << "bench: cannot read fixture " << dir << "/" << name << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  return text;
+}
+
+/**
+* @brief Builds the output of lscpu for a large machine
+*
+* @param  base        The captured output to scale up
+* @param  cpus        The number of logical CPUs
+* @return std::string The synthetic lscpu output
+*/
+std::string scaleLscpu(const std::string &base, const std::size_t &cpus)
+{
+  std::stringstream buffer;
+  std::vector<std::string> lines;
+  std::size_t nodes = cpus / 64;
+  splitStringVector(base, "\n", &lines);
+
+  for (std::size_t i = 0; i < lines.size(); ++i)
+  {
+    if (startswith(lines[i], "CPU(s):"))
+    {
+      buffer << "CPU(s):                          " << cpus << '\n';
+    }
+    else if (startswith(lines[i], "On-line CPU(s) list:"))
+    {
+      buffer << "On-line CPU(s) list:             0-" << cpus - 1 << '\n';
+    }
+    else if (startswith(lines[i], "Core(s) per socket:"))
+    {
+      buffer << "Core(s) per socket:              32" << '\n';
+    }
+    else if (startswith(lines[i], "Socket(s):"))
+    {
+      buffer << "Socket(s):                       " << cpus / 64 << '\n';
+    }
+    else if (startswith(lines[i], "NUMA node(s):"))
+    {
+      buffer << "NUMA node(s):                    " << nodes << '\n';
+    }
+    else if (startswith(lines[i], "NUMA node0 CPU(s):"))
+    {
+      for (std::size_t n = 0; n < nodes; ++n)
+      {
+        buffer << "NUMA node" << n << " CPU(s):" << std::string(n < 10 ? 15 : n < 100 ? 14 : 13, ' ')
+               << n * 64 << '-' << n * 64 + 63 << '\n';
+      }
+    }
+    else if (!lines[i].empty())
+    {
+      buffer << lines[i] << '\n';
+    }
+  }
+  return buffer.str();
+}
+
+/**
+* @brief Builds the output of lsblk for a machine with many disks
+*
+* @param  disks       The number of block devices
+* @return std::string The synthetic lsblk output
+*/
+std::string scaleLsblk(const std::size_t &disks)
+{
+  std::stringstream buffer;
+  for (std::size_t i = 0; i < disks; ++i)
+  {
+    bool part = i % 2;
+    std::string name = "sd" + std::to_string(i / 2) + (part ? "1" : "");
+    buffer << "NAME=\"" << name << "\" TYPE=\"" << (part ? "part" : "disk") << "\" SIZE=\"" << 4000787030016 - part * 1925120
+           << "\" FSTYPE=\"" << (part ? "xfs" : "") << "\" MOUNTPOINT=\"" << (part ? "/srv/disk" + std::to_string(i / 2) : "")
+           << "\" UUID=\"" << (part ? "0c9d8e7f-6a5b-4c3d-2e1f-" + std::to_string(100000000000 + i) : "")
+           << "\" ROTA=\"1\" RO=\"0\" RM=\"0\" TRAN=\"sas\" SERIAL=\"" << (part ? "" : "ZC1" + std::to_string(10000 + i))
+           << "\" LABEL=\"\" MODEL=\"" << (part ? "" : "ST4000NM0025") << "\" OWNER=\"root\"" << '\n';
+  }
+  return buffer.str();
+}
+
+/**
+* @brief Builds the output of df for a machine with many mounts
+*
+* @param  mounts      The number of file systems
+* @return std::string The synthetic df output
+*/
+std::string scaleDf(const std::size_t &mounts)
+{
+  std::stringstream buffer;
+  for (std::size_t i = 0; i < mounts; ++i)
+  {
+    buffer << "/dev/mapper/vg-lv" << i << " xfs   10475520 " << 33992 + i << " " << 10441528 - i << "       1% /srv/vol/" << i << '\n';
+  }
+  return buffer.str();
+}
+
+/**
+* @brief Builds the filtered output of dmidecode for a machine with many RAM slots
+*
+* @param  base        The captured output to repeat
+* @param  times       The number of times to repeat it
+* @return std::string The synthetic dmidecode output
+*/
+std::string scaleDmidecode(const std::string &base, const std::size_t &times)
+{
+  std::string ret;
+  ret.reserve(base.size() * times);
+  for (std::size_t i = 0; i < times; ++i)
+  {
+    ret += base;
+  }
+  return ret;
+}
+
+/**
+* @brief The main point of entry for the benchmarks
+*
+* @param argc The count of arguments
+* @param argv The value of arguments
+* @return int The exit code
+*/
+int main(int argc, const char *argv[])
+{
+  argh::parser cmdl(argc, argv, argh::parser::PREFER_PARAM_FOR_UNREG_OPTION);
+  std::string dir;
+  std::uint64_t budget;
+  std::string filter;
+  std::vector<Benchmark> results;
+  cmdl("fixtures", "fixtures/linux") >> dir;
+  cmdl("time", 200) >> budget;
+  cmdl("filter", "") >> filter;
+
+  std::map<std::string, std::string> texts;
+  texts["lscpu"] = readFixture(dir, "lscpu.txt");
+  texts["lsblk"] = readFixture(dir, "lsblk.txt");
+  texts["df"] = readFixture(dir, "df.txt");
+  texts["dmidecode"] = readFixture(dir, "dmidecode.txt");
+  texts["lscpu/4096"] = scaleLscpu(texts["lscpu"], 4096);
+  texts["lsblk/10000"] = scaleLsblk(10000);
+  texts["df/50000"] = scaleDf(50000);
+  texts["dmidecode/1024"] = scaleDmidecode(texts["dmidecode"], 256);
+
+  std::map<std::string, std::size_t> items = {
+      {"lscpu", 16}, {"lscpu/4096", 4096}, {"lsblk", 6}, {"lsblk/10000", 10000}, {"df", 3}, {"df/50000", 50000}, {"dmidecode", 4}, {"dmidecode/1024", 1024}};
+  for (auto it = texts.begin(); it != texts.end(); ++it)
+  {
+    const std::string &text = it->second;
+    std::string name = "parse/" + it->first;
+    if (!filter.empty() && name.find(filter) == std::string::npos)
+    {
+      continue;
+    }
+
+    if (startswith(it->first, "lscpu"))
+    {
+      runBenchmark(&results, name, items[it->first], budget, [&text]() { Processor cpu; cpu.ParseLux(text); });
+    }
+    if (startswith(it->first, "lsblk"))
+    {
+      runBenchmark(&results, name, items[it->first], budget, [&text]() { StorageList storage; storage.ParseLux(text); });
+    }
+    if (startswith(it->first, "df"))
+    {
+      runBenchmark(&results, name, items[it->first], budget, [&text]() { FileSystemList fs; fs.ParseLux(text); });
+    }
+    if (startswith(it->first, "dmidecode"))
+    {
+      runBenchmark(&results, name, items[it->first], budget, [&text]() { RAMList ram; ram.ParseLux(text); });
+    }
+  }
+
+  // Format and output a snapshot as large as the scaled fixtures
+  Context ctx;
+  Snapshot snap;
+  NullBuffer nullBuffer;
+  std::ostream nullStream(&nullBuffer);
+  std::string request = "CPU,RAM,STORAGE,FS";
+  parseRequests(&ctx, &request);
+  snap.cpu.ParseLux(texts["lscpu/4096"]);
+  snap.ram.ParseLux(texts["dmidecode/1024"]);
+  snap.storage.ParseLux(texts["lsblk/10000"]);
+  snap.fs.ParseLux(texts["df/50000"]);
+
+  if (filter.empty() || std::string("gather").find(filter) != std::string::npos)
+  {
+    runBenchmark(&results, "gather", snap.storage.drives.size() + snap.fs.fsList.size(), budget, [&ctx, &snap]() { snap.Clear(); gatherRequests(&ctx, &snap); });
+  }
+  else
+  {
+    gatherRequests(&ctx, &snap);
+  }
+
+  std::map<std::string, OutputStyle> styles = {{"default", OutputStyle::Default}, {"list", OutputStyle::List}, {"value", OutputStyle::Value}, {"json", OutputStyle::Json}};
+  for (auto it = styles.begin(); it != styles.end(); ++it)
+  {
+    std::string name = "output/" + it->first;
+    if (!filter.empty() && name.find(filter) == std::string::npos)
+    {
+      continue;
+    }
+    ctx.style = it->second;
+    runBenchmark(&results, name, snap.keys.size(), budget, [&ctx, &snap, &nullStream]() { outputRequests(&ctx, &snap, nullStream); });
+  }
+
+  // One second of a watch with hundreds of timers, waking for each deadline as watchRequests does, so its mean is the scheduler's share of a core in thousandths
+  if (filter.empty() || std::string("wheel/512").find(filter) != std::string::npos)
+  {
+    TimerWheel wheel;
+    std::vector<std::size_t> due;
+    for (std::uint32_t i = 0; i < 512; ++i)
+    {
+      std::uint32_t period = (i % 64 + 1) * 100;
+      wheel.Add(period, period / 20);
+    }
+    runBenchmark(&results, "wheel/512", 512, budget, [&wheel, &due]() {
+      std::uint64_t end = wheel.Now() + 1000;
+      while (wheel.Next() <= end)
+      {
+        due.clear();
+        wheel.Advance(wheel.Next(), &due);
+      }
+    });
+  }
+
+  outputBenchmarks(&results, std::cout);
+  return EXIT_SUCCESS;
+}
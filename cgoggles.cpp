@@ -0,0 +1,194 @@
+/**
+*  @file      cgoggles.cpp
+*  @brief     The implementation for the C interface of the cgoggles library.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "cgoggles.h"
+#include "utils.h"
+#include "context.h"
+#include "snapshot.h"
+#include "requests.h"
+
+/**
+* @brief The C handle wrapping a Context
+*/
+struct cgoggles_context
+{
+  Context ctx;
+};
+
+/**
+* @brief The C handle wrapping a Snapshot
+*/
+struct cgoggles_snapshot
+{
+  Snapshot snap;
+};
+
+/**
+* @brief Gets the version of the library, formatted as 0xMMmmpp
+*
+* @return unsigned int The library version
+*/
+unsigned int cgoggles_version(void)
+{
+  return CGOGGLES_VERSION;
+}
+
+/**
+* @brief Creates a new context with the default settings
+*
+* @return cgoggles_context* The new context, or NULL on failure
+*/
+cgoggles_context *cgoggles_context_new(void)
+{
+  return new (std::nothrow) cgoggles_context();
+}
+
+/**
+* @brief Frees a context
+*
+* @param ctx The context to free
+*/
+void cgoggles_context_free(cgoggles_context *ctx)
+{
+  delete ctx;
+}
+
+/**
+* @brief Sets whether or not the values are left unformatted
+*
+* @param ctx The context to change
+* @param raw Non-zero to output raw values
+*/
+void cgoggles_context_set_raw(cgoggles_context *ctx, int raw)
+{
+  ctx->ctx.pretty = !raw;
+}
+
+/**
+* @brief Sets the directory that every data source is read relative to
+*
+* @param ctx The context to change
+* @param dir The root directory, or NULL for /
+*/
+void cgoggles_context_set_root(cgoggles_context *ctx, const char *dir)
+{
+  ctx->ctx.root = dir == nullptr ? "" : dir;
+}
+
+/**
+* @brief Sets how long rates and utilization are sampled over
+*
+* @param ctx The context to change
+* @param ms  The sampling window in milliseconds
+*/
+void cgoggles_context_set_window(cgoggles_context *ctx, unsigned int ms)
+{
+  ctx->ctx.window = ms == 0 ? 1 : ms;
+}
+
+/**
+* @brief Sets how many processes are kept in each proc ranking
+*
+* @param ctx The context to change
+* @param n   The number of processes
+*/
+void cgoggles_context_set_top(cgoggles_context *ctx, unsigned int n)
+{
+  ctx->ctx.top = n;
+}
+
+/**
+* @brief Collects a snapshot for a comma-separated request, e.g. "cpu.Brand,os"
+*
+* @param  ctx                The context to query with
+* @param  request            The request to collect
+* @return cgoggles_snapshot* The new snapshot, or NULL on failure
+*/
+cgoggles_snapshot *cgoggles_query(cgoggles_context *ctx, const char *request)
+{
+  cgoggles_snapshot *ret = nullptr;
+  std::string req;
+
+  if (ctx == nullptr || request == nullptr)
+  {
+    return nullptr;
+  }
+
+  for (const char *c = request; *c; ++c)
+  {
+    if (!std::isspace(static_cast<unsigned char>(*c)))
+    {
+      req += std::toupper(static_cast<unsigned char>(*c));
+    }
+  }
+
+  try
+  {
+    ret = new cgoggles_snapshot();
+    ctx->ctx.requests.clear();
+    parseRequests(&ctx->ctx, &req);
+    queryRequests(&ctx->ctx, &ret->snap);
+  }
+  catch (...)
+  {
+    delete ret;
+    return nullptr;
+  }
+
+  return ret;
+}
+
+/**
+* @brief Gets the number of key/value pairs in a snapshot
+*
+* @param  snap   The snapshot to count
+* @return size_t The number of pairs
+*/
+size_t cgoggles_snapshot_size(const cgoggles_snapshot *snap)
+{
+  return snap == nullptr ? 0 : snap->snap.keys.size();
+}
+
+/**
+* @brief Gets a key/value pair from a snapshot, valid until the snapshot is freed
+*
+* @param  snap The snapshot to read
+* @param  i    The index of the pair
+* @param  key  The key, if found
+* @param  val  The value, if found
+* @return int  Non-zero if the pair was found
+*/
+int cgoggles_snapshot_get(const cgoggles_snapshot *snap, size_t i, const char **key, const char **val)
+{
+  if (snap == nullptr || i >= snap->snap.keys.size())
+  {
+    return 0;
+  }
+  if (key != nullptr)
+  {
+    (*key) = snap->snap.keys[i];
+  }
+  if (val != nullptr)
+  {
+    (*val) = snap->snap.vals[i];
+  }
+  return 1;
+}
+
+/**
+* @brief Frees a snapshot and all of its pairs
+*
+* @param snap The snapshot to free
+*/
+void cgoggles_snapshot_free(cgoggles_snapshot *snap)
+{
+  delete snap;
+}
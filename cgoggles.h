@@ -0,0 +1,47 @@
+/**
+*  @file      cgoggles.h
+*  @brief     The C interface for the cgoggles library.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_CGOGGLES_H_
+#define CGOGGLES_CGOGGLES_H_
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+* @brief The settings for one or more queries, owned by the caller
+*/
+typedef struct cgoggles_context cgoggles_context;
+
+/**
+* @brief The result of a single query, owned by the caller
+*/
+typedef struct cgoggles_snapshot cgoggles_snapshot;
+
+unsigned int cgoggles_version(void);
+cgoggles_context *cgoggles_context_new(void);
+void cgoggles_context_free(cgoggles_context *ctx);
+void cgoggles_context_set_raw(cgoggles_context *ctx, int raw);
+void cgoggles_context_set_root(cgoggles_context *ctx, const char *dir);
+void cgoggles_context_set_window(cgoggles_context *ctx, unsigned int ms);
+void cgoggles_context_set_top(cgoggles_context *ctx, unsigned int n);
+cgoggles_snapshot *cgoggles_query(cgoggles_context *ctx, const char *request);
+size_t cgoggles_snapshot_size(const cgoggles_snapshot *snap);
+int cgoggles_snapshot_get(const cgoggles_snapshot *snap, size_t i, const char **key, const char **val);
+void cgoggles_snapshot_free(cgoggles_snapshot *snap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CGOGGLES_CGOGGLES_H_
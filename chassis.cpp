@@ -57,16 +57,16 @@ Chassis::Chassis(std::uint8_t plt)
 /**
 * @brief Construct a new Chassis object from another Chassis object
 *
-* @param o The Chassis object to copy from
+* @param o The Chassis object to move from
 */
-Chassis::Chassis(const Chassis &o)
+Chassis::Chassis(Chassis &&o)
 {
-  manufacturer = o.manufacturer;
-  type = o.type;
-  model = o.model;
-  version = o.version;
-  serial = o.serial;
-  assetTag = o.assetTag;
+  manufacturer = std::move(o.manufacturer);
+  type = std::move(o.type);
+  model = std::move(o.model);
+  version = std::move(o.version);
+  serial = std::move(o.serial);
+  assetTag = std::move(o.assetTag);
 }
 #pragma endregion "Contructors"
 
@@ -84,7 +84,7 @@ void Chassis::GetWin()
   std::string wmic = getWmicPath();
   std::map<std::string, std::string> dataMap = runMultiWmic("path Win32_SystemEnclosure get Manufacturer,Model,ChassisTypes,Version,SerialNumber,PartNumber", &wmic);
   std::smatch mt;
-  std::string *cases = new std::string[36]{
+  std::string cases[36] = {
       "Other",
       "Unknown",
       "Desktop",
@@ -147,49 +147,22 @@ void Chassis::GetLux() {}
 
 #pragma region "Operators"
 /**
-* @brief Reserves memory for a new Chassis object
+* @brief Moves another Chassis object into this one
 *
-* @param  size  The amount of memory to allocate
-* @return void* A pointer to the allocated memory
+* @param o The Chassis object to move from
 */
-void *Chassis::operator new(std::size_t size)
-{
-  void *o = ::new (Chassis);
-  return o;
-}
-
-/**
-* @brief Sets equal two Chassis objects
-*
-* @param o The Chassis object to copy from
-*/
-void Chassis::operator=(const Chassis &o)
+void Chassis::operator=(Chassis &&o)
 {
   if (&o == this)
   {
     return;
   }
 
-  manufacturer = o.manufacturer;
-  model = o.model;
-  type = o.type;
-  version = o.version;
-  serial = o.serial;
-  assetTag = o.assetTag;
-}
-
-/**
-* @brief Sets equal two Chassis objects
-*
-* @param o The Chassis object to copy from
-*/
-void Chassis::operator=(Chassis *o)
-{
-  manufacturer = o->manufacturer;
-  model = o->model;
-  type = o->type;
-  version = o->version;
-  serial = o->serial;
-  assetTag = o->assetTag;
+  manufacturer = std::move(o.manufacturer);
+  model = std::move(o.model);
+  type = std::move(o.type);
+  version = std::move(o.version);
+  serial = std::move(o.serial);
+  assetTag = std::move(o.assetTag);
 }
 #pragma endregion "Operators"
@@ -23,10 +23,10 @@ private:
 public:
   Chassis();
   Chassis(std::uint8_t plt);
-  Chassis(const Chassis &o);
-  void *operator new(std::size_t size);
-  void operator=(const Chassis &o);
-  void operator=(Chassis *o);
+  Chassis(const Chassis &o) = delete;
+  Chassis(Chassis &&o);
+  void operator=(const Chassis &o) = delete;
+  void operator=(Chassis &&o);
   std::string manufacturer;
   std::string model;
   std::string type;
@@ -0,0 +1,93 @@
+/**
+*  @file      context.cpp
+*  @brief     The implementation for the Context class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "context.h"
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new Context object with the default settings
+*/
+Context::Context()
+{
+  requests = std::vector<std::string>();
+  style = OutputStyle::Default;
+  pretty = true;
+  timings = TimingStyle::None;
+  root = "";
+  window = 200;
+  top = 10;
+  command = Command::Get;
+  interval = 1000;
+  count = 0;
+  changesOnly = false;
+  periods = std::map<std::string, std::uint32_t>();
+  triggers = std::map<std::string, std::pair<std::uint32_t, std::uint32_t>>();
+  pids = std::vector<std::uint32_t>();
+  history = "";
+  since = 3600000;
+}
+
+/**
+* @brief Construct a new Context object from another Context object
+*
+* @param o The Context object to copy from
+*/
+Context::Context(const Context &o)
+{
+  requests = o.requests;
+  style = o.style;
+  pretty = o.pretty;
+  timings = o.timings;
+  root = o.root;
+  window = o.window;
+  top = o.top;
+  command = o.command;
+  interval = o.interval;
+  count = o.count;
+  changesOnly = o.changesOnly;
+  periods = o.periods;
+  triggers = o.triggers;
+  pids = o.pids;
+  history = o.history;
+  since = o.since;
+}
+#pragma endregion "Constructors"
+
+#pragma region "Operators"
+/**
+* @brief Sets equal two Context objects
+*
+* @param o The Context object to copy from
+*/
+void Context::operator=(const Context &o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  requests = o.requests;
+  style = o.style;
+  pretty = o.pretty;
+  timings = o.timings;
+  root = o.root;
+  window = o.window;
+  top = o.top;
+  command = o.command;
+  interval = o.interval;
+  count = o.count;
+  changesOnly = o.changesOnly;
+  periods = o.periods;
+  triggers = o.triggers;
+  pids = o.pids;
+  history = o.history;
+  since = o.since;
+}
+#pragma endregion "Operators"
@@ -0,0 +1,44 @@
+/**
+*  @file      context.h
+*  @brief     The interface for the Context class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_CONTEXT_H_
+#define CGOGGLES_CONTEXT_H_
+
+#include "pch.h"
+#include "utils.h"
+
+/**
+* @brief Represents the settings for a single collection of requests
+*/
+class Context
+{
+public:
+  Context();
+  Context(const Context &o);
+  void operator=(const Context &o);
+  std::vector<std::string> requests;
+  OutputStyle style;
+  bool pretty;
+  TimingStyle timings;
+  std::string root;
+  std::uint32_t window;
+  std::uint32_t top;
+  Command command;
+  std::uint32_t interval;
+  std::uint64_t count;
+  bool changesOnly;
+  std::map<std::string, std::uint32_t> periods;
+  std::map<std::string, std::pair<std::uint32_t, std::uint32_t>> triggers;
+  std::vector<std::uint32_t> pids;
+  std::string history;
+  std::uint32_t since;
+};
+
+#endif // CGOGGLES_CONTEXT_H_
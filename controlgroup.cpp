@@ -0,0 +1,406 @@
+/**
+*  @file      controlgroup.cpp
+*  @brief     The implementation for the ControlGroup class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "controlgroup.h"
+#include "os.h"
+#include "sourcefile.h"
+#include "sysroot.h"
+#include "utils.h"
+
+/**
+* @brief The legacy controllers whose hierarchies are looked up
+*/
+static const std::array<std::string, 3> legacyControllers = {"cpu", "cpuset", "memory"};
+
+/**
+* @brief The keys read from cpu.stat, where throttled_time is the legacy name, in nanoseconds
+*/
+static const ScanKey cpuKeys[] = {ScanKey("nr_periods", 0), ScanKey("nr_throttled", 1), ScanKey("throttled_usec", 2), ScanKey("throttled_time", 3)};
+
+/**
+* @brief Legacy memory limits at or above this are the kernel's way of writing unlimited
+*/
+const std::uint64_t legacyUnlimited = 1ull << 62;
+
+/**
+* @brief Reads a limit, which is either a number or max
+*
+* @param  path  The path to the file
+* @param  limit The limit, or 0 if it is max
+* @return true  The file was read
+* @return false The file is missing, so the controller is not enabled here
+*/
+static bool readLimit(const std::string &path, std::uint64_t *limit)
+{
+  std::string text;
+  if (!readFile(path, &text))
+  {
+    return false;
+  }
+  text = trim(text);
+  *limit = text.empty() || !std::isdigit(static_cast<unsigned char>(text[0])) ? 0 : std::stoull(text);
+  return true;
+}
+
+/**
+* @brief Keeps the tighter of two limits, where 0 is unlimited
+*
+* @param  a             The first limit
+* @param  b             The second limit
+* @return std::uint64_t The tighter limit
+*/
+static std::uint64_t tighter(const std::uint64_t &a, const std::uint64_t &b)
+{
+  return a == 0 ? b : b == 0 ? a : std::min(a, b);
+}
+
+/**
+* @brief Joins a mount point and a cgroup path, less the part of the hierarchy the mount starts at
+*
+* @param  mount       The mount point
+* @param  root        The cgroup the mount starts at, such as / or a container's own cgroup
+* @param  path        The cgroup path from /proc/self/cgroup
+* @return std::string The directory of the cgroup
+*/
+static std::string cgroupDir(const std::string &mount, const std::string &root, const std::string &path)
+{
+  std::string rel = root != "/" && startswith(path, root) ? path.substr(root.size()) : path;
+  return rtrim(mount + (rel == "/" ? "" : rel), "/");
+}
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new ControlGroup object
+*/
+ControlGroup::ControlGroup()
+{
+  unified = "";
+  unifiedMount = "";
+  legacy = std::map<std::string, std::string>();
+  legacyMounts = std::map<std::string, std::string>();
+  version = 0;
+  path = "";
+  cpuQuota = cpuPeriod = 0;
+  cpuList = "";
+  cpuCount = 0;
+  memoryMax = memoryHigh = memoryCurrent = 0;
+  periods = throttled = throttledTime = 0;
+}
+
+/**
+* @brief Construct a new ControlGroup object with help from the assistants
+*
+* @param plt The platform of the system
+*/
+ControlGroup::ControlGroup(std::uint8_t plt) : ControlGroup()
+{
+  switch (plt)
+  {
+  case OS_WIN:
+    GetWin();
+    break;
+  case OS_MAC:
+    GetMac();
+    break;
+  case OS_LUX:
+    GetLux();
+    break;
+  }
+}
+
+/**
+* @brief Construct a new ControlGroup object from another ControlGroup object
+*
+* @param o The ControlGroup object to move from
+*/
+ControlGroup::ControlGroup(ControlGroup &&o)
+{
+  unified = std::move(o.unified);
+  unifiedMount = std::move(o.unifiedMount);
+  legacy = std::move(o.legacy);
+  legacyMounts = std::move(o.legacyMounts);
+  version = o.version;
+  path = std::move(o.path);
+  cpuQuota = o.cpuQuota;
+  cpuPeriod = o.cpuPeriod;
+  cpuList = std::move(o.cpuList);
+  cpuCount = o.cpuCount;
+  memoryMax = o.memoryMax;
+  memoryHigh = o.memoryHigh;
+  memoryCurrent = o.memoryCurrent;
+  periods = o.periods;
+  throttled = o.throttled;
+  throttledTime = o.throttledTime;
+}
+#pragma endregion "Constructors"
+
+#pragma region "Constructors' Assistants"
+/**
+* @brief Fills in the control group for Darwin systems, which has none
+*/
+void ControlGroup::GetMac() {}
+
+/**
+* @brief Fills in the control group for Windows systems, which has none
+*/
+void ControlGroup::GetWin() {}
+
+/**
+* @brief Fills in the control group for Linux systems, resolving the caller's cgroup in each mounted hierarchy
+*/
+void ControlGroup::GetLux()
+{
+  std::vector<std::string> lines;
+  std::vector<std::string> fields;
+  std::vector<std::string> options;
+  std::map<std::string, std::string> legacyPaths;
+  std::string unifiedPath;
+  std::string text;
+  std::size_t sep;
+
+  // Each line is "id:controllers:path", where the unified hierarchy has id 0 and no controllers
+  if (!readFile("/proc/self/cgroup", &text))
+  {
+    return;
+  }
+  splitStringVector(trim(text), "\n", &lines);
+  for (std::size_t i = 0; i < lines.size(); ++i)
+  {
+    splitStringVector(lines[i], ":", &fields);
+    if (fields.size() < 3)
+    {
+      continue;
+    }
+    if (fields[0] == "0" && fields[1].empty())
+    {
+      unifiedPath = fields[2];
+      continue;
+    }
+    splitStringVector(fields[1], ",", &options);
+    for (std::size_t j = 0; j < options.size(); ++j)
+    {
+      legacyPaths[options[j]] = fields[2];
+    }
+  }
+
+  // Each line is "id parent dev root mount options... - type source super", and root trims the cgroup's path
+  if (readFile("/proc/self/mountinfo", &text))
+  {
+    splitStringVector(trim(text), "\n", &lines);
+    for (std::size_t i = 0; i < lines.size(); ++i)
+    {
+      splitStringVector(lines[i], " ", &fields);
+      sep = std::find(fields.begin(), fields.end(), "-") - fields.begin();
+      if (fields.size() < 5 || sep + 3 >= fields.size())
+      {
+        continue;
+      }
+      if (fields[sep + 1] == "cgroup2" && !unifiedPath.empty())
+      {
+        unified = cgroupDir(fields[4], fields[3], unifiedPath);
+        unifiedMount = rtrim(fields[4], "/");
+      }
+      if (fields[sep + 1] != "cgroup")
+      {
+        continue;
+      }
+      splitStringVector(fields[sep + 3], ",", &options);
+      for (const std::string &ctrl : legacyControllers)
+      {
+        if (legacyPaths.count(ctrl) && std::find(options.begin(), options.end(), ctrl) != options.end())
+        {
+          legacy[ctrl] = cgroupDir(fields[4], fields[3], legacyPaths[ctrl]);
+          legacyMounts[ctrl] = rtrim(fields[4], "/");
+        }
+      }
+    }
+  }
+
+  // A controller is bound to one hierarchy, so a hybrid system only leaves the unbound ones to the unified one
+  version = !legacy.empty() ? 1 : !unified.empty() ? 2 : 0;
+  path = legacyPaths.count("memory") ? legacyPaths["memory"] : legacyPaths.count("cpu") ? legacyPaths["cpu"] : unifiedPath;
+  ReadCpu();
+  ReadCpuset();
+  ReadMemory();
+}
+
+/**
+* @brief Reads the tightest CPU quota between the cgroup and the root, and the cgroup's throttling
+*/
+void ControlGroup::ReadCpu()
+{
+  bool v1 = legacy.count("cpu") > 0;
+  std::string dir = v1 ? legacy["cpu"] : unified;
+  std::string mount = v1 ? legacyMounts["cpu"] : unifiedMount;
+  std::string text;
+  std::uint64_t quota, period, fields[4] = {0, 0, 0, 0};
+  std::size_t slot;
+  bool found;
+
+  if (dir.empty())
+  {
+    return;
+  }
+
+  // Every ancestor's quota up to the mount point applies too, so the tightest share of a CPU wins
+  for (std::string cur = dir; !cur.empty() && cur.size() >= mount.size(); cur = cur.substr(0, cur.find_last_of('/')))
+  {
+    // A legacy quota of -1 reads as unlimited, the same as max, and the root or a cgroup without the controller has none
+    found = v1 ? readLimit(cur + "/cpu.cfs_quota_us", &quota) && readLimit(cur + "/cpu.cfs_period_us", &period) : readFile(cur + "/cpu.max", &text);
+    if (!found)
+    {
+      continue;
+    }
+    if (!v1)
+    {
+      Scanner scan(text.data(), text.size());
+      quota = scan.Match("max") ? 0 : scan.Number();
+      period = scan.Number();
+    }
+    if (cur == dir)
+    {
+      cpuPeriod = period;
+    }
+    if (quota > 0 && period > 0 && (cpuQuota == 0 || static_cast<double>(quota) / period < static_cast<double>(cpuQuota) / cpuPeriod))
+    {
+      cpuQuota = quota;
+      cpuPeriod = period;
+    }
+  }
+
+  if (readFile(dir + "/cpu.stat", &text))
+  {
+    Scanner scan(text.data(), text.size());
+    while (!scan.Done())
+    {
+      slot = scan.Lookup(cpuKeys, 4);
+      if (slot < 4)
+      {
+        fields[slot] = scan.Number();
+      }
+      scan.SkipLine();
+    }
+    periods = fields[0];
+    throttled = fields[1];
+    throttledTime = v1 ? fields[3] / 1000 : fields[2];
+  }
+}
+
+/**
+* @brief Reads the CPUs the cgroup may run on, or every online CPU if it is not confined
+*/
+void ControlGroup::ReadCpuset()
+{
+  std::vector<std::uint32_t> cpus;
+  std::string text;
+
+  if (!(legacy.count("cpuset") ? readFile(legacy["cpuset"] + "/cpuset.effective_cpus", &text) : readFile(unified + "/cpuset.cpus.effective", &text)) &&
+      !readFile("/sys/devices/system/cpu/online", &text))
+  {
+    return;
+  }
+  if (parseCpuList(text, &cpus))
+  {
+    cpuList = formatCpuList(cpus);
+    cpuCount = cpus.size();
+  }
+}
+
+/**
+* @brief Reads the tightest memory limits between the cgroup and the root, and the cgroup's usage
+*/
+void ControlGroup::ReadMemory()
+{
+  bool v1 = legacy.count("memory") > 0;
+  std::string dir = v1 ? legacy["memory"] : unified;
+  std::string mount = v1 ? legacyMounts["memory"] : unifiedMount;
+  std::uint64_t limit;
+
+  if (dir.empty())
+  {
+    return;
+  }
+
+  // A level without the limit, like the root, is skipped rather than ending the walk
+  for (std::string cur = dir; !cur.empty() && cur.size() >= mount.size(); cur = cur.substr(0, cur.find_last_of('/')))
+  {
+    if (!v1 && readLimit(cur + "/memory.max", &limit))
+    {
+      memoryMax = tighter(memoryMax, limit);
+      memoryHigh = readLimit(cur + "/memory.high", &limit) ? tighter(memoryHigh, limit) : memoryHigh;
+    }
+    else if (v1 && readLimit(cur + "/memory.limit_in_bytes", &limit))
+    {
+      memoryMax = tighter(memoryMax, limit >= legacyUnlimited ? 0 : limit);
+    }
+  }
+  readLimit(dir + (v1 ? "/memory.usage_in_bytes" : "/memory.current"), &memoryCurrent);
+}
+#pragma endregion "Constructors' Assistants"
+
+#pragma region "Operators"
+/**
+* @brief Moves another ControlGroup object into this one
+*
+* @param o The ControlGroup object to move from
+*/
+void ControlGroup::operator=(ControlGroup &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  unified = std::move(o.unified);
+  unifiedMount = std::move(o.unifiedMount);
+  legacy = std::move(o.legacy);
+  legacyMounts = std::move(o.legacyMounts);
+  version = o.version;
+  path = std::move(o.path);
+  cpuQuota = o.cpuQuota;
+  cpuPeriod = o.cpuPeriod;
+  cpuList = std::move(o.cpuList);
+  cpuCount = o.cpuCount;
+  memoryMax = o.memoryMax;
+  memoryHigh = o.memoryHigh;
+  memoryCurrent = o.memoryCurrent;
+  periods = o.periods;
+  throttled = o.throttled;
+  throttledTime = o.throttledTime;
+}
+#pragma endregion "Operators"
+
+#pragma region "Methods"
+/**
+* @brief Gets the CPU quota as a number of CPUs
+*
+* @return double The CPUs the quota allows, or 0 if there is no quota
+*/
+double ControlGroup::Quota()
+{
+  return cpuPeriod > 0 ? static_cast<double>(cpuQuota) / cpuPeriod : 0;
+}
+
+/**
+* @brief Gets the number of threads worth running, given both the cpuset and the quota
+*
+* @return std::uint32_t The CPUs in the cpuset, or the whole CPUs in the quota if fewer, and at least one
+*/
+std::uint32_t ControlGroup::EffectiveCPUs()
+{
+  std::uint32_t cpus = cpuCount;
+  // A fractional quota is rounded down, so a pool sized to it is not throttled every period
+  if (cpuQuota > 0)
+  {
+    cpus = cpus == 0 ? static_cast<std::uint32_t>(Quota()) : std::min(cpus, static_cast<std::uint32_t>(Quota()));
+  }
+  return std::max<std::uint32_t>(1, cpus);
+}
+#pragma endregion "Methods"
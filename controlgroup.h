@@ -0,0 +1,56 @@
+/**
+*  @file      controlgroup.h
+*  @brief     The interface for the ControlGroup class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_CONTROLGROUP_H_
+#define CGOGGLES_CONTROLGROUP_H_
+
+#include "pch.h"
+
+/**
+* @brief Represents the limits and usage of the control group cgoggles runs in
+*/
+class ControlGroup
+{
+private:
+  std::string unified;
+  std::string unifiedMount;
+  std::map<std::string, std::string> legacy;
+  std::map<std::string, std::string> legacyMounts;
+  void GetMac();
+  void GetWin();
+  void GetLux();
+  void ReadCpu();
+  void ReadCpuset();
+  void ReadMemory();
+
+public:
+  ControlGroup();
+  ControlGroup(std::uint8_t plt);
+  ControlGroup(const ControlGroup &o) = delete;
+  ControlGroup(ControlGroup &&o);
+  void operator=(const ControlGroup &o) = delete;
+  void operator=(ControlGroup &&o);
+  double Quota();
+  std::uint32_t EffectiveCPUs();
+  std::uint8_t version;
+  std::string path;
+  std::uint64_t cpuQuota;
+  std::uint64_t cpuPeriod;
+  std::string cpuList;
+  std::uint32_t cpuCount;
+  std::uint64_t memoryMax;
+  std::uint64_t memoryHigh;
+  std::uint64_t memoryCurrent;
+  std::uint64_t periods;
+  std::uint64_t throttled;
+  std::uint64_t throttledTime;
+};
+
+#endif // CGOGGLES_CONTROLGROUP_H_
@@ -0,0 +1,501 @@
+/**
+*  @file      controlgrouptree.cpp
+*  @brief     The implementation for the ControlGroupTree class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "controlgrouptree.h"
+#include "os.h"
+#include "sourcefile.h"
+#include "sysroot.h"
+#include "timings.h"
+#include "utils.h"
+
+#if CGOGGLES_OS != OS_WIN
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+* @brief The fewest cgroups at one depth worth handing to a worker thread of their own
+*/
+const std::size_t cgroupsPerWorker = 256;
+
+/**
+* @brief The number of cgroups a worker claims at a time
+*/
+const std::size_t cgroupBatch = 16;
+
+/**
+* @brief The pressure files, in the order of pressureNames
+*/
+static const char *const pressureFiles[pressureKinds] = {"cpu.pressure", "memory.pressure", "io.pressure"};
+
+/**
+* @brief Gets the value a cgroup is ranked by
+*
+* @param  s      The cgroup
+* @param  metric The index of the ranking in cgroupRankings
+* @return double The value to rank by
+*/
+static double rankOf(const ControlGroupSample &s, const std::size_t &metric)
+{
+  return metric == 0 ? s.cpu : metric == 1 ? s.memory : metric == 2 ? s.ioRate : *std::max_element(s.pressure.begin(), s.pressure.end());
+}
+
+/**
+* @brief Reads the number after key= in a word, like rbytes=4096
+*
+* @param  word  The word
+* @param  len   The length of the word
+* @param  key   The key, including the =
+* @param  value The number, if the word holds the key
+* @return true  The word holds the key
+* @return false The word does NOT hold the key
+*/
+static bool keyedValue(const char *word, const std::size_t &len, const char *key, std::uint64_t *value)
+{
+  std::size_t keyLen = std::strlen(key);
+  if (len <= keyLen || std::memcmp(word, key, keyLen) != 0)
+  {
+    return false;
+  }
+  *value = 0;
+  for (std::size_t i = keyLen; i < len && word[i] >= '0' && word[i] <= '9'; ++i)
+  {
+    *value = *value * 10 + (word[i] - '0');
+  }
+  return true;
+}
+
+#if CGOGGLES_OS != OS_WIN
+/**
+* @brief Reads a small file in a cgroup in a single read
+*
+* @param  dir     The descriptor of the cgroup
+* @param  name    The name of the file
+* @param  buffer  The buffer to read into
+* @param  size    The size of the buffer
+* @return ssize_t The bytes read, or less than 1 if the file is missing or the cgroup was removed
+*/
+static ssize_t readGroup(int dir, const char *name, char *buffer, const std::size_t &size)
+{
+  int fd = openat(dir, name, O_RDONLY | O_CLOEXEC);
+  ssize_t len;
+
+  if (fd < 0)
+  {
+    return -1;
+  }
+  len = read(fd, buffer, size);
+  close(fd);
+  return len;
+}
+
+/**
+* @brief Reads a cgroup's usage and lists its children
+*
+* @param root     The descriptor of the hierarchy's mount
+* @param s        The cgroup, whose path and depth are already set
+* @param children The children found, with only their path and depth set
+*/
+static void scanGroup(int root, ControlGroupSample *s, std::vector<ControlGroupSample> *children)
+{
+  char buffer[8192];
+  const char *word;
+  std::size_t wordLen;
+  std::uint64_t value;
+  ssize_t len;
+  int dir = openat(root, s->path.empty() ? "." : s->path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+  s->usage = s->memory = s->io = 0;
+  s->stalls.fill(0);
+  if (dir < 0)
+  {
+    return;
+  }
+
+  len = readGroup(dir, "cpu.stat", buffer, sizeof(buffer));
+  for (Scanner scan(buffer, std::max<ssize_t>(len, 0)); !scan.Done(); scan.SkipLine())
+  {
+    if (scan.Match("usage_usec"))
+    {
+      s->usage = scan.Number();
+      break;
+    }
+  }
+  len = readGroup(dir, "memory.current", buffer, sizeof(buffer));
+  s->memory = len > 0 ? Scanner(buffer, len).Number() : 0;
+
+  // Each line is a device followed by its counters, like 8:0 rbytes=1 wbytes=2 rios=3 ...
+  len = readGroup(dir, "io.stat", buffer, sizeof(buffer));
+  for (Scanner scan(buffer, std::max<ssize_t>(len, 0)); !scan.Done(); scan.SkipLine())
+  {
+    scan.Word(&word);
+    while ((wordLen = scan.Word(&word)) > 0)
+    {
+      if (keyedValue(word, wordLen, "rbytes=", &value) || keyedValue(word, wordLen, "wbytes=", &value))
+      {
+        s->io += value;
+      }
+    }
+  }
+
+  // Only the some line is read, the total time any task was stalled, in microseconds
+  for (std::size_t k = 0; k < pressureKinds; ++k)
+  {
+    len = readGroup(dir, pressureFiles[k], buffer, sizeof(buffer));
+    Scanner scan(buffer, std::max<ssize_t>(len, 0));
+    while ((wordLen = scan.Word(&word)) > 0)
+    {
+      if (keyedValue(word, wordLen, "total=", &s->stalls[k]))
+      {
+        break;
+      }
+    }
+  }
+
+  while ((len = syscall(SYS_getdents64, dir, buffer, sizeof(buffer))) > 0)
+  {
+    // Each record is the inode, offset, length and type, followed by the name
+    for (long off = 0; off < len;)
+    {
+      unsigned short reclen;
+      std::memcpy(&reclen, buffer + off + 16, sizeof(reclen));
+      unsigned char type = buffer[off + 18];
+      const char *name = buffer + off + 19;
+      off += reclen;
+      if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0')))
+      {
+        continue;
+      }
+      struct stat st;
+      if (type != DT_DIR && (type != DT_UNKNOWN || fstatat(dir, name, &st, AT_SYMLINK_NOFOLLOW) != 0 || !S_ISDIR(st.st_mode)))
+      {
+        continue;
+      }
+      children->emplace_back();
+      children->back().path = s->path.empty() ? name : s->path + '/' + name;
+      children->back().depth = s->depth + 1;
+    }
+  }
+  close(dir);
+}
+
+/**
+* @brief Claims batches of the cgroups at one depth until there are none left
+*
+* @param root     The descriptor of the hierarchy's mount
+* @param nodes    The cgroups found so far
+* @param next     The next unclaimed cgroup, shared between the workers
+* @param end      The cgroup after the last one at this depth
+* @param children The children found by this worker
+*/
+static void scanGroups(int root, std::vector<ControlGroupSample> *nodes, std::atomic<std::size_t> *next, std::size_t end, std::vector<ControlGroupSample> *children)
+{
+  std::size_t first;
+  while ((first = next->fetch_add(cgroupBatch)) < end)
+  {
+    for (std::size_t i = first; i < std::min(first + cgroupBatch, end); ++i)
+    {
+      scanGroup(root, &(*nodes)[i], children);
+    }
+  }
+}
+#endif
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new, unsampled ControlGroupTree object
+*/
+ControlGroupTree::ControlGroupTree()
+{
+  root = -1;
+  top = 0;
+  prev = std::vector<ControlGroupSample>();
+  prevTime = curTime = 0;
+  samples = 0;
+  mount = "";
+  nodes = std::vector<ControlGroupSample>();
+}
+
+/**
+* @brief Construct a new ControlGroupTree object with help from the assistants
+*
+* @param plt The platform of the system
+* @param n   The number of cgroups to keep in each ranking
+*/
+ControlGroupTree::ControlGroupTree(std::uint8_t plt, const std::size_t &n) : ControlGroupTree()
+{
+  top = n;
+  switch (plt)
+  {
+  case OS_WIN:
+    GetWin();
+    break;
+  case OS_MAC:
+    GetMac();
+    break;
+  case OS_LUX:
+    GetLux();
+    break;
+  }
+}
+
+/**
+* @brief Construct a new ControlGroupTree object from another ControlGroupTree object
+*
+* @param o The ControlGroupTree object to move from
+*/
+ControlGroupTree::ControlGroupTree(ControlGroupTree &&o)
+{
+  root = o.root;
+  top = o.top;
+  prev = std::move(o.prev);
+  prevTime = o.prevTime;
+  curTime = o.curTime;
+  samples = o.samples;
+  mount = std::move(o.mount);
+  nodes = std::move(o.nodes);
+  ranked = std::move(o.ranked);
+  o.root = -1;
+}
+
+/**
+* @brief Destroy the ControlGroupTree object, closing the hierarchy
+*/
+ControlGroupTree::~ControlGroupTree()
+{
+#if CGOGGLES_OS != OS_WIN
+  if (root >= 0)
+  {
+    close(root);
+  }
+#endif
+}
+#pragma endregion "Constructors"
+
+#pragma region "Constructors' Assistants"
+/**
+* @brief Fills in the hierarchy for Darwin systems, which has none
+*/
+void ControlGroupTree::GetMac() {}
+
+/**
+* @brief Fills in the hierarchy for Windows systems, which has none
+*/
+void ControlGroupTree::GetWin() {}
+
+/**
+* @brief Finds and opens the unified hierarchy for Linux systems
+*/
+void ControlGroupTree::GetLux()
+{
+  std::vector<std::string> lines;
+  std::vector<std::string> fields;
+  std::string text;
+  std::size_t sep;
+
+  // Hybrid systems mount it beside the legacy hierarchies, like /sys/fs/cgroup/unified
+  mount = "/sys/fs/cgroup";
+  if (readFile("/proc/self/mountinfo", &text))
+  {
+    splitStringVector(trim(text), "\n", &lines);
+    for (std::size_t i = 0; i < lines.size(); ++i)
+    {
+      splitStringVector(lines[i], " ", &fields);
+      sep = std::find(fields.begin(), fields.end(), "-") - fields.begin();
+      if (fields.size() >= 5 && sep + 1 < fields.size() && fields[sep + 1] == "cgroup2")
+      {
+        mount = fields[4];
+        break;
+      }
+    }
+  }
+  SourceTiming timing(mount);
+  root = openPath(mount, true);
+}
+
+/**
+* @brief Walks the hierarchy one depth at a time, splitting each depth's cgroups across worker threads
+*/
+void ControlGroupTree::WalkLux()
+{
+#if CGOGGLES_OS != OS_WIN
+  SourceTiming timing(mount, false, false);
+  std::vector<std::vector<ControlGroupSample>> children;
+  std::vector<std::thread> pool;
+  std::atomic<std::size_t> next;
+  std::size_t workers;
+
+  nodes.clear();
+  nodes.emplace_back();
+  nodes.back().depth = 0;
+  for (std::size_t begin = 0, end = 1; begin < end; begin = end, end = nodes.size())
+  {
+    workers = std::max<std::size_t>(1, std::min<std::size_t>(std::thread::hardware_concurrency(), (end - begin) / cgroupsPerWorker));
+    children.assign(workers, std::vector<ControlGroupSample>());
+    next = begin;
+
+    // The workers only touch this depth's cgroups, so nodes is not grown until they are joined
+    pool.clear();
+    for (std::size_t w = 1; w < workers; ++w)
+    {
+      pool.emplace_back(scanGroups, root, &nodes, &next, end, &children[w]);
+    }
+    scanGroups(root, &nodes, &next, end, &children[0]);
+    for (std::size_t w = 0; w < pool.size(); ++w)
+    {
+      pool[w].join();
+    }
+    for (std::size_t w = 0; w < workers; ++w)
+    {
+      std::move(children[w].begin(), children[w].end(), std::back_inserter(nodes));
+    }
+  }
+#endif
+}
+
+/**
+* @brief Walks every cgroup, comparing each against the previous walk, and ranks the busiest
+*/
+void ControlGroupTree::SampleLux()
+{
+  std::vector<std::size_t> order;
+  std::vector<ControlGroupSample> sorted;
+  double seconds;
+
+  std::swap(prev, nodes);
+  prevTime = curTime;
+  curTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  seconds = samples ? (curTime - prevTime) / 1e9 : 0;
+  WalkLux();
+
+  // The paths are sorted through their indices, so each sample is moved only once
+  order.resize(nodes.size());
+  for (std::size_t i = 0; i < order.size(); ++i)
+  {
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(), [this](const std::size_t &a, const std::size_t &b) { return nodes[a].path < nodes[b].path; });
+  sorted.resize(nodes.size());
+  for (std::size_t i = 0; i < order.size(); ++i)
+  {
+    sorted[i] = std::move(nodes[order[i]]);
+  }
+  std::swap(nodes, sorted);
+
+  for (std::size_t i = 0; i < nodes.size(); ++i)
+  {
+    ControlGroupSample &s = nodes[i];
+    s.cpu = s.ioRate = 0;
+    s.pressure.fill(0);
+    if (seconds <= 0)
+    {
+      continue;
+    }
+    // A cgroup removed and recreated between walks starts its counters over, so they are not compared
+    auto last = std::lower_bound(prev.begin(), prev.end(), s.path, [](const ControlGroupSample &p, const std::string &path) { return p.path < path; });
+    if (last == prev.end() || last->path != s.path || s.usage < last->usage)
+    {
+      continue;
+    }
+    s.cpu = (s.usage - last->usage) / 1e6 / seconds * 100;
+    s.ioRate = s.io > last->io ? (s.io - last->io) / seconds : 0;
+    for (std::size_t k = 0; k < pressureKinds; ++k)
+    {
+      s.pressure[k] = s.stalls[k] > last->stalls[k] ? (s.stalls[k] - last->stalls[k]) / 1e6 / seconds * 100 : 0;
+    }
+  }
+
+  // The root holds the whole system, so it is left out of the rankings
+  for (std::size_t m = 0; m < cgroupMetrics; ++m)
+  {
+    std::vector<std::size_t> &rank = ranked[m];
+    rank.clear();
+    for (std::size_t i = 1; i < nodes.size(); ++i)
+    {
+      rank.push_back(i);
+    }
+    auto busier = [this, m](const std::size_t &a, const std::size_t &b) { return rankOf(nodes[a], m) > rankOf(nodes[b], m) || (rankOf(nodes[a], m) == rankOf(nodes[b], m) && a < b); };
+    std::size_t keep = std::min(top, rank.size());
+    std::partial_sort(rank.begin(), rank.begin() + keep, rank.end(), busier);
+    rank.resize(keep);
+  }
+  ++samples;
+}
+#pragma endregion "Constructors' Assistants"
+
+#pragma region "Operators"
+/**
+* @brief Moves another ControlGroupTree object into this one
+*
+* @param o The ControlGroupTree object to move from
+*/
+void ControlGroupTree::operator=(ControlGroupTree &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+#if CGOGGLES_OS != OS_WIN
+  if (root >= 0)
+  {
+    close(root);
+  }
+#endif
+  root = o.root;
+  top = o.top;
+  prev = std::move(o.prev);
+  prevTime = o.prevTime;
+  curTime = o.curTime;
+  samples = o.samples;
+  mount = std::move(o.mount);
+  nodes = std::move(o.nodes);
+  ranked = std::move(o.ranked);
+  o.root = -1;
+}
+#pragma endregion "Operators"
+
+#pragma region "Methods"
+/**
+* @brief Walks every cgroup, keeping the previous walk to compare against
+*/
+void ControlGroupTree::Sample()
+{
+  if (root >= 0)
+  {
+    SampleLux();
+  }
+}
+
+/**
+* @brief Checks whether or not there are two comparable walks
+*
+* @return true  The CPU, I/O and pressure rates can be computed
+* @return false The CPU, I/O and pressure rates can NOT be computed yet
+*/
+bool ControlGroupTree::Ready()
+{
+  return samples >= 2 && curTime > prevTime;
+}
+
+/**
+* @brief Gets the worst of a cgroup's stall pressures
+*
+* @param  i      The index of the cgroup in nodes
+* @return double The largest share of the window any task was stalled on a resource, as a percentage
+*/
+double ControlGroupTree::Pressure(const std::size_t &i)
+{
+  return rankOf(nodes[i], cgroupMetrics - 1);
+}
+#pragma endregion "Methods"
@@ -0,0 +1,78 @@
+/**
+*  @file      controlgrouptree.h
+*  @brief     The interface for the ControlGroupTree class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_CONTROLGROUPTREE_H_
+#define CGOGGLES_CONTROLGROUPTREE_H_
+
+#include "pch.h"
+#include "pressurestats.h"
+
+/**
+* @brief The number of metrics that cgroups are ranked by
+*/
+const std::size_t cgroupMetrics = 4;
+
+/**
+* @brief The names of the rankings, by CPU usage, memory, storage I/O and the worst stall pressure
+*/
+const char *const cgroupRankings[cgroupMetrics] = {"TopCPU", "TopMemory", "TopIO", "TopPressure"};
+
+/**
+* @brief Represents what a single walk of the hierarchy reads for a cgroup
+*/
+class ControlGroupSample
+{
+public:
+  std::string path;
+  std::uint32_t depth;
+  std::uint64_t usage;
+  std::uint64_t memory;
+  std::uint64_t io;
+  std::array<std::uint64_t, pressureKinds> stalls;
+  double cpu;
+  double ioRate;
+  std::array<double, pressureKinds> pressure;
+};
+
+/**
+* @brief Represents every cgroup in the unified hierarchy, and the busiest of them between two walks
+*/
+class ControlGroupTree
+{
+private:
+  int root;
+  std::size_t top;
+  std::vector<ControlGroupSample> prev;
+  std::uint64_t prevTime;
+  std::uint64_t curTime;
+  std::size_t samples;
+  void GetMac();
+  void GetWin();
+  void GetLux();
+  void WalkLux();
+  void SampleLux();
+
+public:
+  ControlGroupTree();
+  ControlGroupTree(std::uint8_t plt, const std::size_t &n);
+  ControlGroupTree(const ControlGroupTree &o) = delete;
+  ControlGroupTree(ControlGroupTree &&o);
+  void operator=(const ControlGroupTree &o) = delete;
+  void operator=(ControlGroupTree &&o);
+  ~ControlGroupTree();
+  void Sample();
+  bool Ready();
+  double Pressure(const std::size_t &i);
+  std::string mount;
+  std::vector<ControlGroupSample> nodes;
+  std::array<std::vector<std::size_t>, cgroupMetrics> ranked;
+};
+
+#endif // CGOGGLES_CONTROLGROUPTREE_H_
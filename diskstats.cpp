@@ -0,0 +1,345 @@
+/**
+*  @file      diskstats.cpp
+*  @brief     The implementation for the DiskStats class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "diskstats.h"
+#include "os.h"
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new, unsampled DiskStats object
+*/
+DiskStats::DiskStats()
+{
+  devs = std::vector<std::uint64_t>();
+  prev = std::vector<std::array<std::uint64_t, diskFields>>();
+  cur = std::vector<std::array<std::uint64_t, diskFields>>();
+  index = std::unordered_map<std::uint64_t, std::size_t>();
+  prevTime = curTime = 0;
+  samples = 0;
+}
+
+/**
+* @brief Construct a new DiskStats object with help from the assistants
+*
+* @param plt The platform of the system
+*/
+DiskStats::DiskStats(std::uint8_t plt) : DiskStats()
+{
+  switch (plt)
+  {
+  case OS_WIN:
+    GetWin();
+    break;
+  case OS_MAC:
+    GetMac();
+    break;
+  case OS_LUX:
+    GetLux();
+    break;
+  }
+}
+
+/**
+* @brief Construct a new DiskStats object from another DiskStats object
+*
+* @param o The DiskStats object to move from
+*/
+DiskStats::DiskStats(DiskStats &&o)
+{
+  stats = std::move(o.stats);
+  devs = std::move(o.devs);
+  prev = std::move(o.prev);
+  cur = std::move(o.cur);
+  index = std::move(o.index);
+  prevTime = o.prevTime;
+  curTime = o.curTime;
+  samples = o.samples;
+}
+#pragma endregion "Constructors"
+
+#pragma region "Constructors' Assistants"
+/**
+* @brief Fills in the I/O sources for Darwin systems
+*/
+void DiskStats::GetMac() {}
+
+/**
+* @brief Fills in the I/O sources for Windows systems
+*/
+void DiskStats::GetWin() {}
+
+/**
+* @brief Fills in the I/O sources for Linux systems
+*/
+void DiskStats::GetLux()
+{
+  stats = SourceFile("/proc/diskstats");
+}
+
+/**
+* @brief Takes a sample of /proc/diskstats, only rebuilding the index when a device comes or goes
+*/
+void DiskStats::SampleLux()
+{
+  std::size_t row = 0;
+  std::uint64_t dev;
+  bool same = true;
+  const char *name;
+
+  std::swap(prev, cur);
+  prevTime = curTime;
+  curTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  if (!stats.Read())
+  {
+    samples = 0;
+    return;
+  }
+
+  Scanner scan(stats.Data(), stats.Size());
+  while (!scan.Done())
+  {
+    dev = scan.Number() << 32;
+    dev |= scan.Number();
+    if (scan.Word(&name) == 0)
+    {
+      scan.SkipLine();
+      continue;
+    }
+    if (row >= devs.size())
+    {
+      devs.push_back(dev);
+      same = false;
+    }
+    else if (devs[row] != dev)
+    {
+      devs[row] = dev;
+      same = false;
+    }
+    if (row >= cur.size())
+    {
+      cur.resize(row + 1);
+    }
+    for (std::size_t i = 0; i < diskFields; ++i)
+    {
+      cur[row][i] = scan.Number();
+    }
+    scan.SkipLine();
+    ++row;
+  }
+
+  if (!same || row != devs.size() || row != prev.size())
+  {
+    devs.resize(row);
+    cur.resize(row);
+    index.clear();
+    for (std::size_t i = 0; i < row; ++i)
+    {
+      index[devs[i]] = i;
+    }
+    samples = 0;
+  }
+  ++samples;
+}
+#pragma endregion "Constructors' Assistants"
+
+#pragma region "Operators"
+/**
+* @brief Moves another DiskStats object into this one
+*
+* @param o The DiskStats object to move from
+*/
+void DiskStats::operator=(DiskStats &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  stats = std::move(o.stats);
+  devs = std::move(o.devs);
+  prev = std::move(o.prev);
+  cur = std::move(o.cur);
+  index = std::move(o.index);
+  prevTime = o.prevTime;
+  curTime = o.curTime;
+  samples = o.samples;
+}
+#pragma endregion "Operators"
+
+#pragma region "Methods"
+/**
+* @brief Gets how much a counter grew between the two samples
+*
+* @param  row    The row of the device
+* @param  field  The index of the counter
+* @return double The growth of the counter
+*/
+double DiskStats::Delta(const std::size_t &row, const std::size_t &field)
+{
+  if (!Ready() || row >= cur.size() || cur[row][field] < prev[row][field])
+  {
+    return 0;
+  }
+  return cur[row][field] - prev[row][field];
+}
+
+/**
+* @brief Takes a sample of every block device, keeping the previous one to compare against
+*/
+void DiskStats::Sample()
+{
+  if (stats.Good())
+  {
+    SampleLux();
+  }
+}
+
+/**
+* @brief Checks whether or not there are two comparable samples
+*
+* @return true  The rates can be computed
+* @return false The rates can NOT be computed yet
+*/
+bool DiskStats::Ready()
+{
+  return samples >= 2 && curTime > prevTime;
+}
+
+/**
+* @brief Counts the devices in the last sample
+*
+* @return std::size_t The number of rows
+*/
+std::size_t DiskStats::Rows()
+{
+  return devs.size();
+}
+
+/**
+* @brief Finds the row of a device from its device number
+*
+* @param  dev   The device number, as MAJOR:MINOR
+* @param  row   The row of the device
+* @return true  The device was found
+* @return false The device was NOT found
+*/
+bool DiskStats::Find(const std::string &dev, std::size_t *row)
+{
+  std::size_t colon = dev.find(':');
+  std::uint64_t key;
+
+  if (colon == std::string::npos)
+  {
+    return false;
+  }
+  Scanner scan(dev.data(), colon);
+  key = scan.Number() << 32;
+  scan = Scanner(dev.data() + colon + 1, dev.size() - colon - 1);
+  key |= scan.Number();
+
+  auto found = index.find(key);
+  if (found == index.end())
+  {
+    return false;
+  }
+  (*row) = found->second;
+  return true;
+}
+
+/**
+* @brief Gets the rate of completed reads
+*
+* @param  row    The row of the device
+* @return double The reads per second
+*/
+double DiskStats::ReadIOPS(const std::size_t &row)
+{
+  return Ready() ? Delta(row, 0) * 1e9 / (curTime - prevTime) : 0;
+}
+
+/**
+* @brief Gets the rate of completed writes
+*
+* @param  row    The row of the device
+* @return double The writes per second
+*/
+double DiskStats::WriteIOPS(const std::size_t &row)
+{
+  return Ready() ? Delta(row, 4) * 1e9 / (curTime - prevTime) : 0;
+}
+
+/**
+* @brief Gets the rate of bytes read, from the 512 byte sectors read
+*
+* @param  row    The row of the device
+* @return double The bytes read per second
+*/
+double DiskStats::ReadBytes(const std::size_t &row)
+{
+  return Ready() ? Delta(row, 2) * 512 * 1e9 / (curTime - prevTime) : 0;
+}
+
+/**
+* @brief Gets the rate of bytes written, from the 512 byte sectors written
+*
+* @param  row    The row of the device
+* @return double The bytes written per second
+*/
+double DiskStats::WriteBytes(const std::size_t &row)
+{
+  return Ready() ? Delta(row, 6) * 512 * 1e9 / (curTime - prevTime) : 0;
+}
+
+/**
+* @brief Gets the average time each completed read took
+*
+* @param  row    The row of the device
+* @return double The average read latency in milliseconds
+*/
+double DiskStats::ReadLatency(const std::size_t &row)
+{
+  double reads = Delta(row, 0);
+  return reads ? Delta(row, 3) / reads : 0;
+}
+
+/**
+* @brief Gets the average time each completed write took
+*
+* @param  row    The row of the device
+* @return double The average write latency in milliseconds
+*/
+double DiskStats::WriteLatency(const std::size_t &row)
+{
+  double writes = Delta(row, 4);
+  return writes ? Delta(row, 7) / writes : 0;
+}
+
+/**
+* @brief Gets the number of requests in flight at the latest sample
+*
+* @param  row           The row of the device
+* @return std::uint64_t The queue depth
+*/
+std::uint64_t DiskStats::InFlight(const std::size_t &row)
+{
+  return row < cur.size() ? cur[row][8] : 0;
+}
+
+/**
+* @brief Gets the share of time that the device was busy between the two samples
+*
+* @param  row    The row of the device
+* @return double The percentage of time with at least one request in flight
+*/
+double DiskStats::Utilization(const std::size_t &row)
+{
+  return Ready() ? std::min(100.0, Delta(row, 9) * 1e8 / (curTime - prevTime)) : 0;
+}
+#pragma endregion "Methods"
@@ -0,0 +1,63 @@
+/**
+*  @file      diskstats.h
+*  @brief     The interface for the DiskStats class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_DISKSTATS_H_
+#define CGOGGLES_DISKSTATS_H_
+
+#include "pch.h"
+#include "sourcefile.h"
+
+/**
+* @brief The number of counters kept for each block device, in /proc/diskstats order
+*/
+const std::size_t diskFields = 11;
+
+/**
+* @brief Represents the I/O activity of a computer's block devices between two samples
+*/
+class DiskStats
+{
+private:
+  SourceFile stats;
+  std::vector<std::uint64_t> devs;
+  std::vector<std::array<std::uint64_t, diskFields>> prev;
+  std::vector<std::array<std::uint64_t, diskFields>> cur;
+  std::unordered_map<std::uint64_t, std::size_t> index;
+  std::uint64_t prevTime;
+  std::uint64_t curTime;
+  std::size_t samples;
+  void GetMac();
+  void GetWin();
+  void GetLux();
+  void SampleLux();
+  double Delta(const std::size_t &row, const std::size_t &field);
+
+public:
+  DiskStats();
+  DiskStats(std::uint8_t plt);
+  DiskStats(const DiskStats &o) = delete;
+  DiskStats(DiskStats &&o);
+  void operator=(const DiskStats &o) = delete;
+  void operator=(DiskStats &&o);
+  void Sample();
+  bool Ready();
+  std::size_t Rows();
+  bool Find(const std::string &dev, std::size_t *row);
+  double ReadIOPS(const std::size_t &row);
+  double WriteIOPS(const std::size_t &row);
+  double ReadBytes(const std::size_t &row);
+  double WriteBytes(const std::size_t &row);
+  double ReadLatency(const std::size_t &row);
+  double WriteLatency(const std::size_t &row);
+  std::uint64_t InFlight(const std::size_t &row);
+  double Utilization(const std::size_t &row);
+};
+
+#endif // CGOGGLES_DISKSTATS_H_
@@ -36,71 +36,45 @@ FileSystem::FileSystem()
 */
 FileSystem::FileSystem(std::string f, std::string tp, std::uint64_t sz, std::uint64_t us, std::string mnt)
 {
-  fs = f;
-  type = tp;
+  fs = std::move(f);
+  type = std::move(tp);
   size = sz;
   used = us;
-  mount = mnt;
+  mount = std::move(mnt);
 }
 
 /**
 * @brief Construct a new FileSystem object from another FileSystem object
 *
-* @param o The FileSystem object to copy from
+* @param o The FileSystem object to move from
 */
-FileSystem::FileSystem(const FileSystem &o)
+FileSystem::FileSystem(FileSystem &&o)
 {
-  fs = o.fs;
-  type = o.type;
+  fs = std::move(o.fs);
+  type = std::move(o.type);
   size = o.size;
   used = o.used;
-  mount = o.mount;
+  mount = std::move(o.mount);
 }
 #pragma endregion "Contructors"
 
 #pragma region "Operators"
 /**
-* @brief Reserves memory for a new fs object
+* @brief Moves another FileSystem object into this one
 *
-* @param  size  The amount of memory to allocate
-* @return void* A pointer to the allocated memory
+* @param o The FileSystem object to move from
 */
-void *FileSystem::operator new(std::size_t size)
-{
-  void *o = ::new (FileSystem);
-  return o;
-}
-
-/**
-* @brief Sets equal two fs objects
-*
-* @param o The fs object to copy from
-*/
-void FileSystem::operator=(const FileSystem &o)
+void FileSystem::operator=(FileSystem &&o)
 {
   if (&o == this)
   {
     return;
   }
 
-  fs = o.fs;
-  type = o.type;
+  fs = std::move(o.fs);
+  type = std::move(o.type);
   size = o.size;
   used = o.used;
-  mount = o.mount;
-}
-
-/**
-* @brief Sets equal two fs objects
-*
-* @param o The fs object to copy from
-*/
-void FileSystem::operator=(FileSystem *o)
-{
-  fs = o->fs;
-  type = o->type;
-  size = o->size;
-  used = o->used;
-  mount = o->mount;
+  mount = std::move(o.mount);
 }
 #pragma endregion "Operators"
@@ -14,9 +14,6 @@
 #include "pch.h"
 #include "utils.h"
 
-extern OutputStyle style;
-extern bool pretty;
-
 /**
 * @brief Represents a computer's file system
 */
@@ -25,10 +22,10 @@ class FileSystem
 public:
   FileSystem();
   FileSystem(std::string f, std::string tp, std::uint64_t sz, std::uint64_t us, std::string mnt);
-  FileSystem(const FileSystem &o);
-  void *operator new(std::size_t size);
-  void operator=(const FileSystem &o);
-  void operator=(FileSystem *o);
+  FileSystem(const FileSystem &o) = delete;
+  FileSystem(FileSystem &&o);
+  void operator=(const FileSystem &o) = delete;
+  void operator=(FileSystem &&o);
   std::string fs;
   std::string type;
   std::uint64_t size;
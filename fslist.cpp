@@ -12,6 +12,7 @@
 #include "fslist.h"
 #include "os.h"
 #include "utils.h"
+#include "sysroot.h"
 
 #pragma region "Contructors"
 /**
@@ -48,13 +49,11 @@ FileSystemList::FileSystemList(std::uint8_t plt)
 /**
 * @brief Construct a new FileSystemList object from another FileSystemList object
 *
-* @param o The FileSystemList object to copy from
+* @param o The FileSystemList object to move from
 */
-FileSystemList::FileSystemList(const FileSystemList &o)
+FileSystemList::FileSystemList(FileSystemList &&o)
 {
-  fsList = std::vector<FileSystem>();
-
-  fsList = o.fsList;
+  fsList = std::move(o.fsList);
 }
 #pragma endregion "Contructors"
 
@@ -66,7 +65,6 @@ void FileSystemList::GetMac()
 {
   std::vector<std::string> eachFS;
   std::vector<std::string> allFS;
-  FileSystem tempFileSystem;
   std::string tempFS = "";
   std::string tempType = "";
   std::uint64_t tempSize = 0;
@@ -88,8 +86,7 @@ void FileSystemList::GetMac()
     tempUsed = std::stoull(eachFS[2]) * 1024;
     tempMount = eachFS[eachFS.size() - 1];
 
-    tempFileSystem = FileSystem(tempFS, tempType, tempSize, tempUsed, tempMount);
-    fsList.push_back(tempFileSystem);
+    fsList.emplace_back(tempFS, tempType, tempSize, tempUsed, tempMount);
   }
 }
 
@@ -100,7 +97,6 @@ void FileSystemList::GetWin()
 {
   std::string wmic = getWmicPath();
   std::vector<std::map<std::string, std::string>> allFS = runListMultiWmic("logicaldisk get Caption, FileSystem, FreeSpace, Size", &wmic);
-  FileSystem tempFileSystem;
   std::string tempFS = "";
   std::string tempType = "";
   std::uint64_t tempSize = 0;
@@ -115,8 +111,7 @@ void FileSystemList::GetWin()
     tempUsed = allFS[i]["FreeSpace"] == "" ? 0 : std::stoull(allFS[i]["FreeSpace"]);
     tempMount = allFS[i]["Caption"];
 
-    tempFileSystem = FileSystem(tempFS, tempType, tempSize, tempUsed, tempMount);
-    fsList.push_back(tempFileSystem);
+    fsList.emplace_back(tempFS, tempType, tempSize, tempUsed, tempMount);
   }
 }
 
@@ -124,17 +119,36 @@ void FileSystemList::GetWin()
 * @brief Fills in the storage list information for Linux systems
 */
 void FileSystemList::GetLux()
+{
+  std::string temp;
+
+  if (activeSysroot() != nullptr)
+  {
+    if (readMountInfo(&temp))
+    {
+      ParseMountInfo(temp);
+    }
+    return;
+  }
+  ParseLux(runCommand("df -lkPT | grep ^/"));
+}
+
+/**
+* @brief Fills in the file system list information from the output of df
+*
+* @param text The portable output of df, with the type column
+*/
+void FileSystemList::ParseLux(const std::string &text)
 {
   std::vector<std::string> eachFS;
   std::vector<std::string> allFS;
-  FileSystem tempFileSystem;
   std::string tempFS = "";
   std::string tempType = "";
   std::uint64_t tempSize = 0;
   std::uint64_t tempUsed = 0;
   std::string tempMount = "";
 
-  splitStringVector(runCommand("df -lkP | grep ^/"), "\n", &allFS);
+  splitStringVector(text, "\n", &allFS);
 
   for (std::size_t i = 0; i < allFS.size(); ++i)
   {
@@ -143,56 +157,117 @@ void FileSystemList::GetLux()
       break;
     }
     splitStringVector(std::regex_replace(allFS[i], std::regex(R"(  +)"), " "), " ", &eachFS);
+    if (eachFS.size() < 7)
+    {
+      continue;
+    }
     tempFS = eachFS[0];
     tempType = eachFS[1];
-    tempSize = std::stoull(eachFS[2]) * 1000;
-    tempUsed = std::stoull(eachFS[3]) * 1000;
-    tempMount = eachFS[eachFS.size() - 1];
+    tempSize = std::stoull(eachFS[2]) * 1024;
+    tempUsed = std::stoull(eachFS[3]) * 1024;
+    tempMount = eachFS[6];
+    for (std::size_t j = 7; j < eachFS.size(); ++j)
+    {
+      tempMount += " " + eachFS[j];
+    }
 
-    tempFileSystem = FileSystem(tempFS, tempType, tempSize, tempUsed, tempMount);
-    fsList.push_back(tempFileSystem);
+    fsList.emplace_back(tempFS, tempType, tempSize, tempUsed, tempMount);
   }
 }
-#pragma endregion
 
-#pragma region "Operators"
 /**
-* @brief Reserves memory for a new File System object
+* @brief Fills in the file system list information from a mount table, like df
 *
-* @param  size  The amount of memory to allocate
-* @return void* A pointer to the allocated memory
+* @param text The contents of /proc/[pid]/mountinfo
 */
-void *FileSystemList::operator new(std::size_t size)
+void FileSystemList::ParseMountInfo(const std::string &text)
 {
-  void *o = ::new (FileSystemList);
-  return o;
+  std::vector<std::string> allMounts;
+  std::vector<std::string> eachMount;
+  std::set<std::string> seen;
+  std::size_t sep;
+  std::string tempFS = "";
+  std::string tempType = "";
+  std::uint64_t tempSize = 0;
+  std::uint64_t tempUsed = 0;
+  std::string tempMount = "";
+
+  splitStringVector(text, "\n", &allMounts);
+  for (std::size_t i = 0; i < allMounts.size(); ++i)
+  {
+    splitStringVector(allMounts[i], " ", &eachMount);
+    sep = std::find(eachMount.begin(), eachMount.end(), "-") - eachMount.begin();
+    if (sep < 6 || sep + 2 >= eachMount.size())
+    {
+      continue;
+    }
+
+    tempFS = unescapeMount(eachMount[sep + 2]);
+    tempType = eachMount[sep + 1];
+    tempMount = unescapeMount(eachMount[4]);
+    // Only local devices, and only the first mount of each, like df -l
+    if (tempFS.empty() || tempFS[0] != '/' || !seen.insert(tempFS).second)
+    {
+      continue;
+    }
+    if (!statFileSystem(tempMount, &tempSize, &tempUsed))
+    {
+      continue;
+    }
+
+    fsList.emplace_back(tempFS, tempType, tempSize, tempUsed, tempMount);
+  }
 }
+#pragma endregion
 
+#pragma region "Operators"
 /**
-* @brief Sets equal two File System objects
+* @brief Moves another FileSystemList object into this one
 *
-* @param o The File System object to copy from
+* @param o The FileSystemList object to move from
 */
-void FileSystemList::operator=(const FileSystemList &o)
+void FileSystemList::operator=(FileSystemList &&o)
 {
   if (&o == this)
   {
     return;
   }
-  fsList = std::vector<FileSystem>();
-
-  fsList = o.fsList;
+  fsList = std::move(o.fsList);
 }
+#pragma endregion "Operators"
 
+#pragma region "Static Methods"
 /**
-* @brief Sets equal two File System objects
+* @brief Reads the mount table of the system, preferring init's over our own
 *
-* @param o The File System object to copy from
+* @param  o     The contents of the mount table, if read
+* @return true  The mount table was read successfully
+* @return false The mount table was NOT read successfully
 */
-void FileSystemList::operator=(FileSystemList *o)
+bool readMountInfo(std::string *o)
 {
-  fsList = std::vector<FileSystem>();
+  return readFile("/proc/1/mountinfo", o) || readFile("/proc/self/mountinfo", o);
+}
 
-  fsList = o->fsList;
+/**
+* @brief Decodes the octal escapes used for spaces and tabs in the mount table
+*
+* @param  s           The escaped field
+* @return std::string The decoded field
+*/
+std::string unescapeMount(const std::string &s)
+{
+  std::string ret;
+  for (std::size_t i = 0; i < s.size(); ++i)
+  {
+    if (s[i] == '\\' && i + 3 < s.size() && std::isdigit(s[i + 1]) && std::isdigit(s[i + 2]) && std::isdigit(s[i + 3]))
+    {
+      ret += char((s[i + 1] - '0') * 64 + (s[i + 2] - '0') * 8 + (s[i + 3] - '0'));
+      i += 3;
+      continue;
+    }
+    ret += s[i];
+  }
+  return ret;
 }
-#pragma endregion "Operators"
+#pragma endregion "Static Methods"
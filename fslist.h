@@ -27,11 +27,16 @@ private:
 public:
   FileSystemList();
   FileSystemList(std::uint8_t plt);
-  FileSystemList(const FileSystemList &o);
-  void *operator new(std::size_t size);
-  void operator=(const FileSystemList &o);
-  void operator=(FileSystemList *o);
+  FileSystemList(const FileSystemList &o) = delete;
+  FileSystemList(FileSystemList &&o);
+  void operator=(const FileSystemList &o) = delete;
+  void operator=(FileSystemList &&o);
+  void ParseLux(const std::string &text);
+  void ParseMountInfo(const std::string &text);
   std::vector<FileSystem> fsList;
 };
 
+bool readMountInfo(std::string *o);
+std::string unescapeMount(const std::string &s);
+
 #endif // CGOGGLES_FSLIST_H_
@@ -36,9 +36,9 @@ Graphics::Graphics()
 */
 Graphics::Graphics(std::string vnd, std::string mdl, std::string b, std::uint64_t ram, bool dyn)
 {
-  vendor = vnd;
-  model = mdl;
-  bus = b;
+  vendor = std::move(vnd);
+  model = std::move(mdl);
+  bus = std::move(b);
   vram = ram;
   dynamic = dyn;
 }
@@ -46,13 +46,13 @@ Graphics::Graphics(std::string vnd, std::string mdl, std::string b, std::uint64_
 /**
 * @brief Construct a new Graphics object from another Graphics object
 *
-* @param o The Graphics object to copy from
+* @param o The Graphics object to move from
 */
-Graphics::Graphics(const Graphics &o)
+Graphics::Graphics(Graphics &&o)
 {
-  vendor = o.vendor;
-  model = o.model;
-  bus = o.bus;
+  vendor = std::move(o.vendor);
+  model = std::move(o.model);
+  bus = std::move(o.bus);
   vram = o.vram;
   dynamic = o.dynamic;
 }
@@ -60,47 +60,21 @@ Graphics::Graphics(const Graphics &o)
 
 #pragma region "Operators"
 /**
-* @brief Reserves memory for a new Graphics object
+* @brief Moves another Graphics object into this one
 *
-* @param  size  The amount of memory to allocate
-* @return void* A pointer to the allocated memory
+* @param o The Graphics object to move from
 */
-void *Graphics::operator new(std::size_t size)
-{
-  void *o = ::new (Graphics);
-  return o;
-}
-
-/**
-* @brief Sets equal two Graphics objects
-*
-* @param o The Graphics object to copy from
-*/
-void Graphics::operator=(const Graphics &o)
+void Graphics::operator=(Graphics &&o)
 {
   if (&o == this)
   {
     return;
   }
 
-  vendor = o.vendor;
-  model = o.model;
-  bus = o.bus;
+  vendor = std::move(o.vendor);
+  model = std::move(o.model);
+  bus = std::move(o.bus);
   vram = o.vram;
   dynamic = o.dynamic;
 }
-
-/**
-* @brief Sets equal two Graphics objects
-*
-* @param o The Graphics object to copy from
-*/
-void Graphics::operator=(Graphics *o)
-{
-  vendor = o->vendor;
-  model = o->model;
-  bus = o->bus;
-  vram = o->vram;
-  dynamic = o->dynamic;
-}
 #pragma endregion "Operators"
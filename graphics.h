@@ -21,10 +21,10 @@ class Graphics
 public:
   Graphics();
   Graphics(std::string vnd, std::string mdl, std::string b, std::uint64_t ram, bool dyn);
-  Graphics(const Graphics &o);
-  void *operator new(std::size_t size);
-  void operator=(const Graphics &o);
-  void operator=(Graphics *o);
+  Graphics(const Graphics &o) = delete;
+  Graphics(Graphics &&o);
+  void operator=(const Graphics &o) = delete;
+  void operator=(Graphics &&o);
   std::string vendor;
   std::string model;
   std::string bus;
@@ -49,11 +49,11 @@ GraphicsList::GraphicsList(std::uint8_t plt)
 /**
 * @brief Construct a new GraphicsList object from another GraphicsList object
 *
-* @param o The GraphicsList object to copy from
+* @param o The GraphicsList object to move from
 */
-GraphicsList::GraphicsList(const GraphicsList &o)
+GraphicsList::GraphicsList(GraphicsList &&o)
 {
-  controllers = o.controllers;
+  controllers = std::move(o.controllers);
 }
 #pragma endregion "Contructors"
 
@@ -65,7 +65,6 @@ void GraphicsList::GetMac()
 {
   std::vector<std::string> allControllers;
   std::vector<std::string> eachController;
-  Graphics tempController;
   std::string tempVendor = "";
   std::string tempModel = "";
   std::string tempBus = "";
@@ -119,8 +118,7 @@ void GraphicsList::GetMac()
         }
       }
     }
-    tempController = new Graphics(tempVendor, tempModel, tempBus, tempVRAM, tempDynamic);
-    controllers.push_back(tempController);
+    controllers.emplace_back(tempVendor, tempModel, tempBus, tempVRAM, tempDynamic);
   }
 }
 
@@ -131,7 +129,6 @@ void GraphicsList::GetWin()
 {
   std::string wmic = getWmicPath();
   std::vector<std::map<std::string, std::string>> gpuList = runListMultiWmic("path win32_VideoController get AdapterCompatibility, AdapterRAM, PNPDeviceID, Name, VideoMemoryType", &wmic);
-  Graphics tempController;
   std::string tempVendor = "";
   std::string tempModel = "";
   std::string tempBus = "";
@@ -146,8 +143,7 @@ void GraphicsList::GetWin()
     tempVRAM = gpuList[i]["AdapterRAM"] == "" ? 0 : std::stoull(gpuList[i]["AdapterRAM"]);
     tempDynamic = gpuList[i]["VideoMemoryType"] == "2";
 
-    tempController = new Graphics(tempVendor, tempModel, tempBus, tempVRAM, tempDynamic);
-    controllers.push_back(tempController);
+    controllers.emplace_back(tempVendor, tempModel, tempBus, tempVRAM, tempDynamic);
   }
 }
 
@@ -158,7 +154,6 @@ void GraphicsList::GetLux()
 {
   std::string temp;
   std::vector<std::string> lines;
-  Graphics tempController;
   std::string tempVendor = "";
   std::string tempModel = "";
   std::string tempBus = "";
@@ -194,8 +189,7 @@ void GraphicsList::GetLux()
       }
       if (lines[++i][0] != '\t')
       {
-        tempController = Graphics(tempVendor, tempModel, tempBus, tempVRAM, tempDynamic);
-        controllers.push_back(tempController);
+        controllers.emplace_back(tempVendor, tempModel, tempBus, tempVRAM, tempDynamic);
         found = false;
         continue;
       }
@@ -206,38 +200,16 @@ void GraphicsList::GetLux()
 
 #pragma region "Operators"
 /**
-* @brief Reserves memory for a new GraphicsList object
+* @brief Moves another GraphicsList object into this one
 *
-* @param  size  The amount of memory to allocate
-* @return void* A pointer to the allocated memory
+* @param o The GraphicsList object to move from
 */
-void *GraphicsList::operator new(std::size_t size)
-{
-  void *o = ::new (GraphicsList);
-  return o;
-}
-
-/**
-* @brief Sets equal two GraphicsList objects
-*
-* @param o The GraphicsList object to copy from
-*/
-void GraphicsList::operator=(const GraphicsList &o)
+void GraphicsList::operator=(GraphicsList &&o)
 {
   if (&o == this)
   {
     return;
   }
-  controllers = o.controllers;
-}
-
-/**
-* @brief Sets equal two GraphicsList objects
-*
-* @param o The GraphicsList object to copy from
-*/
-void GraphicsList::operator=(GraphicsList *o)
-{
-  controllers = o->controllers;
+  controllers = std::move(o.controllers);
 }
 #pragma endregion "Operators"
@@ -27,10 +27,10 @@ private:
 public:
   GraphicsList();
   GraphicsList(std::uint8_t plt);
-  GraphicsList(const GraphicsList &o);
-  void *operator new(std::size_t size);
-  void operator=(const GraphicsList &o);
-  void operator=(GraphicsList *o);
+  GraphicsList(const GraphicsList &o) = delete;
+  GraphicsList(GraphicsList &&o);
+  void operator=(const GraphicsList &o) = delete;
+  void operator=(GraphicsList &&o);
   std::vector<Graphics> controllers;
 };
 
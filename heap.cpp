@@ -0,0 +1,117 @@
+/**
+*  @file      heap.cpp
+*  @brief     The counting replacements for the global operator new and delete.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "timings.h"
+
+/**
+* @brief Allocates memory, counting the allocation for --timings
+*
+* @param  size  The number of bytes to allocate
+* @return void* The allocated memory
+*/
+void *operator new(std::size_t size)
+{
+  void *ptr = std::malloc(size ? size : 1);
+  if (ptr == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  ++heapAllocations;
+  return ptr;
+}
+
+/**
+* @brief Allocates memory for an array, counting the allocation for --timings
+*
+* @param  size  The number of bytes to allocate
+* @return void* The allocated memory
+*/
+void *operator new[](std::size_t size)
+{
+  return operator new(size);
+}
+
+/**
+* @brief Allocates memory without throwing, counting the allocation for --timings
+*
+* @param  size  The number of bytes to allocate
+* @return void* The allocated memory, or nullptr
+*/
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+  void *ptr = std::malloc(size ? size : 1);
+  if (ptr != nullptr)
+  {
+    ++heapAllocations;
+  }
+  return ptr;
+}
+
+/**
+* @brief Allocates memory for an array without throwing, counting the allocation for --timings
+*
+* @param  size  The number of bytes to allocate
+* @return void* The allocated memory, or nullptr
+*/
+void *operator new[](std::size_t size, const std::nothrow_t &tag) noexcept
+{
+  return operator new(size, tag);
+}
+
+/**
+* @brief Frees memory allocated by operator new
+*
+* @param ptr The memory to free
+*/
+void operator delete(void *ptr) noexcept
+{
+  std::free(ptr);
+}
+
+/**
+* @brief Frees memory allocated by operator new
+*
+* @param ptr The memory to free
+*/
+void operator delete(void *ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+/**
+* @brief Frees memory allocated by the nothrow operator new
+*
+* @param ptr The memory to free
+*/
+void operator delete(void *ptr, const std::nothrow_t &) noexcept
+{
+  std::free(ptr);
+}
+
+/**
+* @brief Frees memory allocated by operator new[]
+*
+* @param ptr The memory to free
+*/
+void operator delete[](void *ptr) noexcept
+{
+  std::free(ptr);
+}
+
+/**
+* @brief Frees memory allocated by operator new[]
+*
+* @param ptr The memory to free
+*/
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
@@ -0,0 +1,883 @@
+/**
+*  @file      history.cpp
+*  @brief     The implementation for the History class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "history.h"
+#include "os.h"
+#include "utils.h"
+
+#if CGOGGLES_OS != OS_WIN
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+* @brief The magic at the start of a history file
+*/
+static const char historyMagic[8] = {'C', 'G', 'H', 'I', 'S', 'T', '1', '\0'};
+
+/**
+* @brief The magic at the start of every block ("CBLK")
+*/
+const std::uint32_t blockMagic = 0x4B4C4243;
+
+/**
+* @brief The magic marking the unused end of a ring, before it wraps ("CPAD")
+*/
+const std::uint32_t padMagic = 0x44415043;
+
+/**
+* @brief The bytes reserved for the header, before the series names
+*/
+const std::uint64_t headerBytes = 4096;
+
+/**
+* @brief The most points held for a series at one resolution before they are written as a block
+*/
+const std::size_t blockPoints = 64;
+
+/**
+* @brief Rounds a size up to the next multiple of eight bytes
+*
+* @param  n           The size to round
+* @return std::size_t The rounded size
+*/
+static std::size_t align8(const std::size_t &n)
+{
+  return (n + 7) & ~static_cast<std::size_t>(7);
+}
+
+/**
+* @brief Computes the FNV-1a checksum of a block's payload
+*
+* @param  data          The payload
+* @param  len           The length of the payload
+* @return std::uint32_t The checksum
+*/
+static std::uint32_t checksum(const std::uint8_t *data, const std::size_t &len)
+{
+  std::uint32_t hash = 2166136261u;
+  for (std::size_t i = 0; i < len; ++i)
+  {
+    hash = (hash ^ data[i]) * 16777619u;
+  }
+  return hash;
+}
+
+/**
+* @brief Writes a signed number as a zigzag varint
+*
+* @param out The bytes to append to
+* @param n   The number to write
+*/
+static void putVarint(std::vector<std::uint8_t> *out, const std::int64_t &n)
+{
+  std::uint64_t u = (static_cast<std::uint64_t>(n) << 1) ^ static_cast<std::uint64_t>(n >> 63);
+  while (u >= 0x80)
+  {
+    out->push_back(static_cast<std::uint8_t>(u | 0x80));
+    u >>= 7;
+  }
+  out->push_back(static_cast<std::uint8_t>(u));
+}
+
+/**
+* @brief Reads a signed number written as a zigzag varint
+*
+* @param  pos          The position to read from, moved past the number
+* @param  end          The end of the bytes
+* @param  n            The number read
+* @return true         The number was read
+* @return false        The bytes ran out
+*/
+static bool getVarint(const std::uint8_t **pos, const std::uint8_t *end, std::int64_t *n)
+{
+  std::uint64_t u = 0;
+  for (std::size_t shift = 0; *pos < end && shift < 64; shift += 7)
+  {
+    std::uint8_t b = *(*pos)++;
+    u |= static_cast<std::uint64_t>(b & 0x7F) << shift;
+    if (b < 0x80)
+    {
+      *n = static_cast<std::int64_t>(u >> 1) ^ -static_cast<std::int64_t>(u & 1);
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+* @brief Writes a column of values with Gorilla's XOR encoding, padded to a whole byte
+*
+* @param out  The bytes to append to
+* @param vals The values to write
+*/
+static void putGorilla(std::vector<std::uint8_t> *out, const std::vector<double> &vals)
+{
+  std::uint64_t acc = 0;
+  std::size_t bits = 0;
+  std::uint64_t prev = 0;
+  std::uint64_t cur;
+  std::uint64_t x;
+  int lead = -1;
+  int trail = 0;
+  int l;
+  int t;
+  auto put = [&](const std::uint64_t &v, const std::size_t &n) {
+    for (std::size_t i = n; i > 0; --i)
+    {
+      acc = (acc << 1) | ((v >> (i - 1)) & 1);
+      if (++bits == 8)
+      {
+        out->push_back(static_cast<std::uint8_t>(acc));
+        acc = 0;
+        bits = 0;
+      }
+    }
+  };
+
+  for (std::size_t i = 0; i < vals.size(); ++i)
+  {
+    std::memcpy(&cur, &vals[i], sizeof(cur));
+    if (i == 0)
+    {
+      put(cur, 64);
+      prev = cur;
+      continue;
+    }
+    x = cur ^ prev;
+    prev = cur;
+    if (x == 0)
+    {
+      put(0, 1);
+      continue;
+    }
+    l = std::min(__builtin_clzll(x), 31);
+    t = __builtin_ctzll(x);
+    if (lead >= 0 && l >= lead && t >= trail)
+    {
+      put(0b10, 2);
+      put(x >> trail, 64 - lead - trail);
+      continue;
+    }
+    lead = l;
+    trail = t;
+    put(0b11, 2);
+    put(lead, 5);
+    put(64 - lead - trail - 1, 6);
+    put(x >> trail, 64 - lead - trail);
+  }
+  if (bits > 0)
+  {
+    put(0, 8 - bits);
+  }
+}
+
+/**
+* @brief Reads a column of values written with Gorilla's XOR encoding
+*
+* @param  pos   The position to read from, moved past the whole bytes of the column
+* @param  end   The end of the bytes
+* @param  count The number of values to read
+* @param  vals  The values read
+* @return true  The column was read
+* @return false The bytes ran out
+*/
+static bool getGorilla(const std::uint8_t **pos, const std::uint8_t *end, const std::size_t &count, std::vector<double> *vals)
+{
+  std::size_t bit = 0;
+  std::uint64_t prev = 0;
+  std::uint64_t x;
+  double val;
+  int lead = 0;
+  int len = 0;
+  bool good = true;
+  auto get = [&](const std::size_t &n) {
+    std::uint64_t v = 0;
+    for (std::size_t i = 0; i < n; ++i, ++bit)
+    {
+      if (*pos + bit / 8 >= end)
+      {
+        good = false;
+        return v;
+      }
+      v = (v << 1) | (((*pos)[bit / 8] >> (7 - bit % 8)) & 1);
+    }
+    return v;
+  };
+
+  vals->clear();
+  for (std::size_t i = 0; i < count && good; ++i)
+  {
+    if (i == 0)
+    {
+      prev = get(64);
+    }
+    else if (get(1) == 1)
+    {
+      if (get(1) == 1)
+      {
+        lead = static_cast<int>(get(5));
+        len = static_cast<int>(get(6)) + 1;
+      }
+      x = get(len) << (64 - lead - len);
+      prev ^= x;
+    }
+    std::memcpy(&val, &prev, sizeof(val));
+    vals->push_back(val);
+  }
+  *pos += (bit + 7) / 8;
+  return good;
+}
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new, closed History object
+*/
+History::History()
+{
+  fd = -1;
+  map = nullptr;
+  size = 0;
+  writable = false;
+  ids = std::unordered_map<std::string, std::uint32_t>();
+  buffers = std::vector<std::array<HistoryBuffer, historyLevels>>();
+  payload = std::vector<std::uint8_t>();
+  key = "";
+  dropped = std::set<std::string>();
+  warned = 0;
+}
+
+/**
+* @brief Construct a new History object, mapping the file and creating it if it is written to
+*
+* @param path  The path of the history file
+* @param write Whether samples are appended to the file, or it is only queried
+*/
+History::History(const std::string &path, const bool &write)
+{
+  fd = -1;
+  map = nullptr;
+  size = 0;
+  writable = write;
+  ids = std::unordered_map<std::string, std::uint32_t>();
+  buffers = std::vector<std::array<HistoryBuffer, historyLevels>>();
+  payload = std::vector<std::uint8_t>();
+  key = "";
+  dropped = std::set<std::string>();
+  warned = 0;
+#if CGOGGLES_OS != OS_WIN
+  struct stat st;
+  bool fresh = false;
+  const char *name;
+
+  fd = open(path.c_str(), write ? O_RDWR | O_CREAT | O_CLOEXEC : O_RDONLY | O_CLOEXEC, 0644);
+  if (fd < 0 || fstat(fd, &st) != 0)
+  {
+    Close();
+    return;
+  }
+  size = static_cast<std::uint64_t>(st.st_size);
+  if (size == 0 && write)
+  {
+    if (ftruncate(fd, historySize) != 0)
+    {
+      Close();
+      return;
+    }
+    size = historySize;
+    fresh = true;
+  }
+  if (size < headerBytes + historySeries * historyNameLen + headerBytes)
+  {
+    Close();
+    return;
+  }
+  void *mem = mmap(nullptr, size, write ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+  if (mem == MAP_FAILED)
+  {
+    Close();
+    return;
+  }
+  map = static_cast<std::uint8_t *>(mem);
+  if (fresh)
+  {
+    Layout();
+  }
+  if (std::memcmp(Header()->magic, historyMagic, sizeof(historyMagic)) != 0 || Header()->size != size ||
+      Header()->seriesCap != historySeries || Header()->seriesCount > historySeries)
+  {
+    Close();
+    return;
+  }
+
+  for (std::uint32_t i = 0; i < Header()->seriesCount; ++i)
+  {
+    name = reinterpret_cast<const char *>(map + headerBytes + i * historyNameLen);
+    ids.emplace(std::string(name, strnlen(name, historyNameLen - 1)), i);
+  }
+  buffers.resize(Header()->seriesCount);
+#endif
+}
+
+/**
+* @brief Construct a new History object from another History object
+*
+* @param o The History object to move from
+*/
+History::History(History &&o)
+{
+  fd = o.fd;
+  map = o.map;
+  size = o.size;
+  writable = o.writable;
+  ids = std::move(o.ids);
+  buffers = std::move(o.buffers);
+  payload = std::move(o.payload);
+  key = std::move(o.key);
+  dropped = std::move(o.dropped);
+  warned = o.warned;
+  o.fd = -1;
+  o.map = nullptr;
+  o.size = 0;
+}
+
+/**
+* @brief Destroy the History object, writing any held points and unmapping the file
+*/
+History::~History()
+{
+  Flush();
+  Close();
+}
+#pragma endregion "Constructors"
+
+#pragma region "Constructors' Assistants"
+/**
+* @brief Gets the header at the start of the mapped file
+*
+* @return HistoryHeader* The header
+*/
+HistoryHeader *History::Header()
+{
+  return reinterpret_cast<HistoryHeader *>(map);
+}
+
+/**
+* @brief Lays out a new file, splitting the space after the names between the resolutions
+*/
+void History::Layout()
+{
+  HistoryHeader *h = Header();
+  std::uint64_t start = headerBytes + historySeries * historyNameLen;
+  std::uint64_t data = size - start;
+  const std::uint64_t share[historyLevels] = {4, 2, 1, 1};
+
+  std::memset(h, 0, sizeof(HistoryHeader));
+  h->size = size;
+  h->seriesCap = historySeries;
+  for (std::size_t i = 0; i < historyLevels; ++i)
+  {
+    h->offset[i] = start;
+    h->length[i] = data * share[i] / 8 & ~static_cast<std::uint64_t>(7);
+    start += h->length[i];
+  }
+  std::atomic_thread_fence(std::memory_order_release);
+  std::memcpy(h->magic, historyMagic, sizeof(historyMagic));
+}
+
+/**
+* @brief Holds a point of a series at one resolution, writing a block when enough are held
+*
+* @param series The series of the point
+* @param level  The resolution of the point
+* @param ts     The time of the point, in milliseconds since the epoch
+* @param v0     The value, or the minimum of a rollup
+* @param v1     The maximum of a rollup
+* @param v2     The average of a rollup
+*/
+void History::Push(const std::uint32_t &series, const std::size_t &level, const std::int64_t &ts, const double &v0, const double &v1, const double &v2)
+{
+  HistoryBuffer &buf = buffers[series][level];
+  buf.times.push_back(ts);
+  buf.cols[0].push_back(v0);
+  if (level > 0)
+  {
+    buf.cols[1].push_back(v1);
+    buf.cols[2].push_back(v2);
+  }
+  if (buf.times.size() >= blockPoints || ts - buf.times.front() >= flushAge[level])
+  {
+    Write(series, level);
+  }
+}
+
+/**
+* @brief Compresses the held points of a series at one resolution into a block, and appends it to the ring
+*
+* The ring's tail is moved past any blocks which are about to be overwritten
+* before the block is written, and its head is only moved past the block once
+* it is whole, so a reader or a crash never sees half a block.
+*
+* @param series The series to write
+* @param level  The resolution to write
+*/
+void History::Write(const std::uint32_t &series, const std::size_t &level)
+{
+  HistoryBuffer &buf = buffers[series][level];
+  HistoryHeader *h = Header();
+  HistoryBlock block;
+  std::uint8_t *base = map + h->offset[level];
+  std::uint64_t len = h->length[level];
+  std::uint64_t head = h->head[level];
+  std::uint64_t tail = h->tail[level];
+  std::uint64_t phys;
+  std::uint64_t pad;
+  std::uint64_t total;
+  std::int64_t prevTs;
+  std::int64_t prevDelta = 0;
+  const HistoryBlock *old;
+
+  if (buf.times.empty())
+  {
+    return;
+  }
+  payload.clear();
+  prevTs = buf.times[0];
+  for (std::size_t i = 1; i < buf.times.size(); ++i)
+  {
+    putVarint(&payload, buf.times[i] - prevTs - prevDelta);
+    prevDelta = buf.times[i] - prevTs;
+    prevTs = buf.times[i];
+  }
+  for (std::size_t c = 0; c < (level > 0 ? 3 : 1); ++c)
+  {
+    putGorilla(&payload, buf.cols[c]);
+  }
+
+  std::memset(&block, 0, sizeof(block));
+  block.bytes = static_cast<std::uint32_t>(align8(sizeof(HistoryBlock) + payload.size()));
+  block.series = series;
+  block.level = static_cast<std::uint16_t>(level);
+  block.count = static_cast<std::uint16_t>(buf.times.size());
+  block.first = buf.times.front();
+  block.last = buf.times.back();
+  block.min = *std::min_element(buf.cols[0].begin(), buf.cols[0].end());
+  block.max = level > 0 ? *std::max_element(buf.cols[1].begin(), buf.cols[1].end()) : *std::max_element(buf.cols[0].begin(), buf.cols[0].end());
+  block.check = checksum(payload.data(), payload.size());
+  block.payload = static_cast<std::uint32_t>(payload.size());
+  buf.times.clear();
+  for (std::size_t c = 0; c < buf.cols.size(); ++c)
+  {
+    buf.cols[c].clear();
+  }
+
+  total = block.bytes;
+  if (total > len / 4)
+  {
+    return;
+  }
+  phys = head % len;
+  pad = phys + total > len ? len - phys : 0;
+  while (head + pad + total - tail > len)
+  {
+    old = reinterpret_cast<const HistoryBlock *>(base + tail % len);
+    if (len - tail % len < sizeof(HistoryBlock) || old->magic != blockMagic || old->bytes == 0)
+    {
+      tail += len - tail % len;
+      continue;
+    }
+    tail += old->bytes;
+  }
+  h->tail[level] = tail;
+  std::atomic_thread_fence(std::memory_order_release);
+
+  if (pad > 0)
+  {
+    if (pad >= sizeof(padMagic))
+    {
+      std::memcpy(base + phys, &padMagic, sizeof(padMagic));
+    }
+    head += pad;
+    phys = 0;
+  }
+  std::memcpy(base + phys + sizeof(HistoryBlock), payload.data(), payload.size());
+  block.magic = 0;
+  std::memcpy(base + phys, &block, sizeof(block));
+  std::atomic_thread_fence(std::memory_order_release);
+  reinterpret_cast<HistoryBlock *>(base + phys)->magic = blockMagic;
+  std::atomic_thread_fence(std::memory_order_release);
+  h->head[level] = head + total;
+}
+
+/**
+* @brief Unmaps and closes the file
+*/
+void History::Close()
+{
+#if CGOGGLES_OS != OS_WIN
+  if (map != nullptr)
+  {
+    munmap(map, size);
+    map = nullptr;
+  }
+  if (fd >= 0)
+  {
+    close(fd);
+    fd = -1;
+  }
+#endif
+}
+#pragma endregion "Constructors' Assistants"
+
+#pragma region "Operators"
+/**
+* @brief Moves the file of another History object into this one
+*
+* @param o The History object to move from
+*/
+void History::operator=(History &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  Flush();
+  Close();
+  fd = o.fd;
+  map = o.map;
+  size = o.size;
+  writable = o.writable;
+  ids = std::move(o.ids);
+  buffers = std::move(o.buffers);
+  payload = std::move(o.payload);
+  key = std::move(o.key);
+  dropped = std::move(o.dropped);
+  warned = o.warned;
+  o.fd = -1;
+  o.map = nullptr;
+  o.size = 0;
+}
+#pragma endregion "Operators"
+
+#pragma region "Methods"
+/**
+* @brief Checks whether the file is mapped
+*
+* @return true  The file is mapped and valid
+* @return false The file could NOT be opened, created or mapped
+*/
+bool History::Good()
+{
+  return map != nullptr;
+}
+
+/**
+* @brief Appends a sample to a series, naming the series if it is new, and rolls it up into each resolution
+*
+* @param name The name of the series, the key it was requested by
+* @param ts   The time of the sample, in milliseconds since the epoch
+* @param val  The value of the sample
+*/
+void History::Append(const char *name, const std::int64_t &ts, const double &val)
+{
+  std::unordered_map<std::string, std::uint32_t>::iterator found;
+  std::uint32_t series;
+  std::int64_t bucket;
+  HistoryHeader *h = Header();
+
+  if (map == nullptr || !writable)
+  {
+    return;
+  }
+  key.assign(name);
+  found = ids.find(key);
+  if (found == ids.end())
+  {
+    if (h->seriesCount >= h->seriesCap || key.size() >= historyNameLen)
+    {
+      // Warn once for each reason, then only count, since the same keys are refused every sample
+      std::uint32_t reason = key.size() >= historyNameLen ? 1 : 2;
+      if ((warned & reason) == 0)
+      {
+        std::cerr << "cgoggles: history cannot record " << key
+                  << (reason == 1 ? ", its name is too long" : ", the file already holds " + std::to_string(h->seriesCap) + " series")
+                  << "; history.Dropped counts the series left out" << std::endl;
+        warned |= reason;
+      }
+      dropped.insert(key);
+      return;
+    }
+    series = h->seriesCount;
+    std::memset(map + headerBytes + series * historyNameLen, 0, historyNameLen);
+    std::memcpy(map + headerBytes + series * historyNameLen, key.data(), key.size());
+    std::atomic_thread_fence(std::memory_order_release);
+    h->seriesCount = series + 1;
+    found = ids.emplace(key, series).first;
+    buffers.resize(series + 1);
+  }
+  series = found->second;
+
+  Push(series, 0, ts, val, 0, 0);
+  for (std::size_t level = 1; level < historyLevels; ++level)
+  {
+    HistoryBuffer &buf = buffers[series][level];
+    bucket = ts - ts % historyWidths[level];
+    if (buf.count > 0 && bucket != buf.bucket)
+    {
+      Push(series, level, buf.bucket, buf.min, buf.max, buf.sum / buf.count);
+      buf.count = 0;
+    }
+    if (buf.count == 0)
+    {
+      buf.bucket = bucket;
+      buf.min = val;
+      buf.max = val;
+      buf.sum = 0;
+    }
+    buf.min = std::min(buf.min, val);
+    buf.max = std::max(buf.max, val);
+    buf.sum += val;
+    ++buf.count;
+  }
+}
+
+/**
+* @brief Counts the series which could NOT be recorded, the file being full or their names too long
+*
+* @return std::size_t The number of series left out
+*/
+std::size_t History::Dropped()
+{
+  return dropped.size();
+}
+
+/**
+* @brief Writes every held point, including the unfinished rollups, to the file
+*/
+void History::Flush()
+{
+  if (map == nullptr || !writable)
+  {
+    return;
+  }
+  for (std::uint32_t series = 0; series < buffers.size(); ++series)
+  {
+    for (std::size_t level = 1; level < historyLevels; ++level)
+    {
+      HistoryBuffer &buf = buffers[series][level];
+      if (buf.count > 0)
+      {
+        buf.times.push_back(buf.bucket);
+        buf.cols[0].push_back(buf.min);
+        buf.cols[1].push_back(buf.max);
+        buf.cols[2].push_back(buf.sum / buf.count);
+        buf.count = 0;
+      }
+    }
+  }
+  Sync();
+}
+
+/**
+* @brief Writes every held point to the file, leaving the unfinished rollups to fill
+*
+* A rollup is only written once its bucket ends, so calling this while
+* recording never writes a bucket twice.
+*/
+void History::Sync()
+{
+  if (map == nullptr || !writable)
+  {
+    return;
+  }
+  for (std::uint32_t series = 0; series < buffers.size(); ++series)
+  {
+    for (std::size_t level = 0; level < historyLevels; ++level)
+    {
+      Write(series, level);
+    }
+  }
+#if CGOGGLES_OS != OS_WIN
+  msync(map, size, MS_ASYNC);
+#endif
+}
+
+/**
+* @brief Summarizes a series over a window of time, from the finest resolution which still covers it
+*
+* Only the blocks of the series which overlap the window are checked and
+* decompressed; every other block is skipped by its header.
+*
+* @param  name  The name of the series, in any case
+* @param  from  The start of the window, in milliseconds since the epoch
+* @param  to    The end of the window, in milliseconds since the epoch
+* @param  stats The summary of the window
+* @return true  The series had points in the window
+* @return false The series is unknown, or had no points in the window
+*/
+bool History::Query(const std::string &name, const std::int64_t &from, const std::int64_t &to, HistoryStats *stats)
+{
+  HistoryHeader *h = Header();
+  std::unordered_map<std::string, std::uint32_t>::iterator found;
+  std::array<std::int64_t, historyLevels> oldest;
+  std::vector<std::size_t> order;
+  std::vector<std::size_t> partial;
+  std::vector<double> cols[3];
+  std::vector<double> vals;
+  std::int64_t ts;
+  std::int64_t delta;
+  const HistoryBlock *block;
+  const std::uint8_t *pos;
+  const std::uint8_t *end;
+  std::uint64_t head;
+  std::uint64_t tail;
+  std::uint64_t len;
+  std::uint32_t series = 0;
+  bool known = false;
+
+  if (map == nullptr)
+  {
+    return false;
+  }
+  for (found = ids.begin(); found != ids.end() && !known; ++found)
+  {
+    known = toUpper(found->first) == toUpper(name);
+    series = found->second;
+    stats->name = found->first;
+  }
+  if (!known)
+  {
+    return false;
+  }
+
+  for (std::size_t level = 0; level < historyLevels; ++level)
+  {
+    oldest[level] = INT64_MAX;
+    len = h->length[level];
+    tail = h->tail[level];
+    head = h->head[level];
+    while (tail < head)
+    {
+      block = reinterpret_cast<const HistoryBlock *>(map + h->offset[level] + tail % len);
+      if (len - tail % len >= sizeof(HistoryBlock) && block->magic == blockMagic)
+      {
+        oldest[level] = block->first;
+        break;
+      }
+      tail += len - tail % len;
+    }
+  }
+  for (std::size_t level = 0; level < historyLevels; ++level)
+  {
+    if (oldest[level] <= from)
+    {
+      order.push_back(level);
+    }
+    else if (oldest[level] != INT64_MAX)
+    {
+      partial.push_back(level);
+    }
+  }
+  std::stable_sort(partial.begin(), partial.end(), [&](const std::size_t &a, const std::size_t &b) {
+    return oldest[a] + historyWidths[a] < oldest[b] + historyWidths[b];
+  });
+  order.insert(order.end(), partial.begin(), partial.end());
+
+  for (std::size_t o = 0; o < order.size(); ++o)
+  {
+    std::size_t level = order[o];
+    len = h->length[level];
+    std::atomic_thread_fence(std::memory_order_acquire);
+    tail = h->tail[level];
+    head = h->head[level];
+    vals.clear();
+    stats->level = level;
+    stats->count = 0;
+    stats->min = INFINITY;
+    stats->max = -INFINITY;
+    stats->avg = 0;
+
+    while (tail < head)
+    {
+      block = reinterpret_cast<const HistoryBlock *>(map + h->offset[level] + tail % len);
+      if (len - tail % len < sizeof(HistoryBlock) || block->magic != blockMagic || block->bytes == 0)
+      {
+        tail += len - tail % len;
+        continue;
+      }
+      tail += block->bytes;
+      if (block->series != series || block->last < from || block->first > to ||
+          sizeof(HistoryBlock) + block->payload > block->bytes || block->bytes > len - (tail - block->bytes) % len)
+      {
+        continue;
+      }
+      pos = reinterpret_cast<const std::uint8_t *>(block + 1);
+      end = pos + block->payload;
+      if (checksum(pos, block->payload) != block->check)
+      {
+        continue;
+      }
+
+      std::vector<std::int64_t> times(1, block->first);
+      delta = 0;
+      for (std::size_t i = 1; i < block->count && getVarint(&pos, end, &ts); ++i)
+      {
+        delta += ts;
+        times.push_back(times.back() + delta);
+      }
+      bool good = times.size() == block->count;
+      for (std::size_t c = 0; c < (level > 0 ? 3 : 1) && good; ++c)
+      {
+        good = getGorilla(&pos, end, block->count, &cols[c]);
+      }
+      if (!good)
+      {
+        continue;
+      }
+
+      for (std::size_t i = 0; i < times.size(); ++i)
+      {
+        if (times[i] < from || times[i] > to)
+        {
+          continue;
+        }
+        double val = level > 0 ? cols[2][i] : cols[0][i];
+        if (stats->count == 0)
+        {
+          stats->first = times[i];
+          stats->firstVal = val;
+        }
+        stats->last = times[i];
+        stats->lastVal = val;
+        stats->min = std::min(stats->min, cols[0][i]);
+        stats->max = std::max(stats->max, level > 0 ? cols[1][i] : cols[0][i]);
+        stats->avg += val;
+        ++stats->count;
+        vals.push_back(val);
+      }
+    }
+
+    if (stats->count == 0)
+    {
+      continue;
+    }
+    stats->avg /= stats->count;
+    std::sort(vals.begin(), vals.end());
+    stats->p50 = vals[(vals.size() - 1) * 50 / 100];
+    stats->p90 = vals[(vals.size() - 1) * 90 / 100];
+    stats->p99 = vals[(vals.size() - 1) * 99 / 100];
+    return true;
+  }
+  return false;
+}
+#pragma endregion "Methods"
@@ -0,0 +1,160 @@
+/**
+*  @file      history.h
+*  @brief     The interface for the History class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_HISTORY_H_
+#define CGOGGLES_HISTORY_H_
+
+#include "pch.h"
+
+/**
+* @brief The number of resolutions kept: raw samples, then 1s, 1m and 1h rollups
+*/
+const std::size_t historyLevels = 4;
+
+/**
+* @brief The names of each resolution
+*/
+const std::array<std::string, historyLevels> historyNames = {"raw", "1s", "1m", "1h"};
+
+/**
+* @brief The width of each resolution's buckets, in milliseconds
+*/
+const std::array<std::int64_t, historyLevels> historyWidths = {0, 1000, 60000, 3600000};
+
+/**
+* @brief The longest a point may be held at each resolution before its block is written, in milliseconds
+*/
+const std::array<std::int64_t, historyLevels> flushAge = {60000, 600000, 600000, 600000};
+
+/**
+* @brief The size of a newly created history file (16 MiB)
+*/
+const std::uint64_t historySize = 16ull << 20;
+
+/**
+* @brief The most series a history file can name
+*/
+const std::uint32_t historySeries = 1024;
+
+/**
+* @brief The longest series name a history file can hold, including its terminator
+*/
+const std::size_t historyNameLen = 64;
+
+/**
+* @brief Represents the fixed header at the start of a history file
+*/
+class HistoryHeader
+{
+public:
+  char magic[8];
+  std::uint64_t size;
+  std::uint32_t seriesCap;
+  std::uint32_t seriesCount;
+  std::uint64_t offset[historyLevels];
+  std::uint64_t length[historyLevels];
+  std::uint64_t head[historyLevels];
+  std::uint64_t tail[historyLevels];
+};
+
+/**
+* @brief Represents the header of a single compressed block of one series at one resolution
+*/
+class HistoryBlock
+{
+public:
+  std::uint32_t magic;
+  std::uint32_t bytes;
+  std::uint32_t series;
+  std::uint16_t level;
+  std::uint16_t count;
+  std::int64_t first;
+  std::int64_t last;
+  double min;
+  double max;
+  std::uint32_t check;
+  std::uint32_t payload;
+};
+
+/**
+* @brief Represents the points of one series at one resolution which are not yet written
+*/
+class HistoryBuffer
+{
+public:
+  std::vector<std::int64_t> times;
+  std::array<std::vector<double>, 3> cols;
+  std::int64_t bucket;
+  double min;
+  double max;
+  double sum;
+  std::uint32_t count;
+};
+
+/**
+* @brief Represents the summary of a series over a window of time
+*/
+class HistoryStats
+{
+public:
+  std::string name;
+  std::size_t level;
+  std::uint64_t count;
+  std::int64_t first;
+  std::int64_t last;
+  double min;
+  double max;
+  double avg;
+  double p50;
+  double p90;
+  double p99;
+  double firstVal;
+  double lastVal;
+};
+
+/**
+* @brief Represents a fixed-size, memory-mapped ring buffer of numeric samples and their rollups
+*/
+class History
+{
+private:
+  int fd;
+  std::uint8_t *map;
+  std::uint64_t size;
+  bool writable;
+  std::unordered_map<std::string, std::uint32_t> ids;
+  std::vector<std::array<HistoryBuffer, historyLevels>> buffers;
+  std::vector<std::uint8_t> payload;
+  std::string key;
+  std::set<std::string> dropped;
+  std::uint32_t warned;
+  HistoryHeader *Header();
+  void Layout();
+  void Push(const std::uint32_t &series, const std::size_t &level, const std::int64_t &ts, const double &v0, const double &v1, const double &v2);
+  void Write(const std::uint32_t &series, const std::size_t &level);
+  void Close();
+
+public:
+  History();
+  History(const std::string &path, const bool &write);
+  History(const History &o) = delete;
+  History(History &&o);
+  void operator=(const History &o) = delete;
+  void operator=(History &&o);
+  ~History();
+  bool Good();
+  void Append(const char *name, const std::int64_t &ts, const double &val);
+  std::size_t Dropped();
+  void Flush();
+  void Sync();
+  bool Query(const std::string &name, const std::int64_t &from, const std::int64_t &to, HistoryStats *stats);
+};
+
+#endif // CGOGGLES_HISTORY_H_
@@ -0,0 +1,390 @@
+/**
+*  @file      interruptstats.cpp
+*  @brief     The implementation for the InterruptStats class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "interruptstats.h"
+#include "os.h"
+#include "utils.h"
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new, unsampled InterruptStats object
+*/
+InterruptStats::InterruptStats()
+{
+  top = 0;
+  every = false;
+  prevTime = curTime = 0;
+  samples = 0;
+  irqs = InterruptTable();
+  soft = InterruptTable();
+  device = std::vector<double>();
+  system = std::vector<double>();
+  softirq = std::vector<double>();
+  hot = std::vector<bool>();
+  ranked = std::vector<std::size_t>();
+  affinity = std::vector<std::string>();
+  effective = std::vector<std::string>();
+}
+
+/**
+* @brief Construct a new InterruptStats object with help from the assistants
+*
+* @param plt The platform of the system
+* @param n   The number of IRQs to rank
+* @param all Whether or not to read the affinity of every IRQ, rather than just those ranked
+*/
+InterruptStats::InterruptStats(std::uint8_t plt, const std::size_t &n, const bool &all) : InterruptStats()
+{
+  top = n;
+  every = all;
+  switch (plt)
+  {
+  case OS_WIN:
+    GetWin();
+    break;
+  case OS_MAC:
+    GetMac();
+    break;
+  case OS_LUX:
+    GetLux();
+    break;
+  }
+}
+
+/**
+* @brief Construct a new InterruptStats object from another InterruptStats object
+*
+* @param o The InterruptStats object to move from
+*/
+InterruptStats::InterruptStats(InterruptStats &&o)
+{
+  interrupts = std::move(o.interrupts);
+  softirqs = std::move(o.softirqs);
+  top = o.top;
+  every = o.every;
+  prevTime = o.prevTime;
+  curTime = o.curTime;
+  samples = o.samples;
+  irqs = std::move(o.irqs);
+  soft = std::move(o.soft);
+  device = std::move(o.device);
+  system = std::move(o.system);
+  softirq = std::move(o.softirq);
+  hot = std::move(o.hot);
+  ranked = std::move(o.ranked);
+  affinity = std::move(o.affinity);
+  effective = std::move(o.effective);
+}
+#pragma endregion "Constructors"
+
+#pragma region "Constructors' Assistants"
+/**
+* @brief Fills in the interrupt sources for Darwin systems, which has none
+*/
+void InterruptStats::GetMac() {}
+
+/**
+* @brief Fills in the interrupt sources for Windows systems, which has none
+*/
+void InterruptStats::GetWin() {}
+
+/**
+* @brief Fills in the interrupt sources for Linux systems
+*/
+void InterruptStats::GetLux()
+{
+  interrupts = SourceFile("/proc/interrupts");
+  softirqs = SourceFile("/proc/softirqs");
+}
+
+/**
+* @brief Reads a table of counters per CPU in a single pass, allocating only when its rows or CPUs change
+*
+* @param  file  The file to read
+* @param  table The table to read into
+* @return true  The rows or CPUs changed, so the samples can't be compared
+* @return false The table has the same layout as the last read
+*/
+bool InterruptStats::ReadTable(SourceFile *file, InterruptTable *table)
+{
+  const char *word;
+  std::size_t len;
+  std::size_t start;
+  std::size_t n = 0;
+  std::size_t row = 0;
+  std::uint32_t id;
+  bool changed = false;
+
+  std::swap(table->prev, table->cur);
+  table->cur.clear();
+  if (!file->Read())
+  {
+    changed = !table->labels.empty();
+    table->cpus.clear();
+    table->labels.clear();
+    table->devices.clear();
+    return changed;
+  }
+  Scanner scan(file->Data(), file->Size());
+
+  // The header names each online CPU, like "CPU0 CPU1 CPU4", so offline CPUs leave gaps
+  for (scan.SkipSpaces(); scan.Match("CPU"); scan.SkipSpaces())
+  {
+    id = scan.Number();
+    changed = changed || n >= table->cpus.size() || table->cpus[n] != id;
+    if (n >= table->cpus.size())
+    {
+      table->cpus.push_back(id);
+    }
+    table->cpus[n++] = id;
+  }
+  changed = changed || n != table->cpus.size();
+  table->cpus.resize(n);
+  scan.SkipLine();
+
+  // Each row is like " 43:  12585  0  PCI-MSIX-0000:00:05.0   1-edge      virtio4-rx", or "LOC:  1862188  Local timer interrupts"
+  for (; !scan.Done(); ++row)
+  {
+    len = scan.Until(':', &word);
+    if (row >= table->labels.size())
+    {
+      table->labels.emplace_back();
+      table->devices.emplace_back();
+    }
+    if (table->labels[row].compare(0, std::string::npos, word, len) != 0)
+    {
+      table->labels[row].assign(word, len);
+      changed = true;
+    }
+    table->cur.resize(table->cur.size() + n);
+    for (std::size_t c = 0; c < n; ++c)
+    {
+      table->cur[row * n + c] = scan.Number();
+    }
+
+    // The devices follow the chip and the trigger after two or more spaces, and reading them moves on to the next row
+    len = scan.Until('\n', &word);
+    while (len > 0 && word[len - 1] == ' ')
+    {
+      --len;
+    }
+    start = len;
+    while (start >= 2 && !(word[start - 1] == ' ' && word[start - 2] == ' '))
+    {
+      --start;
+    }
+    start = start < 2 ? 0 : start;
+    if (table->devices[row].compare(0, std::string::npos, word + start, len - start) != 0)
+    {
+      table->devices[row].assign(word + start, len - start);
+    }
+  }
+  changed = changed || row != table->labels.size();
+  table->labels.resize(row);
+  table->devices.resize(row);
+  return changed;
+}
+
+/**
+* @brief Computes the rate of each row of a table, how unevenly it is spread across the CPUs, and the CPU taking most of it
+*
+* @param table   The table to compute the rates of
+* @param seconds The seconds between the samples, or 0 if they can't be compared
+*/
+void InterruptStats::RateTable(InterruptTable *table, const double &seconds)
+{
+  std::size_t n = table->cpus.size();
+  std::uint64_t delta;
+  std::uint64_t sum;
+  std::uint64_t most;
+
+  table->rates.assign(table->labels.size(), 0);
+  table->skews.assign(table->labels.size(), 0);
+  table->busiest.assign(table->labels.size(), 0);
+  for (std::size_t r = 0; r < table->labels.size() && seconds > 0 && n > 0; ++r)
+  {
+    sum = most = 0;
+    for (std::size_t c = 0; c < n; ++c)
+    {
+      // A counter only goes backwards if it wrapped, so that CPU is left out of this sample
+      delta = table->cur[r * n + c] >= table->prev[r * n + c] ? table->cur[r * n + c] - table->prev[r * n + c] : 0;
+      sum += delta;
+      if (delta > most)
+      {
+        most = delta;
+        table->busiest[r] = table->cpus[c];
+      }
+    }
+    table->rates[r] = sum / seconds;
+    table->skews[r] = sum > 0 ? static_cast<double>(most) * n / sum : 0;
+  }
+}
+
+/**
+* @brief Takes a sample of /proc/interrupts and /proc/softirqs, then ranks the IRQs and reads where the busiest may go
+*/
+void InterruptStats::SampleLux()
+{
+  std::size_t n;
+  double seconds;
+  double mean = 0;
+  std::string text;
+
+  prevTime = curTime;
+  curTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  bool changed = ReadTable(&interrupts, &irqs);
+  changed = ReadTable(&softirqs, &soft) || changed;
+  if (changed)
+  {
+    samples = 0;
+  }
+  ++samples;
+
+  seconds = Ready() ? (curTime - prevTime) / 1e9 : 0;
+  RateTable(&irqs, seconds);
+  RateTable(&soft, seconds);
+
+  // Device interrupts can be steered with their affinity, while the timer and IPIs land on every CPU regardless
+  n = irqs.cpus.size();
+  device.assign(n, 0);
+  system.assign(n, 0);
+  softirq.assign(n, 0);
+  hot.assign(n, false);
+  for (std::size_t r = 0; r < irqs.labels.size() && seconds > 0; ++r)
+  {
+    std::vector<double> &rates = Device(r) ? device : system;
+    for (std::size_t c = 0; c < n; ++c)
+    {
+      rates[c] += irqs.cur[r * n + c] >= irqs.prev[r * n + c] ? (irqs.cur[r * n + c] - irqs.prev[r * n + c]) / seconds : 0;
+    }
+  }
+  for (std::size_t r = 0; r < soft.labels.size() && seconds > 0 && soft.cpus.size() == n; ++r)
+  {
+    for (std::size_t c = 0; c < n; ++c)
+    {
+      softirq[c] += soft.cur[r * n + c] >= soft.prev[r * n + c] ? (soft.cur[r * n + c] - soft.prev[r * n + c]) / seconds : 0;
+    }
+  }
+  for (std::size_t c = 0; c < n; ++c)
+  {
+    mean += device[c] / n;
+  }
+  for (std::size_t c = 0; c < n; ++c)
+  {
+    hot[c] = device[c] >= irqHotFloor && device[c] > mean * irqHotFactor;
+  }
+
+  ranked.clear();
+  for (std::size_t r = 0; r < irqs.labels.size(); ++r)
+  {
+    if (Device(r))
+    {
+      ranked.push_back(r);
+    }
+  }
+  auto busier = [this](const std::size_t &a, const std::size_t &b) { return irqs.rates[a] > irqs.rates[b] || (irqs.rates[a] == irqs.rates[b] && a < b); };
+  std::size_t keep = std::min(top, ranked.size());
+  std::partial_sort(ranked.begin(), ranked.begin() + keep, ranked.end(), busier);
+
+  // Only the IRQs output have their affinity read, since a large computer has thousands
+  affinity.assign(irqs.labels.size(), "");
+  effective.assign(irqs.labels.size(), "");
+  for (std::size_t i = 0; i < (every ? ranked.size() : keep); ++i)
+  {
+    std::string dir = "/proc/irq/" + irqs.labels[ranked[i]] + "/";
+    affinity[ranked[i]] = readFile(dir + "smp_affinity_list", &text) ? trim(text) : "";
+    effective[ranked[i]] = readFile(dir + "effective_affinity_list", &text) ? trim(text) : "";
+  }
+  ranked.resize(keep);
+}
+#pragma endregion "Constructors' Assistants"
+
+#pragma region "Operators"
+/**
+* @brief Moves another InterruptStats object into this one
+*
+* @param o The InterruptStats object to move from
+*/
+void InterruptStats::operator=(InterruptStats &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  interrupts = std::move(o.interrupts);
+  softirqs = std::move(o.softirqs);
+  top = o.top;
+  every = o.every;
+  prevTime = o.prevTime;
+  curTime = o.curTime;
+  samples = o.samples;
+  irqs = std::move(o.irqs);
+  soft = std::move(o.soft);
+  device = std::move(o.device);
+  system = std::move(o.system);
+  softirq = std::move(o.softirq);
+  hot = std::move(o.hot);
+  ranked = std::move(o.ranked);
+  affinity = std::move(o.affinity);
+  effective = std::move(o.effective);
+}
+#pragma endregion "Operators"
+
+#pragma region "Methods"
+/**
+* @brief Takes a sample of the interrupts and softirqs
+*/
+void InterruptStats::Sample()
+{
+  SampleLux();
+}
+
+/**
+* @brief Checks whether or not there are two comparable samples
+*
+* @return true  The rates can be computed
+* @return false The rates can NOT be computed yet
+*/
+bool InterruptStats::Ready()
+{
+  return samples >= 2 && curTime > prevTime;
+}
+
+/**
+* @brief Checks whether or not a row of /proc/interrupts is a numbered device IRQ, rather than the timer or an IPI
+*
+* @param  row   The row in irqs
+* @return true  The row is a device IRQ, which has an affinity
+* @return false The row is an interrupt every CPU takes
+*/
+bool InterruptStats::Device(const std::size_t &row)
+{
+  return !irqs.labels[row].empty() && std::isdigit(static_cast<unsigned char>(irqs.labels[row][0]));
+}
+
+/**
+* @brief Gets how unevenly the device interrupts are spread, as the busiest CPU's rate over the mean
+*
+* @return double The skew, from 1 when spread evenly up to the number of CPUs when one takes them all, or 0 without any
+*/
+double InterruptStats::Skew()
+{
+  double sum = 0;
+  double most = 0;
+
+  for (std::size_t c = 0; c < device.size(); ++c)
+  {
+    sum += device[c];
+    most = std::max(most, device[c]);
+  }
+  return sum > 0 ? most * device.size() / sum : 0;
+}
+#pragma endregion "Methods"
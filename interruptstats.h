@@ -0,0 +1,85 @@
+/**
+*  @file      interruptstats.h
+*  @brief     The interface for the InterruptStats class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_INTERRUPTSTATS_H_
+#define CGOGGLES_INTERRUPTSTATS_H_
+
+#include "pch.h"
+#include "sourcefile.h"
+
+/**
+* @brief How many times the mean interrupt rate a CPU must take to be hot
+*/
+const double irqHotFactor = 1.5;
+
+/**
+* @brief The fewest device interrupts per second a CPU must take to be hot, so that an idle computer has none
+*/
+const double irqHotFloor = 100;
+
+/**
+* @brief Represents a table of counters per CPU, like /proc/interrupts or /proc/softirqs
+*/
+class InterruptTable
+{
+public:
+  std::vector<std::uint32_t> cpus;
+  std::vector<std::string> labels;
+  std::vector<std::string> devices;
+  std::vector<std::uint64_t> prev;
+  std::vector<std::uint64_t> cur;
+  std::vector<double> rates;
+  std::vector<double> skews;
+  std::vector<std::uint32_t> busiest;
+};
+
+/**
+* @brief Represents the interrupts and softirqs taken by each CPU between two samples, and where each IRQ may go
+*/
+class InterruptStats
+{
+private:
+  SourceFile interrupts;
+  SourceFile softirqs;
+  std::size_t top;
+  bool every;
+  std::uint64_t prevTime;
+  std::uint64_t curTime;
+  std::size_t samples;
+  void GetMac();
+  void GetWin();
+  void GetLux();
+  bool ReadTable(SourceFile *file, InterruptTable *table);
+  void RateTable(InterruptTable *table, const double &seconds);
+  void SampleLux();
+
+public:
+  InterruptStats();
+  InterruptStats(std::uint8_t plt, const std::size_t &n, const bool &all);
+  InterruptStats(const InterruptStats &o) = delete;
+  InterruptStats(InterruptStats &&o);
+  void operator=(const InterruptStats &o) = delete;
+  void operator=(InterruptStats &&o);
+  void Sample();
+  bool Ready();
+  bool Device(const std::size_t &row);
+  double Skew();
+  InterruptTable irqs;
+  InterruptTable soft;
+  std::vector<double> device;
+  std::vector<double> system;
+  std::vector<double> softirq;
+  std::vector<bool> hot;
+  std::vector<std::size_t> ranked;
+  std::vector<std::string> affinity;
+  std::vector<std::string> effective;
+};
+
+#endif // CGOGGLES_INTERRUPTSTATS_H_
@@ -0,0 +1,235 @@
+/**
+*  @file      kernelconfig.cpp
+*  @brief     The implementation for the KernelConfig class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "kernelconfig.h"
+#include "os.h"
+#include "sysroot.h"
+#include "utils.h"
+
+/**
+* @brief Converts a hexadecimal CPU mask, such as ff,ffffffff, into a CPU list
+*
+* @param  mask        The mask, most significant word first
+* @return std::string The CPUs in the mask, like 0-39
+*/
+static std::string maskToCpuList(const std::string &mask)
+{
+  std::vector<std::uint32_t> cpus;
+  std::uint32_t bit = 0;
+  int nibble;
+
+  for (std::size_t i = mask.size(); i-- > 0;)
+  {
+    if (!std::isxdigit(static_cast<unsigned char>(mask[i])))
+    {
+      continue;
+    }
+    nibble = std::isdigit(static_cast<unsigned char>(mask[i])) ? mask[i] - '0' : std::tolower(mask[i]) - 'a' + 10;
+    for (int j = 0; j < 4; ++j, ++bit)
+    {
+      if (nibble & (1 << j))
+      {
+        cpus.push_back(bit);
+      }
+    }
+  }
+  std::sort(cpus.begin(), cpus.end());
+  return formatCpuList(cpus);
+}
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new KernelConfig object
+*/
+KernelConfig::KernelConfig()
+{
+  cmdline = "";
+  params = std::map<std::string, std::string>();
+  vulnerabilities = std::vector<Vulnerability>();
+  irqAffinity = "";
+  hugepages = "";
+}
+
+/**
+* @brief Construct a new KernelConfig object with help from the assistants
+*
+* @param plt The platform of the system
+*/
+KernelConfig::KernelConfig(std::uint8_t plt) : KernelConfig()
+{
+  switch (plt)
+  {
+  case OS_WIN:
+    GetWin();
+    break;
+  case OS_MAC:
+    GetMac();
+    break;
+  case OS_LUX:
+    GetLux();
+    break;
+  }
+}
+
+/**
+* @brief Construct a new KernelConfig object from another KernelConfig object
+*
+* @param o The KernelConfig object to move from
+*/
+KernelConfig::KernelConfig(KernelConfig &&o)
+{
+  cmdline = std::move(o.cmdline);
+  params = std::move(o.params);
+  vulnerabilities = std::move(o.vulnerabilities);
+  irqAffinity = std::move(o.irqAffinity);
+  hugepages = std::move(o.hugepages);
+}
+#pragma endregion "Constructors"
+
+#pragma region "Constructors' Assistants"
+/**
+* @brief Fills in the kernel settings for Darwin systems
+*/
+void KernelConfig::GetMac() {}
+
+/**
+* @brief Fills in the kernel settings for Windows systems
+*/
+void KernelConfig::GetWin() {}
+
+/**
+* @brief Fills in the kernel settings for Linux systems
+*/
+void KernelConfig::GetLux()
+{
+  std::vector<std::string> words;
+  std::vector<std::string> names;
+  std::string text;
+  std::string key;
+  std::string val;
+  std::size_t open;
+
+  if (readFile("/proc/cmdline", &text))
+  {
+    cmdline = trim(text);
+    splitStringVector(cmdline, " ", &words);
+    for (std::size_t i = 0; i < words.size(); ++i)
+    {
+      // Everything after -- is handed to init, rather than the kernel
+      if (words[i] == "--")
+      {
+        break;
+      }
+      if (words[i].empty())
+      {
+        continue;
+      }
+      if (!splitKeyValuePair(words[i], &key, &val, false, '='))
+      {
+        key = words[i];
+        val = "";
+      }
+      params[key] = val;
+    }
+  }
+
+  listDirectory("/sys/devices/system/cpu/vulnerabilities", &names);
+  for (std::size_t i = 0; i < names.size(); ++i)
+  {
+    if (!readFile("/sys/devices/system/cpu/vulnerabilities/" + names[i], &text))
+    {
+      continue;
+    }
+    Vulnerability vuln;
+    vuln.name = names[i];
+    text = trim(text);
+    // Each file is "Not affected", "Vulnerable[: detail]", "Mitigation: detail" or "Unknown: detail"
+    if (!splitKeyValuePair(text, &vuln.state, &vuln.detail))
+    {
+      vuln.state = text;
+    }
+    if (vuln.state == "Mitigation")
+    {
+      vuln.state = "Mitigated";
+    }
+    // Older kernels write states such as "Processor vulnerable", so fold them into the usual one
+    else if (vuln.state != "Vulnerable" && toUpper(vuln.state).find("VULNERABLE") != std::string::npos)
+    {
+      vuln.detail = text;
+      vuln.state = "Vulnerable";
+    }
+    vulnerabilities.push_back(vuln);
+  }
+
+  if (readFile("/proc/irq/default_smp_affinity", &text))
+  {
+    irqAffinity = maskToCpuList(trim(text));
+  }
+
+  // The active mode is the one in brackets, like "always [madvise] never"
+  if (readFile("/sys/kernel/mm/transparent_hugepage/enabled", &text) && (open = text.find('[')) != std::string::npos &&
+      text.find(']', open) != std::string::npos)
+  {
+    hugepages = text.substr(open + 1, text.find(']', open) - open - 1);
+  }
+}
+#pragma endregion "Constructors' Assistants"
+
+#pragma region "Operators"
+/**
+* @brief Moves another KernelConfig object into this one
+*
+* @param o The KernelConfig object to move from
+*/
+void KernelConfig::operator=(KernelConfig &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  cmdline = std::move(o.cmdline);
+  params = std::move(o.params);
+  vulnerabilities = std::move(o.vulnerabilities);
+  irqAffinity = std::move(o.irqAffinity);
+  hugepages = std::move(o.hugepages);
+}
+#pragma endregion "Operators"
+
+#pragma region "Methods"
+/**
+* @brief Gets the value of a kernel parameter from the command line
+*
+* @param  key         The name of the parameter
+* @param  def         The value to use if the parameter is missing
+* @return std::string The value of the parameter
+*/
+std::string KernelConfig::Param(const std::string &key, const std::string &def)
+{
+  std::string ret;
+  return tryGetValue<std::string, std::string>(params, key, &ret) ? ret : def;
+}
+
+/**
+* @brief Counts the vulnerabilities in a state, such as Vulnerable or Mitigated
+*
+* @param  state       The state to count
+* @return std::size_t The number of vulnerabilities in the state
+*/
+std::size_t KernelConfig::Count(const std::string &state)
+{
+  std::size_t count = 0;
+  for (const Vulnerability &vuln : vulnerabilities)
+  {
+    count += vuln.state == state ? 1 : 0;
+  }
+  return count;
+}
+#pragma endregion "Methods"
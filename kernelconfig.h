@@ -0,0 +1,53 @@
+/**
+*  @file      kernelconfig.h
+*  @brief     The interface for the KernelConfig class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_KERNELCONFIG_H_
+#define CGOGGLES_KERNELCONFIG_H_
+
+#include "pch.h"
+
+/**
+* @brief Represents the kernel's view of a single CPU vulnerability
+*/
+class Vulnerability
+{
+public:
+  std::string name;
+  std::string state;
+  std::string detail;
+};
+
+/**
+* @brief Represents the kernel settings which decide mitigation costs and CPU isolation
+*/
+class KernelConfig
+{
+private:
+  void GetMac();
+  void GetWin();
+  void GetLux();
+
+public:
+  KernelConfig();
+  KernelConfig(std::uint8_t plt);
+  KernelConfig(const KernelConfig &o) = delete;
+  KernelConfig(KernelConfig &&o);
+  void operator=(const KernelConfig &o) = delete;
+  void operator=(KernelConfig &&o);
+  std::string Param(const std::string &key, const std::string &def = "");
+  std::size_t Count(const std::string &state);
+  std::string cmdline;
+  std::map<std::string, std::string> params;
+  std::vector<Vulnerability> vulnerabilities;
+  std::string irqAffinity;
+  std::string hugepages;
+};
+
+#endif // CGOGGLES_KERNELCONFIG_H_
@@ -24,61 +24,9 @@
 #include "graphics.h"
 #include "graphicslist.h"
 #include "system.h"
-
-/**
-* @brief The list of requests to retrieve
-*/
-std::vector<std::string> requests;
-
-/**
-* @brief The OutputStyle to use when presenting the data
-*/
-OutputStyle style = OutputStyle::Default;
-
-/**
-* @brief Whether or not to pretty-print the data
-*/
-bool pretty = true;
-
-/**
-* @brief The computer's operating system
-*/
-OperatingSystem compOS;
-
-/**
-* @brief The computer's system info
-*/
-System compSys;
-
-/**
-* @brief The computer's processor
-*/
-Processor compCPU;
-
-/**
-* @brief The computer's file system(s)
-*/
-Chassis compChassis;
-
-/**
-* @brief The computer's memory chip(s)
-*/
-RAMList compRAM;
-
-/**
-* @brief The computer's graphics processor(s)
-*/
-GraphicsList compGPU;
-
-/**
-* @brief The computer's storage drive(s)
-*/
-StorageList compStorage;
-
-/**
-* @brief The computer's file system(s)
-*/
-FileSystemList compFS;
+#include "context.h"
+#include "snapshot.h"
+#include "timings.h"
 
 /**
 * @brief The main point of entry for cgoggles
@@ -89,13 +37,51 @@ FileSystemList compFS;
 */
 int main(int argc, const char *argv[])
 {
-  std::string *request = new std::string();
-  runCommand("echo");
+  Context ctx;
+  Snapshot snap;
+  std::string request;
 
-  handleArgs(argc, argv, request);
-  parseRequests(request);
+  handleArgs(argc, argv, &ctx, &request);
+  runCommand("echo");
 
-  outputRequests();
+  switch (ctx.command)
+  {
+  case Command::Watch:
+    parseRequests(&ctx, &request);
+    try
+    {
+      watchRequests(&ctx, &snap);
+    }
+    catch (const std::runtime_error &e)
+    {
+      std::cerr << "cgoggles: " << e.what() << std::endl;
+      return EXIT_FAILURE;
+    }
+    break;
+  case Command::History:
+    splitStringVector(request, ",", &ctx.requests);
+    try
+    {
+      historyRequests(&ctx, &snap);
+    }
+    catch (const std::runtime_error &e)
+    {
+      std::cerr << "cgoggles: " << e.what() << std::endl;
+      return EXIT_FAILURE;
+    }
+    outputRequests(&ctx, &snap);
+    break;
+  default:
+    parseRequests(&ctx, &request);
+    queryRequests(&ctx, &snap);
+    outputRequests(&ctx, &snap);
+    break;
+  }
+
+  if (ctx.timings != TimingStyle::None)
+  {
+    outputTimings(&snap.timings, ctx.timings);
+  }
 
   return EXIT_SUCCESS;
 }
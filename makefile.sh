@@ -1,8 +1,8 @@
 #!/bin/bash
 
-FLAGS="-std=c++14 -g -Wall -Wno-unknown-pragmas"
+FLAGS="-std=c++14 -g -Wall -Wno-unknown-pragmas -fPIC -pthread"
 HEADERS=(pch.h.gch argh.h.gch)
-OBJECTS=(main.o fs.o fslist.o graphics.o graphicslist.o os.o processor.o ram.o ramlist.o requests.o semver.o storage.o storagelist.o system.o temperature.o utils.o)
+OBJECTS=(arena.o cgoggles.o context.o controlgroup.o controlgrouptree.o diskstats.o fs.o fslist.o kernelconfig.o memorystats.o numalist.o numanode.o network.o networklist.o graphics.o history.o graphicslist.o os.o process.o processlist.o processor.o processorusage.o processorid.o pressurestats.o schedulerstats.o interruptstats.o processorpower.o processortopology.o chassis.o ram.o ramlist.o requests.o semver.o sensor.o sensorlist.o snapshot.o sourcefile.o storage.o storagelist.o system.o sysroot.o temperature.o timerwheel.o timings.o utils.o)
 
 function join { local IFS="$1"; shift; echo "$*"; }
 
@@ -18,15 +18,36 @@ if [ -z "$1" ]; then
         fi
     done
 
-    for i in ${OBJECTS[@]}; do
+    for i in ${OBJECTS[@]} main.o heap.o; do
         echo "c++14    -c ${i//.o/.cpp}"
         compile ${i//.o/.cpp} $i
     done
 
+    echo "ar          libcgoggles.a"
+    ar rcs libcgoggles.a ${OBJECTS[@]}
+
+    echo "c++14       libcgoggles.so"
+    compileX "-shared $(join " " ${OBJECTS[@]})" libcgoggles.so
+
     echo "c++14       cgoggles.exe"
-    compileX "$(join " " ${OBJECTS[@]})" cgoggles.exe
+    compileX "main.o heap.o libcgoggles.a" cgoggles.exe
     chmod 755 cgoggles.exe
+elif [ "$1" == "bench" ]; then
+    echo "c++14    -c bench.cpp"
+    compile bench.cpp bench.o
+
+    echo "c++14       bench.exe"
+    compileX "bench.o libcgoggles.a" bench.exe
+    ./bench.exe
+elif [ "$1" == "test" ]; then
+    echo "c++14    -c allocs.cpp"
+    compile allocs.cpp allocs.o
+
+    echo "c++14       allocs.exe"
+    compileX "allocs.o heap.o libcgoggles.a" allocs.exe
+    ./allocs.exe
 elif [ "$1" == "clean" ]; then
     rm *.o
     rm *.gch
+    rm libcgoggles.a libcgoggles.so
 fi
@@ -0,0 +1,222 @@
+/**
+*  @file      memorystats.cpp
+*  @brief     The implementation for the MemoryStats class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "memorystats.h"
+#include "os.h"
+
+/**
+* @brief The keys read from /proc/meminfo, and the index of their size in memNames
+*/
+static const ScanKey memKeys[] = {
+    ScanKey("MemTotal:", 0), ScanKey("MemFree:", 1), ScanKey("MemAvailable:", 2), ScanKey("Buffers:", 3),
+    ScanKey("Cached:", 4), ScanKey("Dirty:", 5), ScanKey("Writeback:", 6), ScanKey("Slab:", 7),
+    ScanKey("SReclaimable:", 8), ScanKey("AnonPages:", 9), ScanKey("Shmem:", 10), ScanKey("SwapTotal:", memSwapTotal),
+    ScanKey("SwapFree:", memSwapFree), ScanKey("SwapCached:", 13)};
+
+/**
+* @brief The keys read from /proc/vmstat, and the index of their counter in vmNames
+*/
+static const ScanKey vmKeys[] = {
+    ScanKey("pgfault", 0), ScanKey("pgmajfault", 1), ScanKey("pswpin", 2), ScanKey("pswpout", 3),
+    ScanKey("pgscan_kswapd", 4), ScanKey("pgscan_direct", 4), ScanKey("pgscan_khugepaged", 4),
+    ScanKey("pgscan_proactive", 4)};
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new, unsampled MemoryStats object
+*/
+MemoryStats::MemoryStats()
+{
+  mem.fill(0);
+  prev.fill(0);
+  cur.fill(0);
+  prevTime = curTime = 0;
+  samples = 0;
+}
+
+/**
+* @brief Construct a new MemoryStats object with help from the assistants
+*
+* @param plt The platform of the system
+*/
+MemoryStats::MemoryStats(std::uint8_t plt) : MemoryStats()
+{
+  switch (plt)
+  {
+  case OS_WIN:
+    GetWin();
+    break;
+  case OS_MAC:
+    GetMac();
+    break;
+  case OS_LUX:
+    GetLux();
+    break;
+  }
+}
+
+/**
+* @brief Construct a new MemoryStats object from another MemoryStats object
+*
+* @param o The MemoryStats object to move from
+*/
+MemoryStats::MemoryStats(MemoryStats &&o)
+{
+  meminfo = std::move(o.meminfo);
+  vmstat = std::move(o.vmstat);
+  mem = o.mem;
+  prev = o.prev;
+  cur = o.cur;
+  prevTime = o.prevTime;
+  curTime = o.curTime;
+  samples = o.samples;
+}
+#pragma endregion "Constructors"
+
+#pragma region "Constructors' Assistants"
+/**
+* @brief Fills in the memory sources for Darwin systems
+*/
+void MemoryStats::GetMac() {}
+
+/**
+* @brief Fills in the memory sources for Windows systems
+*/
+void MemoryStats::GetWin() {}
+
+/**
+* @brief Fills in the memory sources for Linux systems
+*/
+void MemoryStats::GetLux()
+{
+  meminfo = SourceFile("/proc/meminfo");
+  vmstat = SourceFile("/proc/vmstat");
+}
+
+/**
+* @brief Takes a sample of /proc/meminfo and /proc/vmstat in a single pass each
+*/
+void MemoryStats::SampleLux()
+{
+  const std::size_t memCount = sizeof(memKeys) / sizeof(memKeys[0]);
+  const std::size_t vmCount = sizeof(vmKeys) / sizeof(vmKeys[0]);
+  std::size_t key;
+
+  if (meminfo.Read())
+  {
+    Scanner scan(meminfo.Data(), meminfo.Size());
+    while (!scan.Done())
+    {
+      key = scan.Lookup(memKeys, memCount);
+      if (key < memCount)
+      {
+        mem[memKeys[key].slot] = scan.Number() * 1024;
+      }
+      scan.SkipLine();
+    }
+  }
+
+  prev = cur;
+  prevTime = curTime;
+  curTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  if (!vmstat.Read())
+  {
+    samples = 0;
+    return;
+  }
+
+  cur.fill(0);
+  Scanner scan(vmstat.Data(), vmstat.Size());
+  while (!scan.Done())
+  {
+    key = scan.Lookup(vmKeys, vmCount);
+    if (key < vmCount)
+    {
+      cur[vmKeys[key].slot] += scan.Number();
+    }
+    scan.SkipLine();
+  }
+  ++samples;
+}
+#pragma endregion "Constructors' Assistants"
+
+#pragma region "Operators"
+/**
+* @brief Moves another MemoryStats object into this one
+*
+* @param o The MemoryStats object to move from
+*/
+void MemoryStats::operator=(MemoryStats &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  meminfo = std::move(o.meminfo);
+  vmstat = std::move(o.vmstat);
+  mem = o.mem;
+  prev = o.prev;
+  cur = o.cur;
+  prevTime = o.prevTime;
+  curTime = o.curTime;
+  samples = o.samples;
+}
+#pragma endregion "Operators"
+
+#pragma region "Methods"
+/**
+* @brief Takes a sample of the memory sizes and counters, keeping the previous counters to compare against
+*/
+void MemoryStats::Sample()
+{
+  if (meminfo.Good() || vmstat.Good())
+  {
+    SampleLux();
+  }
+}
+
+/**
+* @brief Checks whether or not there are two comparable samples
+*
+* @return true  The rates can be computed
+* @return false The rates can NOT be computed yet
+*/
+bool MemoryStats::Ready()
+{
+  return samples >= 2 && curTime > prevTime;
+}
+
+/**
+* @brief Gets a size from the latest sample
+*
+* @param  field         The index of the size in memNames
+* @return std::uint64_t The size in bytes
+*/
+std::uint64_t MemoryStats::Size(const std::size_t &field)
+{
+  return field < memFields ? mem[field] : 0;
+}
+
+/**
+* @brief Gets the rate of a counter between the two samples
+*
+* @param  field  The index of the counter in vmNames
+* @return double The events per second
+*/
+double MemoryStats::Rate(const std::size_t &field)
+{
+  if (!Ready() || field >= vmFields || cur[field] < prev[field])
+  {
+    return 0;
+  }
+  return (cur[field] - prev[field]) * 1e9 / (curTime - prevTime);
+}
+#pragma endregion "Methods"
@@ -0,0 +1,79 @@
+/**
+*  @file      memorystats.h
+*  @brief     The interface for the MemoryStats class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_MEMORYSTATS_H_
+#define CGOGGLES_MEMORYSTATS_H_
+
+#include "pch.h"
+#include "sourcefile.h"
+
+/**
+* @brief The number of sizes kept from /proc/meminfo
+*/
+const std::size_t memFields = 14;
+
+/**
+* @brief The names of the sizes kept from /proc/meminfo
+*/
+const char *const memNames[memFields] = {"Total", "Free", "Available", "Buffers", "Cached", "Dirty", "Writeback", "Slab", "SlabReclaimable", "Anon", "Shmem", "SwapTotal", "SwapFree", "SwapCached"};
+
+/**
+* @brief The index of the swap space in memNames
+*/
+const std::size_t memSwapTotal = 11;
+
+/**
+* @brief The index of the unused swap space in memNames
+*/
+const std::size_t memSwapFree = 12;
+
+/**
+* @brief The number of counters kept from /proc/vmstat
+*/
+const std::size_t vmFields = 5;
+
+/**
+* @brief The names of the counters kept from /proc/vmstat
+*/
+const char *const vmNames[vmFields] = {"PageFaults", "MajorFaults", "SwapIns", "SwapOuts", "ReclaimScans"};
+
+/**
+* @brief Represents a computer's memory usage, and its paging activity between two samples
+*/
+class MemoryStats
+{
+private:
+  SourceFile meminfo;
+  SourceFile vmstat;
+  std::array<std::uint64_t, memFields> mem;
+  std::array<std::uint64_t, vmFields> prev;
+  std::array<std::uint64_t, vmFields> cur;
+  std::uint64_t prevTime;
+  std::uint64_t curTime;
+  std::size_t samples;
+  void GetMac();
+  void GetWin();
+  void GetLux();
+  void SampleLux();
+
+public:
+  MemoryStats();
+  MemoryStats(std::uint8_t plt);
+  MemoryStats(const MemoryStats &o) = delete;
+  MemoryStats(MemoryStats &&o);
+  void operator=(const MemoryStats &o) = delete;
+  void operator=(MemoryStats &&o);
+  void Sample();
+  bool Ready();
+  std::uint64_t Size(const std::size_t &field);
+  double Rate(const std::size_t &field);
+};
+
+#endif // CGOGGLES_MEMORYSTATS_H_
@@ -0,0 +1,78 @@
+/**
+*  @file      network.cpp
+*  @brief     The implementation for the Network class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "network.h"
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new Network object
+*/
+Network::Network()
+{
+  name = "";
+  address = "";
+  state = "";
+  speed = 0;
+  mtu = 0;
+}
+
+/**
+* @brief Construct a new Network object with values
+*
+* @param nm  The interface name
+* @param adr The hardware address
+* @param st  The operational state
+* @param spd The link speed in bits per second
+* @param mt  The maximum transmission unit
+*/
+Network::Network(std::string nm, std::string adr, std::string st, std::uint64_t spd, std::uint32_t mt)
+{
+  name = std::move(nm);
+  address = std::move(adr);
+  state = std::move(st);
+  speed = spd;
+  mtu = mt;
+}
+
+/**
+* @brief Construct a new Network object with values from another Network object
+*
+* @param o The other Network object to move from
+*/
+Network::Network(Network &&o)
+{
+  name = std::move(o.name);
+  address = std::move(o.address);
+  state = std::move(o.state);
+  speed = o.speed;
+  mtu = o.mtu;
+}
+#pragma endregion "Constructors"
+
+#pragma region "Operators"
+/**
+* @brief Moves another Network object into this one
+*
+* @param o The Network object to move from
+*/
+void Network::operator=(Network &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  name = std::move(o.name);
+  address = std::move(o.address);
+  state = std::move(o.state);
+  speed = o.speed;
+  mtu = o.mtu;
+}
+#pragma endregion "Operators"
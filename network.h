@@ -0,0 +1,35 @@
+/**
+*  @file      network.h
+*  @brief     The interface for the Network class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_NETWORK_H_
+#define CGOGGLES_NETWORK_H_
+
+#include "pch.h"
+
+/**
+* @brief Represents a computer's network interface
+*/
+class Network
+{
+public:
+  Network();
+  Network(std::string nm, std::string adr, std::string st, std::uint64_t spd, std::uint32_t mt);
+  Network(const Network &o) = delete;
+  Network(Network &&o);
+  void operator=(const Network &o) = delete;
+  void operator=(Network &&o);
+  std::string name;
+  std::string address;
+  std::string state;
+  std::uint64_t speed;
+  std::uint32_t mtu;
+};
+
+#endif // CGOGGLES_NETWORK_H_
@@ -0,0 +1,259 @@
+/**
+*  @file      networklist.cpp
+*  @brief     The implementation for the NetworkList class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "networklist.h"
+#include "os.h"
+#include "sysroot.h"
+#include "utils.h"
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new, unsampled NetworkList object
+*/
+NetworkList::NetworkList()
+{
+  rows = std::vector<std::size_t>();
+  prev = std::vector<std::array<std::uint64_t, netFields>>();
+  cur = std::vector<std::array<std::uint64_t, netFields>>();
+  prevTime = curTime = 0;
+  samples = 0;
+  interfaces = std::vector<Network>();
+}
+
+/**
+* @brief Construct a new NetworkList object with help from the assistants
+*
+* @param plt The platform of the system
+*/
+NetworkList::NetworkList(std::uint8_t plt) : NetworkList()
+{
+  switch (plt)
+  {
+  case OS_WIN:
+    GetWin();
+    break;
+  case OS_MAC:
+    GetMac();
+    break;
+  case OS_LUX:
+    GetLux();
+    break;
+  }
+}
+
+/**
+* @brief Construct a new NetworkList object from another NetworkList object
+*
+* @param o The NetworkList object to move from
+*/
+NetworkList::NetworkList(NetworkList &&o)
+{
+  dev = std::move(o.dev);
+  rows = std::move(o.rows);
+  prev = std::move(o.prev);
+  cur = std::move(o.cur);
+  prevTime = o.prevTime;
+  curTime = o.curTime;
+  samples = o.samples;
+  interfaces = std::move(o.interfaces);
+}
+#pragma endregion "Constructors"
+
+#pragma region "Constructors' Assistants"
+/**
+* @brief Fills in the network interfaces for Darwin systems
+*/
+void NetworkList::GetMac() {}
+
+/**
+* @brief Fills in the network interfaces for Windows systems
+*/
+void NetworkList::GetWin() {}
+
+/**
+* @brief Fills in the network interfaces for Linux systems
+*/
+void NetworkList::GetLux()
+{
+  std::vector<std::string> names;
+  std::string dir;
+  std::string temp;
+  std::string tempAddress;
+  std::string tempState;
+  std::uint64_t tempSpeed;
+  std::uint32_t tempMtu;
+
+  listDirectory("/sys/class/net", &names);
+  for (std::size_t i = 0; i < names.size(); ++i)
+  {
+    dir = "/sys/class/net/" + names[i];
+    tempAddress = readFile(dir + "/address", &temp) ? trim(temp) : "";
+    tempState = readFile(dir + "/operstate", &temp) ? trim(temp) : "";
+    // Virtual and disconnected links fail to read, or report -1
+    tempSpeed = readFile(dir + "/speed", &temp) && !trim(temp).empty() && trim(temp)[0] != '-' ? std::stoull(temp) * 1000000 : 0;
+    tempMtu = readFile(dir + "/mtu", &temp) && !trim(temp).empty() ? std::stoul(temp) : 0;
+    interfaces.emplace_back(names[i], tempAddress, tempState, tempSpeed, tempMtu);
+  }
+
+  prev.resize(interfaces.size());
+  cur.resize(interfaces.size());
+  dev = SourceFile("/proc/net/dev");
+}
+
+/**
+* @brief Takes a sample of /proc/net/dev, only matching rows to interfaces again when they change
+*/
+void NetworkList::SampleLux()
+{
+  const std::size_t none = interfaces.size();
+  std::size_t row = 0;
+  std::size_t iface;
+  std::size_t len;
+  std::uint64_t value;
+  bool same = true;
+  const char *name;
+
+  std::swap(prev, cur);
+  prevTime = curTime;
+  curTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  if (!dev.Read())
+  {
+    samples = 0;
+    return;
+  }
+
+  Scanner scan(dev.Data(), dev.Size());
+  // The first two lines are the column headers
+  scan.SkipLine();
+  scan.SkipLine();
+  while (!scan.Done())
+  {
+    len = scan.Until(':', &name);
+    if (len == 0)
+    {
+      scan.SkipLine();
+      continue;
+    }
+    if (row >= rows.size())
+    {
+      rows.push_back(none);
+      same = false;
+    }
+    iface = rows[row];
+    if (iface == none || interfaces[iface].name.size() != len || std::memcmp(interfaces[iface].name.data(), name, len) != 0)
+    {
+      for (iface = 0; iface < none; ++iface)
+      {
+        if (interfaces[iface].name.size() == len && std::memcmp(interfaces[iface].name.data(), name, len) == 0)
+        {
+          break;
+        }
+      }
+      same = same && iface == rows[row];
+      rows[row] = iface;
+    }
+
+    // Received bytes, packets, errors and drops start the line, and the transmitted ones follow four more columns
+    for (std::size_t i = 0; i < 12; ++i)
+    {
+      value = scan.Number();
+      if (iface != none && (i < 4 || i >= 8))
+      {
+        cur[iface][i < 4 ? i : i - 4] = value;
+      }
+    }
+    scan.SkipLine();
+    ++row;
+  }
+
+  if (!same || row != rows.size())
+  {
+    rows.resize(row);
+    samples = 0;
+  }
+  ++samples;
+}
+#pragma endregion "Constructors' Assistants"
+
+#pragma region "Operators"
+/**
+* @brief Moves another NetworkList object into this one
+*
+* @param o The NetworkList object to move from
+*/
+void NetworkList::operator=(NetworkList &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  dev = std::move(o.dev);
+  rows = std::move(o.rows);
+  prev = std::move(o.prev);
+  cur = std::move(o.cur);
+  prevTime = o.prevTime;
+  curTime = o.curTime;
+  samples = o.samples;
+  interfaces = std::move(o.interfaces);
+}
+#pragma endregion "Operators"
+
+#pragma region "Methods"
+/**
+* @brief Takes a sample of every interface's counters, keeping the previous one to compare against
+*/
+void NetworkList::Sample()
+{
+  if (dev.Good())
+  {
+    SampleLux();
+  }
+}
+
+/**
+* @brief Checks whether or not there are two comparable samples
+*
+* @return true  The rates can be computed
+* @return false The rates can NOT be computed yet
+*/
+bool NetworkList::Ready()
+{
+  return samples >= 2 && curTime > prevTime;
+}
+
+/**
+* @brief Gets a counter from the latest sample
+*
+* @param  iface         The index of the interface
+* @param  field         The index of the counter in netNames
+* @return std::uint64_t The counter's total since the interface came up
+*/
+std::uint64_t NetworkList::Total(const std::size_t &iface, const std::size_t &field)
+{
+  return iface < cur.size() && field < netFields ? cur[iface][field] : 0;
+}
+
+/**
+* @brief Gets the rate of a counter between the two samples
+*
+* @param  iface  The index of the interface
+* @param  field  The index of the counter in netNames
+* @return double The counter's growth per second
+*/
+double NetworkList::Rate(const std::size_t &iface, const std::size_t &field)
+{
+  if (!Ready() || iface >= cur.size() || field >= netFields || cur[iface][field] < prev[iface][field])
+  {
+    return 0;
+  }
+  return (cur[iface][field] - prev[iface][field]) * 1e9 / (curTime - prevTime);
+}
+#pragma endregion "Methods"
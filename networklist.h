@@ -0,0 +1,60 @@
+/**
+*  @file      networklist.h
+*  @brief     The interface for the NetworkList class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_NETWORKLIST_H_
+#define CGOGGLES_NETWORKLIST_H_
+
+#include "pch.h"
+#include "network.h"
+#include "sourcefile.h"
+
+/**
+* @brief The number of counters kept for each network interface
+*/
+const std::size_t netFields = 8;
+
+/**
+* @brief The names of the counters kept for each network interface
+*/
+const char *const netNames[netFields] = {"RxBytes", "RxPackets", "RxErrors", "RxDrops", "TxBytes", "TxPackets", "TxErrors", "TxDrops"};
+
+/**
+* @brief Represents a computer's collection of Network objects, and their traffic between two samples
+*/
+class NetworkList
+{
+private:
+  SourceFile dev;
+  std::vector<std::size_t> rows;
+  std::vector<std::array<std::uint64_t, netFields>> prev;
+  std::vector<std::array<std::uint64_t, netFields>> cur;
+  std::uint64_t prevTime;
+  std::uint64_t curTime;
+  std::size_t samples;
+  void GetMac();
+  void GetWin();
+  void GetLux();
+  void SampleLux();
+
+public:
+  NetworkList();
+  NetworkList(std::uint8_t plt);
+  NetworkList(const NetworkList &o) = delete;
+  NetworkList(NetworkList &&o);
+  void operator=(const NetworkList &o) = delete;
+  void operator=(NetworkList &&o);
+  void Sample();
+  bool Ready();
+  std::uint64_t Total(const std::size_t &iface, const std::size_t &field);
+  double Rate(const std::size_t &iface, const std::size_t &field);
+  std::vector<Network> interfaces;
+};
+
+#endif // CGOGGLES_NETWORKLIST_H_
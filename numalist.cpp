@@ -0,0 +1,231 @@
+/**
+*  @file      numalist.cpp
+*  @brief     The implementation for the NumaList class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "numalist.h"
+#include "os.h"
+#include "sysroot.h"
+#include "utils.h"
+
+/**
+* @brief The prefixes in a DIMM's locator which name the socket or node it hangs off, and whether they name a node
+*/
+static const std::array<std::pair<std::string, bool>, 5> bankPrefixes = {{{"NODE", true}, {"SOCKET", false}, {"PROC", false}, {"CPU", false}, {"P", false}}};
+
+/**
+* @brief Finds the socket or node a DIMM's locator names, such as CPU1_DIMM_A1, P0-DIMMA1 or NODE 1 DIMM 0
+*
+* @param  bank  The DIMM's locator
+* @param  num   The number after the prefix
+* @param  node  Whether the number names a node rather than a socket
+* @return true  The locator names a socket or node
+* @return false The locator names neither
+*/
+static bool parseBank(const std::string &bank, std::uint32_t *num, bool *node)
+{
+  std::string up = toUpper(bank);
+  std::size_t pos, end;
+
+  for (const std::pair<std::string, bool> &prefix : bankPrefixes)
+  {
+    for (pos = up.find(prefix.first); pos != std::string::npos; pos = up.find(prefix.first, pos + 1))
+    {
+      // The prefix must start a word, so the P inside a name like DIMMP1 is skipped
+      if (pos > 0 && std::isalnum(static_cast<unsigned char>(up[pos - 1])))
+      {
+        continue;
+      }
+      end = pos + prefix.first.size();
+      while (end < up.size() && (up[end] == ' ' || up[end] == '_' || up[end] == '#'))
+      {
+        ++end;
+      }
+      if (end < up.size() && std::isdigit(static_cast<unsigned char>(up[end])))
+      {
+        *num = static_cast<std::uint32_t>(std::strtoul(up.c_str() + end, nullptr, 10));
+        *node = prefix.second;
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new NumaList object
+*/
+NumaList::NumaList()
+{
+  nodes = std::vector<NumaNode>();
+}
+
+/**
+* @brief Construct a new NumaList object with help from the assistants
+*
+* @param plt The platform of the system
+*/
+NumaList::NumaList(std::uint8_t plt) : NumaList()
+{
+  switch (plt)
+  {
+  case OS_WIN:
+    GetWin();
+    break;
+  case OS_MAC:
+    GetMac();
+    break;
+  case OS_LUX:
+    GetLux();
+    break;
+  }
+}
+
+/**
+* @brief Construct a new NumaList object from another NumaList object
+*
+* @param o The NumaList object to move from
+*/
+NumaList::NumaList(NumaList &&o)
+{
+  nodes = std::move(o.nodes);
+}
+#pragma endregion "Constructors"
+
+#pragma region "Constructors' Assistants"
+/**
+* @brief Fills in the NUMA nodes for Darwin systems, which do not expose any
+*/
+void NumaList::GetMac() {}
+
+/**
+* @brief Fills in the NUMA nodes for Windows systems
+*/
+void NumaList::GetWin() {}
+
+/**
+* @brief Fills in the NUMA nodes for Linux systems
+*/
+void NumaList::GetLux()
+{
+  std::vector<std::string> names;
+
+  listDirectory("/sys/devices/system/node", &names);
+  for (std::size_t i = 0; i < names.size(); ++i)
+  {
+    if (!startswith(names[i], "node") || names[i].size() == 4 || !std::isdigit(static_cast<unsigned char>(names[i][4])))
+    {
+      continue;
+    }
+    nodes.emplace_back(std::stoul(names[i].substr(4)), "/sys/devices/system/node/" + names[i]);
+  }
+  std::sort(nodes.begin(), nodes.end(), [](const NumaNode &a, const NumaNode &b) { return a.id < b.id; });
+}
+#pragma endregion "Constructors' Assistants"
+
+#pragma region "Operators"
+/**
+* @brief Moves another NumaList object into this one
+*
+* @param o The NumaList object to move from
+*/
+void NumaList::operator=(NumaList &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  nodes = std::move(o.nodes);
+}
+#pragma endregion "Operators"
+
+#pragma region "Methods"
+/**
+* @brief Gets how unevenly memory is used across the nodes
+*
+* @return double The used share of the fullest node less that of the emptiest, in percentage points
+*/
+double NumaList::Imbalance()
+{
+  double used, most = 0, least = 100;
+  std::size_t counted = 0;
+
+  for (const NumaNode &node : nodes)
+  {
+    if (node.memTotal == 0)
+    {
+      continue;
+    }
+    used = 100.0 * (node.memTotal - std::min(node.memFree, node.memTotal)) / node.memTotal;
+    most = std::max(most, used);
+    least = std::min(least, used);
+    ++counted;
+  }
+  return counted > 1 ? most - least : 0;
+}
+
+/**
+* @brief Gets the share of allocations which missed their preferred node, since boot
+*
+* @return double The misses over all allocations, as a percentage
+*/
+double NumaList::MissRatio()
+{
+  std::uint64_t hit = 0, miss = 0;
+
+  for (const NumaNode &node : nodes)
+  {
+    hit += node.counters[0];
+    miss += node.counters[1];
+  }
+  return hit + miss > 0 ? 100.0 * miss / (hit + miss) : 0;
+}
+
+/**
+* @brief Assigns each DIMM to the node its locator names, or else the first node in the package it names
+*
+* @param ram The DIMMs, as read from SMBIOS
+*/
+void NumaList::MapBanks(const RAMList &ram)
+{
+  std::vector<std::pair<std::uint32_t, bool>> parsed(ram.chips.size());
+  std::vector<bool> found(ram.chips.size(), false);
+  std::uint32_t num, lowest = UINT32_MAX;
+  bool node;
+
+  for (std::size_t i = 0; i < ram.chips.size(); ++i)
+  {
+    found[i] = parseBank(ram.chips[i].bank, &num, &node);
+    parsed[i] = std::make_pair(num, node);
+    if (found[i] && !node)
+    {
+      lowest = std::min(lowest, num);
+    }
+  }
+
+  for (std::size_t i = 0; i < ram.chips.size(); ++i)
+  {
+    if (!found[i])
+    {
+      continue;
+    }
+    // Boards count sockets from one as often as from zero, so CPU1 is the first socket when there is no CPU0
+    num = parsed[i].first - (!parsed[i].second && lowest == 1 ? 1 : 0);
+    for (NumaNode &cur : nodes)
+    {
+      if (parsed[i].second ? cur.id == num : cur.package == static_cast<std::int32_t>(num))
+      {
+        cur.banks.push_back(ram.chips[i].bank);
+        break;
+      }
+    }
+  }
+}
+#pragma endregion "Methods"
@@ -0,0 +1,41 @@
+/**
+*  @file      numalist.h
+*  @brief     The interface for the NumaList class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_NUMALIST_H_
+#define CGOGGLES_NUMALIST_H_
+
+#include "pch.h"
+#include "numanode.h"
+#include "ramlist.h"
+
+/**
+* @brief Represents a computer's collection of NumaNode objects
+*/
+class NumaList
+{
+private:
+  void GetMac();
+  void GetWin();
+  void GetLux();
+
+public:
+  NumaList();
+  NumaList(std::uint8_t plt);
+  NumaList(const NumaList &o) = delete;
+  NumaList(NumaList &&o);
+  void operator=(const NumaList &o) = delete;
+  void operator=(NumaList &&o);
+  double Imbalance();
+  double MissRatio();
+  void MapBanks(const RAMList &ram);
+  std::vector<NumaNode> nodes;
+};
+
+#endif // CGOGGLES_NUMALIST_H_
@@ -0,0 +1,156 @@
+/**
+*  @file      numanode.cpp
+*  @brief     The implementation for the NumaNode class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "numanode.h"
+#include "sourcefile.h"
+#include "utils.h"
+
+/**
+* @brief The keys read from a node's meminfo, after its "Node N" prefix
+*/
+static const ScanKey memKeys[] = {ScanKey("MemTotal:", 0), ScanKey("MemFree:", 1)};
+
+/**
+* @brief The keys read from a node's numastat, in the order of numaNames
+*/
+static const ScanKey statKeys[] = {ScanKey("numa_hit", 0), ScanKey("numa_miss", 1), ScanKey("numa_foreign", 2),
+                                   ScanKey("interleave_hit", 3), ScanKey("local_node", 4), ScanKey("other_node", 5)};
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new NumaNode object
+*/
+NumaNode::NumaNode()
+{
+  id = 0;
+  cpuList = "";
+  cpus = std::vector<std::uint32_t>();
+  package = -1;
+  memTotal = 0;
+  memFree = 0;
+  distances = std::vector<std::uint32_t>();
+  counters.fill(0);
+  banks = std::vector<std::string>();
+}
+
+/**
+* @brief Construct a new NumaNode object, reading its sysfs directory
+*
+* @param i   The ID of the node
+* @param dir The node's directory, e.g. /sys/devices/system/node/node0
+*/
+NumaNode::NumaNode(std::uint32_t i, const std::string &dir) : NumaNode()
+{
+  std::string text;
+  std::size_t slot;
+  std::uint64_t mem[2] = {0, 0};
+
+  id = i;
+  if (readFile(dir + "/cpulist", &text))
+  {
+    cpuList = trim(text);
+    parseCpuList(cpuList, &cpus);
+  }
+  // A node's CPUs all sit in the same package, so its first CPU names it
+  if (!cpus.empty() && readFile("/sys/devices/system/cpu/cpu" + std::to_string(cpus[0]) + "/topology/physical_package_id", &text) && !trim(text).empty())
+  {
+    package = static_cast<std::int32_t>(std::stol(text));
+  }
+
+  if (readFile(dir + "/meminfo", &text))
+  {
+    Scanner scan(text.data(), text.size());
+    while (!scan.Done())
+    {
+      // Each line is "Node N Key: value kB"
+      if (scan.Match("Node"))
+      {
+        scan.Number();
+        slot = scan.Lookup(memKeys, 2);
+        if (slot < 2)
+        {
+          mem[slot] = scan.Number() * 1024;
+        }
+      }
+      scan.SkipLine();
+    }
+    memTotal = mem[0];
+    memFree = mem[1];
+  }
+
+  if (readFile(dir + "/distance", &text))
+  {
+    Scanner scan(text.data(), text.size());
+    scan.SkipSpaces();
+    while (!scan.Done() && !scan.Match("\n") && distances.size() < 1024)
+    {
+      distances.push_back(static_cast<std::uint32_t>(scan.Number()));
+      scan.SkipSpaces();
+    }
+  }
+
+  if (readFile(dir + "/numastat", &text))
+  {
+    Scanner scan(text.data(), text.size());
+    while (!scan.Done())
+    {
+      slot = scan.Lookup(statKeys, numaFields);
+      if (slot < numaFields)
+      {
+        counters[slot] = scan.Number();
+      }
+      scan.SkipLine();
+    }
+  }
+}
+
+/**
+* @brief Construct a new NumaNode object with values from another NumaNode object
+*
+* @param o The other NumaNode object to move from
+*/
+NumaNode::NumaNode(NumaNode &&o)
+{
+  id = o.id;
+  cpuList = std::move(o.cpuList);
+  cpus = std::move(o.cpus);
+  package = o.package;
+  memTotal = o.memTotal;
+  memFree = o.memFree;
+  distances = std::move(o.distances);
+  counters = o.counters;
+  banks = std::move(o.banks);
+}
+#pragma endregion "Constructors"
+
+#pragma region "Operators"
+/**
+* @brief Moves another NumaNode object into this one
+*
+* @param o The NumaNode object to move from
+*/
+void NumaNode::operator=(NumaNode &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  id = o.id;
+  cpuList = std::move(o.cpuList);
+  cpus = std::move(o.cpus);
+  package = o.package;
+  memTotal = o.memTotal;
+  memFree = o.memFree;
+  distances = std::move(o.distances);
+  counters = o.counters;
+  banks = std::move(o.banks);
+}
+#pragma endregion "Operators"
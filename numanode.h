@@ -0,0 +1,49 @@
+/**
+*  @file      numanode.h
+*  @brief     The interface for the NumaNode class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_NUMANODE_H_
+#define CGOGGLES_NUMANODE_H_
+
+#include "pch.h"
+
+/**
+* @brief The number of counters read from each node's numastat
+*/
+const std::size_t numaFields = 6;
+
+/**
+* @brief The names of each numastat counter, as they are output
+*/
+const std::array<std::string, numaFields> numaNames = {"Hit", "Miss", "Foreign", "InterleaveHit", "LocalNode", "OtherNode"};
+
+/**
+* @brief Represents a single NUMA node, its CPUs, memory and allocation counters
+*/
+class NumaNode
+{
+public:
+  NumaNode();
+  NumaNode(std::uint32_t i, const std::string &dir);
+  NumaNode(const NumaNode &o) = delete;
+  NumaNode(NumaNode &&o);
+  void operator=(const NumaNode &o) = delete;
+  void operator=(NumaNode &&o);
+  std::uint32_t id;
+  std::string cpuList;
+  std::vector<std::uint32_t> cpus;
+  std::int32_t package;
+  std::uint64_t memTotal;
+  std::uint64_t memFree;
+  std::vector<std::uint32_t> distances;
+  std::array<std::uint64_t, numaFields> counters;
+  std::vector<std::string> banks;
+};
+
+#endif // CGOGGLES_NUMANODE_H_
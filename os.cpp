@@ -12,6 +12,9 @@
 #include "os.h"
 #include "semver.h"
 #include "utils.h"
+#include "timings.h"
+#include "sysroot.h"
+#include <sys/stat.h>
 
 #pragma region "Constructors"
 /**
@@ -64,19 +67,19 @@ OperatingSystem::OperatingSystem(std::uint8_t plt)
 /**
 * @brief Construct a new OperatingSystem object from another OperatingSystem object
 *
-* @param o The OperatingSystem object to copy from
+* @param o The OperatingSystem object to move from
 */
-OperatingSystem::OperatingSystem(const OperatingSystem &o)
+OperatingSystem::OperatingSystem(OperatingSystem &&o)
 {
-  platform = o.platform;
-  caption = o.caption;
-  serial = o.serial;
+  platform = std::move(o.platform);
+  caption = std::move(o.caption);
+  serial = std::move(o.serial);
   bit = o.bit;
   installTime = o.installTime;
   bootTime = o.bootTime;
   curTime = o.curTime;
-  kernel = o.kernel;
-  version = o.version;
+  kernel = std::move(o.kernel);
+  version = std::move(o.version);
 }
 #pragma endregion "Constructors"
 
@@ -108,8 +111,8 @@ void OperatingSystem::GetMac()
   serial = runCommand("system_profiler SPHardwareDataType | grep Serial | awk '{ print $4; }'");
   trim(&serial);
   bit = std::stoi(runCommand("getconf LONG_BIT"));
-  version = new SemVer(runCommand("sysctl -n kern.osproductversion"), 0b11100u);
-  kernel = new SemVer(runCommand("sysctl -n kern.osrelease"), 0b11100u);
+  version = SemVer(runCommand("sysctl -n kern.osproductversion"), 0b11100u);
+  kernel = SemVer(runCommand("sysctl -n kern.osrelease"), 0b11100u);
   caption = version.Minor() > 11 ? "macOS" : "Mac OS X";
   if (version.Major() == 10 && version.Minor() > 1 && version.Minor() < 15)
   {
@@ -148,8 +151,8 @@ void OperatingSystem::GetWin()
   caption = dataMap["Caption"];
   serial = dataMap["SerialNumber"];
   bit = std::stoi(dataMap["OSArchitecture"].erase(3));
-  version = new SemVer(dataMap["Version"], 0b11010u);
-  kernel = new SemVer(dataMap["Version"], 0b11010u);
+  version = SemVer(dataMap["Version"], 0b11010u);
+  kernel = SemVer(dataMap["Version"], 0b11010u);
 
   temp = dataMap["InstallDate"];
   installTime.tm_year = std::stoi(temp.substr(0, 4)) - 1900;
@@ -182,90 +185,94 @@ void OperatingSystem::GetWin()
 void OperatingSystem::GetLux()
 {
   std::string temp;
+  std::vector<std::string> lines;
+  std::string key;
+  std::string val;
+  std::string release = "";
+  struct stat st;
   std::time_t t = std::time(0);
+  bool rooted = activeSysroot() != nullptr;
 
   platform = "Linux";
-  temp = runCommand("lsb_release -d");
-  caption = trim(temp.substr(temp.find_first_of(":") + 1));
+  if (readFile("/etc/os-release", &temp) || readFile("/usr/lib/os-release", &temp))
+  {
+    splitStringVector(temp, "\n", &lines);
+    for (std::size_t i = 0; i < lines.size(); ++i)
+    {
+      if (!splitKeyValuePair(lines[i], &key, &val, true, '='))
+      {
+        continue;
+      }
+      val = std::regex_replace(val, std::regex(R"(^"|"$)"), "");
+      if (key == "PRETTY_NAME")
+      {
+        caption = val;
+      }
+      if (key == "VERSION_ID")
+      {
+        release = val;
+      }
+    }
+  }
+  else if (!rooted)
+  {
+    temp = runCommand("lsb_release -d");
+    caption = trim(temp.substr(temp.find_first_of(":") + 1));
+    temp = runCommand("lsb_release -r");
+    release = trim(temp.substr(temp.find_first_of(":") + 1));
+  }
+  if (!release.empty() && std::isdigit(release[0]))
+  {
+    version = SemVer(release, std::count(release.begin(), release.end(), '.') > 0 ? 0b11000u : 0b1000u);
+  }
+
   serial = readFile("/sys/devices/virtual/dmi/id/product_serial", &temp) ? trim(temp) : "";
-  temp = trim(runCommand("uname -m"));
+  temp = readFile("/proc/sys/kernel/arch", &temp) ? trim(temp) : rooted ? "" : trim(runCommand("uname -m"));
   bit = endswith(temp, "64") || temp.find("armv8") != std::string::npos ? 64 : 32;
-  temp = runCommand("lsb_release -r");
-  version = new SemVer(trim(temp.substr(temp.find_first_of(":") + 1)), std::count(temp.begin(), temp.end(), '.') > 0 ? 0b11000u : 0b1000u);
-  temp = runCommand("uname -r");
-  kernel = new SemVer(trim(temp.substr(0, temp.find_first_of("-"))), 0b11000u);
+  temp = readFile("/proc/sys/kernel/osrelease", &temp) ? trim(temp) : rooted ? "" : trim(runCommand("uname -r"));
+  if (!temp.empty())
+  {
+    kernel = SemVer(temp.substr(0, temp.find_first_of("-")), 0b11000u);
+  }
 
-  temp = runCommand("stat -c %y /var/cache/apt");
-  installTime.tm_year = std::stoi(temp.substr(0, 4)) - 1900;
-  installTime.tm_mon = std::stoi(temp.substr(5, 2)) - 1;
-  installTime.tm_mday = std::stoi(temp.substr(8, 2));
-  installTime.tm_hour = std::stoi(temp.substr(11, 2));
-  installTime.tm_min = std::stoi(temp.substr(14, 2));
-  installTime.tm_sec = std::stoi(temp.substr(17, 2));
+  if (statPath("/var/cache/apt", &st))
+  {
+    t = st.st_mtime;
+    installTime = (*std::localtime(&t));
+  }
 
-  temp = runCommand("uptime -s");
-  bootTime.tm_year = std::stoi(temp.substr(0, 4)) - 1900;
-  bootTime.tm_mon = std::stoi(temp.substr(5, 2)) - 1;
-  bootTime.tm_mday = std::stoi(temp.substr(8, 2));
-  bootTime.tm_hour = std::stoi(temp.substr(11, 2));
-  bootTime.tm_min = std::stoi(temp.substr(14, 2));
-  bootTime.tm_sec = std::stoi(temp.substr(17, 2));
+  if (readFile("/proc/stat", &temp) && temp.find("\nbtime ") != std::string::npos)
+  {
+    t = std::stoll(temp.substr(temp.find("\nbtime ") + 7));
+    bootTime = (*std::localtime(&t));
+  }
 
+  t = std::time(0);
   curTime = (*std::localtime(&t));
 }
 #pragma endregion "Constructors' Assistants"
 
 #pragma region "Operators"
 /**
-* @brief Reserves memory for a new OperatingSystem object
-*
-* @param  size  The amount of memory to allocate
-* @return void* A pointer to the allocated memory
-*/
-void *OperatingSystem::operator new(std::size_t size)
-{
-  void *o = ::new (OperatingSystem);
-  return o;
-}
-
-/**
-* @brief Sets equal two OperatingSystem objects
+* @brief Moves another OperatingSystem object into this one
 *
-* @param o The OperatingSystem object to copy from
+* @param o The OperatingSystem object to move from
 */
-void OperatingSystem::operator=(const OperatingSystem &o)
+void OperatingSystem::operator=(OperatingSystem &&o)
 {
   if (&o == this)
   {
     return;
   }
-  platform = o.platform;
-  caption = o.caption;
-  serial = o.serial;
+  platform = std::move(o.platform);
+  caption = std::move(o.caption);
+  serial = std::move(o.serial);
   bit = o.bit;
   installTime = o.installTime;
   bootTime = o.bootTime;
   curTime = o.curTime;
-  kernel = o.kernel;
-  version = o.version;
-}
-
-/**
-* @brief Sets one OperatingSystem equal to another
-*
-* @param o The OperatingSystem to copy from
-*/
-void OperatingSystem::operator=(OperatingSystem *o)
-{
-  platform = o->platform;
-  caption = o->caption;
-  serial = o->serial;
-  bit = o->bit;
-  installTime = o->installTime;
-  bootTime = o->bootTime;
-  curTime = o->curTime;
-  kernel = o->kernel;
-  version = o->version;
+  kernel = std::move(o.kernel);
+  version = std::move(o.version);
 }
 #pragma endregion "Operators"
 
@@ -369,6 +376,7 @@ std::string getTempDir()
 */
 std::string runCommand(const std::string &cmd)
 {
+  SourceTiming timing(cmd, true);
   std::array<char, 128> buffer;
   std::string result;
   std::unique_ptr<FILE, decltype(&P_PCLOSE)> pipe(P_POPEN(cmd.c_str(), "r"), P_PCLOSE);
@@ -376,6 +384,7 @@ std::string runCommand(const std::string &cmd)
   {
     result += buffer.data();
   }
+  timing.Read(result.size());
 
   return result;
 }
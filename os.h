@@ -114,10 +114,10 @@ private:
 public:
   OperatingSystem();
   OperatingSystem(std::uint8_t plt);
-  OperatingSystem(const OperatingSystem &o);
-  void *operator new(std::size_t size);
-  void operator=(const OperatingSystem &o);
-  void operator=(OperatingSystem *o);
+  OperatingSystem(const OperatingSystem &o) = delete;
+  OperatingSystem(OperatingSystem &&o);
+  void operator=(const OperatingSystem &o) = delete;
+  void operator=(OperatingSystem &&o);
   std::string platform;
   std::string caption;
   std::string serial;
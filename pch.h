@@ -12,16 +12,23 @@
 #define CGOGGLES_PCH_H_
 
 #include <cassert>
+#include <cctype>
 #include <cmath>
+#include <csignal>
+#include <cstddef>
 #include <cstdio>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <exception>
 #include <fstream>
+#include <functional>
 #include <initializer_list>
 #include <iomanip>
 #include <iostream>
@@ -31,7 +38,10 @@
 #include <regex>
 #include <set>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <thread>
 #include <vector>
 
 #endif // CGOGGLES_PCH_H_
@@ -0,0 +1,284 @@
+/**
+*  @file      pressurestats.cpp
+*  @brief     The implementation for the PressureStats class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "pressurestats.h"
+#include "os.h"
+
+#if CGOGGLES_OS != OS_WIN
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new, unsampled PressureStats object with no triggers
+*/
+PressureStats::PressureStats()
+{
+  triggers = std::vector<int>();
+  samples = 0;
+  for (std::size_t k = 0; k < pressureKinds; ++k)
+  {
+    for (std::size_t l = 0; l < pressureLines; ++l)
+    {
+      lines[k][l].present = false;
+      lines[k][l].avg.fill(0);
+      lines[k][l].total = 0;
+    }
+  }
+}
+
+/**
+* @brief Construct a new PressureStats object with help from the assistants
+*
+* @param plt The platform of the system
+*/
+PressureStats::PressureStats(std::uint8_t plt) : PressureStats()
+{
+  switch (plt)
+  {
+  case OS_WIN:
+    GetWin();
+    break;
+  case OS_MAC:
+    GetMac();
+    break;
+  case OS_LUX:
+    GetLux();
+    break;
+  }
+}
+
+/**
+* @brief Construct a new PressureStats object from another PressureStats object
+*
+* @param o The PressureStats object to move from
+*/
+PressureStats::PressureStats(PressureStats &&o)
+{
+  files = std::move(o.files);
+  triggers = std::move(o.triggers);
+  samples = o.samples;
+  lines = o.lines;
+  o.triggers.clear();
+}
+
+/**
+* @brief Destroy the PressureStats object, disarming any triggers
+*/
+PressureStats::~PressureStats()
+{
+  Close();
+}
+#pragma endregion "Constructors"
+
+#pragma region "Constructors' Assistants"
+/**
+* @brief Fills in the pressure sources for Darwin systems, which has none
+*/
+void PressureStats::GetMac() {}
+
+/**
+* @brief Fills in the pressure sources for Windows systems, which has none
+*/
+void PressureStats::GetWin() {}
+
+/**
+* @brief Fills in the pressure sources for Linux systems
+*/
+void PressureStats::GetLux()
+{
+  for (std::size_t k = 0; k < pressureKinds; ++k)
+  {
+    files[k] = SourceFile(std::string("/proc/pressure/") + pressureSources[k]);
+  }
+}
+
+/**
+* @brief Takes a sample of each pressure file in a single pass each
+*/
+void PressureStats::SampleLux()
+{
+  const char *word;
+  std::size_t line;
+  std::uint64_t whole;
+
+  for (std::size_t k = 0; k < pressureKinds; ++k)
+  {
+    if (!files[k].Read())
+    {
+      continue;
+    }
+    // Each line is like "some avg10=1.94 avg60=3.39 avg300=8.71 total=1447238437", where the averages have two decimals
+    Scanner scan(files[k].Data(), files[k].Size());
+    for (; !scan.Done(); scan.SkipLine())
+    {
+      line = scan.Match("some") ? 0 : scan.Match("full") ? 1 : pressureLines;
+      if (line == pressureLines)
+      {
+        continue;
+      }
+      PressureLine &cur = lines[k][line];
+      for (std::size_t a = 0; a < pressureAverages; ++a)
+      {
+        scan.Until('=', &word);
+        whole = scan.Number();
+        cur.avg[a] = whole + (scan.Match(".") ? scan.Number() / 100.0 : 0);
+      }
+      scan.Until('=', &word);
+      cur.total = scan.Number();
+      cur.present = true;
+    }
+  }
+  ++samples;
+}
+
+/**
+* @brief Disarms every trigger
+*/
+void PressureStats::Close()
+{
+#if CGOGGLES_OS != OS_WIN
+  for (std::size_t i = 0; i < triggers.size(); ++i)
+  {
+    close(triggers[i]);
+  }
+#endif
+  triggers.clear();
+}
+#pragma endregion "Constructors' Assistants"
+
+#pragma region "Operators"
+/**
+* @brief Moves another PressureStats object into this one
+*
+* @param o The PressureStats object to move from
+*/
+void PressureStats::operator=(PressureStats &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  Close();
+  files = std::move(o.files);
+  triggers = std::move(o.triggers);
+  samples = o.samples;
+  lines = o.lines;
+  o.triggers.clear();
+}
+#pragma endregion "Operators"
+
+#pragma region "Methods"
+/**
+* @brief Takes a sample of each pressure file
+*/
+void PressureStats::Sample()
+{
+  SampleLux();
+}
+
+/**
+* @brief Checks whether or not there has been a sample
+*
+* @return true  The averages and totals have been read
+* @return false The averages and totals have NOT been read yet
+*/
+bool PressureStats::Ready()
+{
+  return samples >= 1;
+}
+
+/**
+* @brief Arms a trigger, which the kernel signals once per window whenever tasks stall for longer than a threshold in it
+*
+* @param  kind   The index of the resource in pressureSources
+* @param  line   The index of the line in pressureLineNames
+* @param  stall  The stall in the window which fires the trigger, in milliseconds
+* @param  window The window, in milliseconds, from 500 ms to 10 s
+* @return true   The trigger was armed
+* @return false  The trigger could NOT be armed, and errno says why
+*/
+bool PressureStats::Arm(const std::size_t &kind, const std::size_t &line, const std::uint32_t &stall, const std::uint32_t &window)
+{
+#if CGOGGLES_OS != OS_WIN
+  char spec[64];
+  int len = std::snprintf(spec, sizeof(spec), "%s %llu %llu", line == 0 ? "some" : "full", stall * 1000ull, window * 1000ull);
+  // The kernel reads the trigger from the real /proc, so a sysroot is never used here
+  int fd = open((std::string("/proc/pressure/") + pressureSources[kind]).c_str(), O_RDWR | O_NONBLOCK | O_CLOEXEC);
+
+  if (fd < 0)
+  {
+    return false;
+  }
+  if (write(fd, spec, len + 1) < 0)
+  {
+    int err = errno;
+    close(fd);
+    errno = err;
+    return false;
+  }
+  triggers.push_back(fd);
+  return true;
+#else
+  return false;
+#endif
+}
+
+/**
+* @brief Checks whether or not any trigger is armed
+*
+* @return true  There is a trigger to wait on
+* @return false There are no triggers
+*/
+bool PressureStats::Armed()
+{
+  return !triggers.empty();
+}
+
+/**
+* @brief Waits, without polling, for any trigger to fire
+*
+* @param  timeout The most milliseconds to wait, or -1 to wait until one fires
+* @return true    A trigger fired
+* @return false   The wait timed out, or was interrupted by a signal
+*/
+bool PressureStats::Wait(const int &timeout)
+{
+#if CGOGGLES_OS != OS_WIN
+  std::vector<pollfd> fds(triggers.size());
+  bool fired = false;
+
+  for (std::size_t i = 0; i < triggers.size(); ++i)
+  {
+    fds[i].fd = triggers[i];
+    fds[i].events = POLLPRI;
+    fds[i].revents = 0;
+  }
+  if (poll(fds.data(), fds.size(), timeout) <= 0)
+  {
+    return false;
+  }
+  for (std::size_t i = 0; i < fds.size(); ++i)
+  {
+    if (fds[i].revents & POLLERR)
+    {
+      throw std::runtime_error("a pressure trigger was disarmed by the kernel");
+    }
+    fired = fired || (fds[i].revents & POLLPRI);
+  }
+  return fired;
+#else
+  return false;
+#endif
+}
+#pragma endregion "Methods"
@@ -0,0 +1,94 @@
+/**
+*  @file      pressurestats.h
+*  @brief     The interface for the PressureStats class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_PRESSURESTATS_H_
+#define CGOGGLES_PRESSURESTATS_H_
+
+#include "pch.h"
+#include "sourcefile.h"
+
+/**
+* @brief The number of resources with a pressure file
+*/
+const std::size_t pressureKinds = 3;
+
+/**
+* @brief The resources with a pressure file, named as in the keys
+*/
+const char *const pressureNames[pressureKinds] = {"CPU", "Memory", "IO"};
+
+/**
+* @brief The resources with a pressure file, named as in /proc/pressure
+*/
+const char *const pressureSources[pressureKinds] = {"cpu", "memory", "io"};
+
+/**
+* @brief The number of lines in a pressure file, for some and all of the tasks stalling
+*/
+const std::size_t pressureLines = 2;
+
+/**
+* @brief The lines in a pressure file, named as in the keys
+*/
+const char *const pressureLineNames[pressureLines] = {"Some", "Full"};
+
+/**
+* @brief The number of running averages on each line
+*/
+const std::size_t pressureAverages = 3;
+
+/**
+* @brief The running averages on each line, named as in the keys
+*/
+const char *const pressureAverageNames[pressureAverages] = {"Avg10", "Avg60", "Avg300"};
+
+/**
+* @brief Represents a single line of a pressure file
+*/
+class PressureLine
+{
+public:
+  bool present;
+  std::array<double, pressureAverages> avg;
+  std::uint64_t total;
+};
+
+/**
+* @brief Represents the stall pressure on a computer's CPU, memory and I/O, and any triggers armed on it
+*/
+class PressureStats
+{
+private:
+  std::array<SourceFile, pressureKinds> files;
+  std::vector<int> triggers;
+  std::size_t samples;
+  void GetMac();
+  void GetWin();
+  void GetLux();
+  void SampleLux();
+  void Close();
+
+public:
+  PressureStats();
+  PressureStats(std::uint8_t plt);
+  PressureStats(const PressureStats &o) = delete;
+  PressureStats(PressureStats &&o);
+  void operator=(const PressureStats &o) = delete;
+  void operator=(PressureStats &&o);
+  ~PressureStats();
+  void Sample();
+  bool Ready();
+  bool Arm(const std::size_t &kind, const std::size_t &line, const std::uint32_t &stall, const std::uint32_t &window);
+  bool Armed();
+  bool Wait(const int &timeout);
+  std::array<std::array<PressureLine, pressureLines>, pressureKinds> lines;
+};
+
+#endif // CGOGGLES_PRESSURESTATS_H_
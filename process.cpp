@@ -0,0 +1,88 @@
+/**
+*  @file      process.cpp
+*  @brief     The implementation for the Process class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "process.h"
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new Process object
+*/
+Process::Process()
+{
+  pid = 0;
+  name = "";
+  state = "";
+  threads = 0;
+  cpu = 0.0;
+  rss = 0;
+  io = 0.0;
+}
+
+/**
+* @brief Construct a new Process object with values
+*
+* @param id  The process ID
+* @param nm  The command name
+* @param st  The scheduler state
+* @param thr The number of threads
+* @param cp  The CPU usage as a percentage of one CPU
+* @param rs  The resident set size in bytes
+* @param i   The bytes read from and written to storage per second
+*/
+Process::Process(std::uint32_t id, std::string nm, std::string st, std::uint32_t thr, double cp, std::uint64_t rs, double i)
+{
+  pid = id;
+  name = std::move(nm);
+  state = std::move(st);
+  threads = thr;
+  cpu = cp;
+  rss = rs;
+  io = i;
+}
+
+/**
+* @brief Construct a new Process object with values from another Process object
+*
+* @param o The other Process object to move from
+*/
+Process::Process(Process &&o)
+{
+  pid = o.pid;
+  name = std::move(o.name);
+  state = std::move(o.state);
+  threads = o.threads;
+  cpu = o.cpu;
+  rss = o.rss;
+  io = o.io;
+}
+#pragma endregion "Constructors"
+
+#pragma region "Operators"
+/**
+* @brief Moves another Process object into this one
+*
+* @param o The Process object to move from
+*/
+void Process::operator=(Process &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  pid = o.pid;
+  name = std::move(o.name);
+  state = std::move(o.state);
+  threads = o.threads;
+  cpu = o.cpu;
+  rss = o.rss;
+  io = o.io;
+}
+#pragma endregion "Operators"
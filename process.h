@@ -0,0 +1,37 @@
+/**
+*  @file      process.h
+*  @brief     The interface for the Process class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_PROCESS_H_
+#define CGOGGLES_PROCESS_H_
+
+#include "pch.h"
+
+/**
+* @brief Represents a running process
+*/
+class Process
+{
+public:
+  Process();
+  Process(std::uint32_t id, std::string nm, std::string st, std::uint32_t thr, double cp, std::uint64_t rs, double i);
+  Process(const Process &o) = delete;
+  Process(Process &&o);
+  void operator=(const Process &o) = delete;
+  void operator=(Process &&o);
+  std::uint32_t pid;
+  std::string name;
+  std::string state;
+  std::uint32_t threads;
+  double cpu;
+  std::uint64_t rss;
+  double io;
+};
+
+#endif // CGOGGLES_PROCESS_H_
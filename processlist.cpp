@@ -0,0 +1,454 @@
+/**
+*  @file      processlist.cpp
+*  @brief     The implementation for the ProcessList class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "processlist.h"
+#include "os.h"
+#include "sourcefile.h"
+#include "sysroot.h"
+#include "timings.h"
+
+#if CGOGGLES_OS != OS_WIN
+#include <fcntl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+* @brief The fewest processes worth handing to a worker thread of their own
+*/
+const std::size_t procPerWorker = 1024;
+
+/**
+* @brief The keys read from /proc/[pid]/io, which are both summed into the storage I/O
+*/
+static const ScanKey ioKeys[] = {ScanKey("read_bytes:", 0), ScanKey("write_bytes:", 0)};
+
+/**
+* @brief Gets the value a process is ranked by
+*
+* @param  s      The process
+* @param  metric The index of the ranking in procRankings
+* @return double The value to rank by
+*/
+static double rankOf(const ProcessSample &s, const std::size_t &metric)
+{
+  return metric == 0 ? s.cpu : metric == 1 ? s.rss : s.ioRate;
+}
+
+#if CGOGGLES_OS != OS_WIN
+/**
+* @brief Reads a small file under /proc in a single read
+*
+* @param  proc    The descriptor of /proc
+* @param  path    The path relative to /proc
+* @param  buffer  The buffer to read into
+* @param  size    The size of the buffer
+* @return ssize_t The bytes read, or less than 1 if the process has exited
+*/
+static ssize_t readProc(int proc, const char *path, char *buffer, const std::size_t &size)
+{
+  int fd = openat(proc, path, O_RDONLY | O_CLOEXEC);
+  ssize_t len;
+
+  if (fd < 0)
+  {
+    return -1;
+  }
+  len = read(fd, buffer, size);
+  close(fd);
+  return len;
+}
+
+/**
+* @brief Reads a slice of the processes, and keeps the busiest of them in bounded heaps
+*
+* @param proc    The descriptor of /proc
+* @param pids    The first process ID of the slice
+* @param out     The first sample of the slice, whose pid is left 0 if the process exits
+* @param count   The number of processes in the slice
+* @param prev    The samples from the previous scan, sorted by process ID
+* @param seconds The seconds since the previous scan, or 0 if there was none
+* @param top     The number of processes to keep in each heap
+* @param heaps   The heap for each ranking
+*/
+static void scanProcesses(int proc, const std::uint32_t *pids, ProcessSample *out, std::size_t count, const std::vector<ProcessSample> *prev,
+                          double seconds, std::size_t top, std::array<std::vector<ProcessSample>, procMetrics> *heaps)
+{
+  const double ticksPerSecond = sysconf(_SC_CLK_TCK);
+  const std::uint64_t pageSize = sysconf(_SC_PAGESIZE);
+  const std::size_t ioCount = sizeof(ioKeys) / sizeof(ioKeys[0]);
+  char path[32];
+  char buffer[1024];
+  const char *word;
+  const char *lparen;
+  const char *rparen;
+  ssize_t len;
+  std::int64_t value;
+
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    ProcessSample &s = out[i];
+    s.pid = 0;
+
+    std::snprintf(path, sizeof(path), "%u/stat", pids[i]);
+    len = readProc(proc, path, buffer, sizeof(buffer));
+    lparen = len > 0 ? static_cast<const char *>(std::memchr(buffer, '(', len)) : nullptr;
+    rparen = len > 0 ? static_cast<const char *>(memrchr(buffer, ')', len)) : nullptr;
+    if (lparen == nullptr || rparen == nullptr || rparen < lparen)
+    {
+      continue;
+    }
+
+    // The name may hold spaces and parentheses, so it ends at the last ')'
+    len -= rparen + 1 - buffer;
+    std::size_t nameLen = std::min<std::size_t>(rparen - lparen - 1, sizeof(s.name) - 1);
+    std::memcpy(s.name, lparen + 1, nameLen);
+    s.name[nameLen] = '\0';
+    Scanner scan(rparen + 1, len);
+    s.state = scan.Word(&word) ? *word : '?';
+    s.ticks = 0;
+    for (std::size_t field = 4; field <= 24; ++field)
+    {
+      value = scan.Signed();
+      if (field == 14 || field == 15)
+      {
+        s.ticks += value;
+      }
+      else if (field == 20)
+      {
+        s.threads = value;
+      }
+      else if (field == 22)
+      {
+        s.start = value;
+      }
+      else if (field == 24)
+      {
+        s.rss = value * pageSize;
+      }
+    }
+
+    // Other users' I/O is only readable by root, so it is left as 0
+    s.io = 0;
+    std::snprintf(path, sizeof(path), "%u/io", pids[i]);
+    len = readProc(proc, path, buffer, sizeof(buffer));
+    if (len > 0)
+    {
+      Scanner io(buffer, len);
+      while (!io.Done())
+      {
+        if (io.Lookup(ioKeys, ioCount) < ioCount)
+        {
+          s.io += io.Number();
+        }
+        io.SkipLine();
+      }
+    }
+
+    s.pid = pids[i];
+    s.cpu = 0;
+    s.ioRate = 0;
+    if (seconds > 0)
+    {
+      auto last = std::lower_bound(prev->begin(), prev->end(), s.pid, [](const ProcessSample &p, const std::uint32_t &id) { return p.pid < id; });
+      // A reused process ID starts at a different time, so it isn't compared
+      if (last != prev->end() && last->pid == s.pid && last->start == s.start)
+      {
+        s.cpu = s.ticks > last->ticks ? (s.ticks - last->ticks) / ticksPerSecond / seconds * 100 : 0;
+        s.ioRate = s.io > last->io ? (s.io - last->io) / seconds : 0;
+      }
+    }
+
+    for (std::size_t metric = 0; metric < procMetrics; ++metric)
+    {
+      std::vector<ProcessSample> &heap = (*heaps)[metric];
+      auto greater = [metric](const ProcessSample &a, const ProcessSample &b) { return rankOf(a, metric) > rankOf(b, metric); };
+      if (heap.size() < top)
+      {
+        heap.push_back(s);
+        std::push_heap(heap.begin(), heap.end(), greater);
+      }
+      else if (top > 0 && rankOf(s, metric) > rankOf(heap.front(), metric))
+      {
+        std::pop_heap(heap.begin(), heap.end(), greater);
+        heap.back() = s;
+        std::push_heap(heap.begin(), heap.end(), greater);
+      }
+    }
+  }
+}
+#endif
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new, unsampled ProcessList object
+*/
+ProcessList::ProcessList()
+{
+  proc = -1;
+  top = 0;
+  pids = std::vector<std::uint32_t>();
+  prev = std::vector<ProcessSample>();
+  cur = std::vector<ProcessSample>();
+  prevTime = curTime = 0;
+  samples = 0;
+  count = 0;
+  threads = 0;
+}
+
+/**
+* @brief Construct a new ProcessList object with help from the assistants
+*
+* @param plt The platform of the system
+* @param n   The number of processes to keep in each ranking
+*/
+ProcessList::ProcessList(std::uint8_t plt, const std::size_t &n) : ProcessList()
+{
+  top = n;
+  switch (plt)
+  {
+  case OS_WIN:
+    GetWin();
+    break;
+  case OS_MAC:
+    GetMac();
+    break;
+  case OS_LUX:
+    GetLux();
+    break;
+  }
+}
+
+/**
+* @brief Construct a new ProcessList object from another ProcessList object
+*
+* @param o The ProcessList object to move from
+*/
+ProcessList::ProcessList(ProcessList &&o)
+{
+  proc = o.proc;
+  top = o.top;
+  pids = std::move(o.pids);
+  prev = std::move(o.prev);
+  cur = std::move(o.cur);
+  prevTime = o.prevTime;
+  curTime = o.curTime;
+  samples = o.samples;
+  count = o.count;
+  threads = o.threads;
+  ranked = std::move(o.ranked);
+  o.proc = -1;
+}
+
+/**
+* @brief Destroy the ProcessList object, closing /proc
+*/
+ProcessList::~ProcessList()
+{
+#if CGOGGLES_OS != OS_WIN
+  if (proc >= 0)
+  {
+    close(proc);
+  }
+#endif
+}
+#pragma endregion "Constructors"
+
+#pragma region "Constructors' Assistants"
+/**
+* @brief Fills in the process sources for Darwin systems
+*/
+void ProcessList::GetMac() {}
+
+/**
+* @brief Fills in the process sources for Windows systems
+*/
+void ProcessList::GetWin() {}
+
+/**
+* @brief Fills in the process sources for Linux systems
+*/
+void ProcessList::GetLux()
+{
+  SourceTiming timing("/proc");
+  proc = openPath("/proc", true);
+}
+
+/**
+* @brief Lists the process IDs in /proc, reading the directory in large batches
+*/
+void ProcessList::ListLux()
+{
+#if CGOGGLES_OS != OS_WIN
+  SourceTiming timing("/proc", false, false);
+  char buffer[32768];
+  long len;
+  std::uint32_t pid;
+  const char *name;
+
+  pids.clear();
+  lseek(proc, 0, SEEK_SET);
+  while ((len = syscall(SYS_getdents64, proc, buffer, sizeof(buffer))) > 0)
+  {
+    // Each record is the inode, offset, length and type, followed by the name
+    for (long off = 0; off < len;)
+    {
+      unsigned short reclen;
+      std::memcpy(&reclen, buffer + off + 16, sizeof(reclen));
+      name = buffer + off + 19;
+      off += reclen;
+      if (*name < '1' || *name > '9')
+      {
+        continue;
+      }
+      for (pid = 0; *name >= '0' && *name <= '9'; ++name)
+      {
+        pid = pid * 10 + (*name - '0');
+      }
+      if (*name == '\0')
+      {
+        pids.push_back(pid);
+      }
+    }
+    timing.Read(len);
+  }
+  std::sort(pids.begin(), pids.end());
+#endif
+}
+
+/**
+* @brief Scans every process, splitting them across worker threads, and ranks the busiest
+*/
+void ProcessList::SampleLux()
+{
+#if CGOGGLES_OS != OS_WIN
+  std::size_t workers;
+  std::size_t slice;
+  double seconds;
+  std::vector<std::array<std::vector<ProcessSample>, procMetrics>> heaps;
+  std::vector<std::thread> pool;
+  std::vector<ProcessSample> merged;
+
+  std::swap(prev, cur);
+  prevTime = curTime;
+  curTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  seconds = samples ? (curTime - prevTime) / 1e9 : 0;
+  ListLux();
+  cur.resize(pids.size());
+
+  workers = std::max<std::size_t>(1, std::min<std::size_t>(std::thread::hardware_concurrency(), pids.size() / procPerWorker));
+  slice = (pids.size() + workers - 1) / workers;
+  heaps.resize(workers);
+  for (std::size_t w = 0; w < workers; ++w)
+  {
+    for (std::size_t m = 0; m < procMetrics; ++m)
+    {
+      heaps[w][m].reserve(top);
+    }
+  }
+
+  // Each worker owns a contiguous slice of the sorted IDs, so cur stays sorted
+  for (std::size_t w = 1; w < workers; ++w)
+  {
+    std::size_t begin = std::min(w * slice, pids.size());
+    std::size_t end = std::min(begin + slice, pids.size());
+    pool.emplace_back(scanProcesses, proc, pids.data() + begin, cur.data() + begin, end - begin, &prev, seconds, top, &heaps[w]);
+  }
+  scanProcesses(proc, pids.data(), cur.data(), std::min(slice, pids.size()), &prev, seconds, top, &heaps[0]);
+  for (std::size_t w = 0; w < pool.size(); ++w)
+  {
+    pool[w].join();
+  }
+
+  // Processes which exited mid-scan are dropped
+  cur.erase(std::remove_if(cur.begin(), cur.end(), [](const ProcessSample &s) { return s.pid == 0; }), cur.end());
+  count = cur.size();
+  threads = 0;
+  for (std::size_t i = 0; i < cur.size(); ++i)
+  {
+    threads += cur[i].threads;
+  }
+
+  for (std::size_t m = 0; m < procMetrics; ++m)
+  {
+    merged.clear();
+    for (std::size_t w = 0; w < workers; ++w)
+    {
+      merged.insert(merged.end(), heaps[w][m].begin(), heaps[w][m].end());
+    }
+    std::sort(merged.begin(), merged.end(), [m](const ProcessSample &a, const ProcessSample &b) { return rankOf(a, m) > rankOf(b, m) || (rankOf(a, m) == rankOf(b, m) && a.pid < b.pid); });
+    ranked[m].clear();
+    for (std::size_t i = 0; i < merged.size() && i < top; ++i)
+    {
+      ranked[m].emplace_back(merged[i].pid, merged[i].name, std::string(1, merged[i].state), merged[i].threads, merged[i].cpu, merged[i].rss, merged[i].ioRate);
+    }
+  }
+  ++samples;
+#endif
+}
+#pragma endregion "Constructors' Assistants"
+
+#pragma region "Operators"
+/**
+* @brief Moves another ProcessList object into this one
+*
+* @param o The ProcessList object to move from
+*/
+void ProcessList::operator=(ProcessList &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+#if CGOGGLES_OS != OS_WIN
+  if (proc >= 0)
+  {
+    close(proc);
+  }
+#endif
+  proc = o.proc;
+  top = o.top;
+  pids = std::move(o.pids);
+  prev = std::move(o.prev);
+  cur = std::move(o.cur);
+  prevTime = o.prevTime;
+  curTime = o.curTime;
+  samples = o.samples;
+  count = o.count;
+  threads = o.threads;
+  ranked = std::move(o.ranked);
+  o.proc = -1;
+}
+#pragma endregion "Operators"
+
+#pragma region "Methods"
+/**
+* @brief Scans every process, keeping the previous scan to compare against
+*/
+void ProcessList::Sample()
+{
+  if (proc >= 0)
+  {
+    SampleLux();
+  }
+}
+
+/**
+* @brief Checks whether or not there are two comparable scans
+*
+* @return true  The CPU and I/O rankings can be computed
+* @return false The CPU and I/O rankings can NOT be computed yet
+*/
+bool ProcessList::Ready()
+{
+  return samples >= 2 && curTime > prevTime;
+}
+#pragma endregion "Methods"
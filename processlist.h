@@ -0,0 +1,80 @@
+/**
+*  @file      processlist.h
+*  @brief     The interface for the ProcessList class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_PROCESSLIST_H_
+#define CGOGGLES_PROCESSLIST_H_
+
+#include "pch.h"
+#include "process.h"
+
+/**
+* @brief The number of metrics that processes are ranked by
+*/
+const std::size_t procMetrics = 3;
+
+/**
+* @brief The names of the rankings, by CPU usage, resident set size and storage I/O
+*/
+const char *const procRankings[procMetrics] = {"TopCPU", "TopRSS", "TopIO"};
+
+/**
+* @brief Represents what a single scan of /proc reads for a process, kept without allocating
+*/
+class ProcessSample
+{
+public:
+  std::uint32_t pid;
+  char state;
+  char name[16];
+  std::uint32_t threads;
+  std::uint64_t start;
+  std::uint64_t ticks;
+  std::uint64_t rss;
+  std::uint64_t io;
+  double cpu;
+  double ioRate;
+};
+
+/**
+* @brief Represents a computer's processes, and the busiest of them between two samples
+*/
+class ProcessList
+{
+private:
+  int proc;
+  std::size_t top;
+  std::vector<std::uint32_t> pids;
+  std::vector<ProcessSample> prev;
+  std::vector<ProcessSample> cur;
+  std::uint64_t prevTime;
+  std::uint64_t curTime;
+  std::size_t samples;
+  void GetMac();
+  void GetWin();
+  void GetLux();
+  void ListLux();
+  void SampleLux();
+
+public:
+  ProcessList();
+  ProcessList(std::uint8_t plt, const std::size_t &n);
+  ProcessList(const ProcessList &o) = delete;
+  ProcessList(ProcessList &&o);
+  void operator=(const ProcessList &o) = delete;
+  void operator=(ProcessList &&o);
+  ~ProcessList();
+  void Sample();
+  bool Ready();
+  std::uint64_t count;
+  std::uint64_t threads;
+  std::array<std::vector<Process>, procMetrics> ranked;
+};
+
+#endif // CGOGGLES_PROCESSLIST_H_
@@ -13,6 +13,7 @@
 #include "temperature.h"
 #include "os.h"
 #include "utils.h"
+#include "sysroot.h"
 
 #pragma region "Constructors"
 /**
@@ -31,6 +32,8 @@ Processor::Processor()
   threads = 0;
   speed = 0;
   maxSpeed = 0;
+  hypervisor = false;
+  features = std::vector<std::string>();
 }
 
 /**
@@ -38,7 +41,7 @@ Processor::Processor()
 *
 * @param plt The platform of the system
 */
-Processor::Processor(std::uint8_t plt)
+Processor::Processor(std::uint8_t plt) : Processor()
 {
   switch (CGOGGLES_OS)
   {
@@ -52,19 +55,45 @@ Processor::Processor(std::uint8_t plt)
     GetLux();
     break;
   }
+
+  // CPUID is read straight from the processor, so it takes precedence over what the OS reports, unless that is another system's root
+  ProcessorId id;
+  if (id.supported && activeSysroot() == nullptr)
+  {
+    manufacturer = id.vendor;
+    brand = id.brand;
+    if (brand.find("@") != std::string::npos)
+    {
+      brand.erase(brand.find_first_of("@"));
+    }
+    trim(&brand);
+    family = id.family;
+    model = id.model;
+    stepping = id.stepping;
+    hypervisor = id.hypervisor;
+    features = std::move(id.features);
+  }
+
+  // The topology counts the threads actually online, rather than multiplying out lscpu's per-socket figures
+  topology = ProcessorTopology(plt);
+  if (topology.threads > 0)
+  {
+    cores = topology.cores.size();
+    threads = topology.threads;
+  }
 }
 
 /**
 * @brief Construct a new Processor object from another Processor object
 *
-* @param o The Processor object to copy from
+* @param o The Processor object to move from
 */
-Processor::Processor(const Processor &o)
+Processor::Processor(Processor &&o)
 {
-  manufacturer = o.manufacturer;
-  architecture = o.architecture;
-  socketType = o.socketType;
-  brand = o.brand;
+  manufacturer = std::move(o.manufacturer);
+  architecture = std::move(o.architecture);
+  socketType = std::move(o.socketType);
+  brand = std::move(o.brand);
   family = o.family;
   model = o.model;
   stepping = o.stepping;
@@ -72,6 +101,9 @@ Processor::Processor(const Processor &o)
   threads = o.threads;
   speed = o.speed;
   maxSpeed = o.maxSpeed;
+  topology = std::move(o.topology);
+  hypervisor = o.hypervisor;
+  features = std::move(o.features);
 }
 #pragma endregion "Constructors"
 
@@ -116,8 +148,8 @@ void Processor::GetWin()
   std::map<std::string, std::string> dataMap = runMultiWmic("cpu get Manufacturer,NumberOfCores,NumberOfLogicalProcessors,Architecture,UpgradeMethod,Name,Description,MaxClockSpeed,MaxClockSpeed", &wmic);
   std::string temp;
   std::smatch mt;
-  std::string *architectureMap = new std::string[10]{"x86", "MIPS", "Alpha", "PowerPC", "Unknown", "ARM", "ia64", "Unknown", "Unknown", "x64"};
-  std::string *socketTypeMap = new std::string[61]{
+  std::string architectureMap[10] = {"x86", "MIPS", "Alpha", "PowerPC", "Unknown", "ARM", "ia64", "Unknown", "Unknown", "x64"};
+  std::string socketTypeMap[61] = {
       "Unknown",
       "Other",
       "Unknown",
@@ -204,9 +236,6 @@ void Processor::GetWin()
 
   maxSpeed = std::round(std::stof(dataMap["MaxClockSpeed"]) / 10) * pow(10, 7);
   speed = std::round(std::stof(dataMap["MaxClockSpeed"]) / 10) * pow(10, 7);
-
-  delete[] architectureMap;
-  delete[] socketTypeMap;
 }
 
 /**
@@ -214,7 +243,28 @@ void Processor::GetWin()
 */
 void Processor::GetLux()
 {
+  std::string sysroot = activeSysroot() != nullptr ? " --sysroot " + shellQuote(activeSysroot()->Path()) + " 2>/dev/null" : "";
   std::string temp;
+
+  ParseLux(runCommand("export LC_ALL=C; lscpu" + sysroot + "; unset LC_ALL"));
+  // lscpu only reports the maximum on most systems, while cpufreq knows the current speed, in kHz
+  if (readFile("/sys/devices/system/cpu/cpu0/cpufreq/scaling_cur_freq", &temp) && !trim(temp).empty())
+  {
+    speed = std::stoull(temp) * 1000;
+  }
+  if (readFile("/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_max_freq", &temp) && !trim(temp).empty())
+  {
+    maxSpeed = std::stoull(temp) * 1000;
+  }
+}
+
+/**
+* @brief Fills in the processor information from the output of lscpu
+*
+* @param text The output of lscpu
+*/
+void Processor::ParseLux(const std::string &text)
+{
   std::vector<std::string> tempLines;
   std::map<std::string, std::string> dataMap;
   std::string key;
@@ -223,8 +273,7 @@ void Processor::GetLux()
   std::string mapTry;
   std::string mapTry2;
 
-  temp = runCommand("export LC_ALL=C; lscpu; unset LC_ALL");
-  splitStringVector(temp, "\n", &tempLines);
+  splitStringVector(text, "\n", &tempLines);
   for (std::size_t i = 0; i < tempLines.size(); ++i)
   {
     line = trim(tempLines[i]);
@@ -253,9 +302,9 @@ void Processor::GetLux()
   }
   trim(&brand);
 
-  family = std::stoi(tryGetValue<std::string, std::string>(dataMap, "CPU family", &mapTry) ? mapTry : 0);
-  model = std::stoi(tryGetValue<std::string, std::string>(dataMap, "Model", &mapTry) ? mapTry : 0);
-  stepping = std::stoi(tryGetValue<std::string, std::string>(dataMap, "Stepping", &mapTry) ? mapTry : 0);
+  family = std::stoi(tryGetValue<std::string, std::string>(dataMap, "CPU family", &mapTry) ? mapTry : "0");
+  model = std::stoi(tryGetValue<std::string, std::string>(dataMap, "Model", &mapTry) ? mapTry : "0");
+  stepping = std::stoi(tryGetValue<std::string, std::string>(dataMap, "Stepping", &mapTry) ? mapTry : "0");
 
   if (tryGetValue<std::string, std::string>(dataMap, "CPU MHz", &mapTry))
   {
@@ -272,32 +321,20 @@ void Processor::GetLux()
 
 #pragma region "Operators"
 /**
-* @brief Reserves memory for a new Processor object
+* @brief Moves another Processor object into this one
 *
-* @param  size  The amount of memory to allocate
-* @return void* A pointer to the allocated memory
+* @param o The Processor object to move from
 */
-void *Processor::operator new(std::size_t size)
-{
-  void *o = ::new (Processor);
-  return o;
-}
-
-/**
-* @brief Sets equal two Processor objects
-*
-* @param o The Processor object to copy from
-*/
-void Processor::operator=(const Processor &o)
+void Processor::operator=(Processor &&o)
 {
   if (&o == this)
   {
     return;
   }
-  manufacturer = o.manufacturer;
-  architecture = o.architecture;
-  socketType = o.socketType;
-  brand = o.brand;
+  manufacturer = std::move(o.manufacturer);
+  architecture = std::move(o.architecture);
+  socketType = std::move(o.socketType);
+  brand = std::move(o.brand);
   family = o.family;
   model = o.model;
   stepping = o.stepping;
@@ -305,25 +342,8 @@ void Processor::operator=(const Processor &o)
   threads = o.threads;
   speed = o.speed;
   maxSpeed = o.maxSpeed;
-}
-
-/**
-* @brief Sets one Processor equal to another
-*
-* @param o The Processor to copy from
-*/
-void Processor::operator=(Processor *o)
-{
-  manufacturer = o->manufacturer;
-  architecture = o->architecture;
-  socketType = o->socketType;
-  brand = o->brand;
-  family = o->family;
-  model = o->model;
-  stepping = o->stepping;
-  cores = o->cores;
-  threads = o->threads;
-  speed = o->speed;
-  maxSpeed = o->maxSpeed;
+  topology = std::move(o.topology);
+  hypervisor = o.hypervisor;
+  features = std::move(o.features);
 }
 #pragma endregion "Operators"
@@ -13,6 +13,8 @@
 
 #include "pch.h"
 #include "temperature.h"
+#include "processortopology.h"
+#include "processorid.h"
 
 /**
 * @brief Represents a computer's central processing unit
@@ -27,21 +29,25 @@ private:
 public:
   Processor();
   Processor(std::uint8_t plt);
-  Processor(const Processor &o);
-  void *operator new(std::size_t size);
-  void operator=(const Processor &o);
-  void operator=(Processor *o);
+  Processor(const Processor &o) = delete;
+  Processor(Processor &&o);
+  void operator=(const Processor &o) = delete;
+  void operator=(Processor &&o);
+  void ParseLux(const std::string &text);
   std::string manufacturer;
   std::string architecture;
   std::string socketType;
   std::string brand;
-  std::uint8_t family;
-  std::uint8_t model;
-  std::uint8_t stepping;
-  std::uint8_t cores;
-  std::uint8_t threads;
+  std::uint32_t family;
+  std::uint32_t model;
+  std::uint32_t stepping;
+  std::uint32_t cores;
+  std::uint32_t threads;
   std::uint64_t speed;
   std::uint64_t maxSpeed;
+  ProcessorTopology topology;
+  bool hypervisor;
+  std::vector<std::string> features;
 };
 
 #endif // COGGLES_PROCESSOR_H_
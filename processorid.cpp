@@ -0,0 +1,346 @@
+/**
+*  @file      processorid.cpp
+*  @brief     The implementation for the ProcessorId class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "processorid.h"
+#include "utils.h"
+
+#if CGOGGLES_CPUID
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+/**
+* @brief The registers CPUID fills in, in the order they are kept
+*/
+enum Register : std::uint8_t
+{
+  EAX,
+  EBX,
+  ECX,
+  EDX
+};
+
+/**
+* @brief The XCR0 bits the OS must set before AVX registers may be used
+*/
+const std::uint64_t xcrYmm = 0x6;
+
+/**
+* @brief The XCR0 bits the OS must set before AVX-512 registers may be used
+*/
+const std::uint64_t xcrZmm = 0xe6;
+
+/**
+* @brief The XCR0 bits the OS must set before AMX tiles may be used
+*/
+const std::uint64_t xcrTile = 0x60000;
+
+/**
+* @brief Represents where CPUID reports a single feature, and what the OS must enable to use it
+*/
+class ProcessorFeature
+{
+public:
+  std::uint32_t leaf;
+  std::uint32_t subleaf;
+  Register reg;
+  std::uint8_t bit;
+  std::uint64_t xcr;
+  const char *name;
+};
+
+/**
+* @brief The features reported, named as the Linux kernel names them in /proc/cpuinfo
+*/
+static const ProcessorFeature processorFeatures[] = {
+    {1, 0, EDX, 4, 0, "tsc"},
+    {1, 0, EDX, 15, 0, "cmov"},
+    {1, 0, EDX, 23, 0, "mmx"},
+    {1, 0, EDX, 25, 0, "sse"},
+    {1, 0, EDX, 26, 0, "sse2"},
+    {1, 0, EDX, 28, 0, "ht"},
+    {1, 0, ECX, 0, 0, "pni"},
+    {1, 0, ECX, 1, 0, "pclmulqdq"},
+    {1, 0, ECX, 9, 0, "ssse3"},
+    {1, 0, ECX, 12, xcrYmm, "fma"},
+    {1, 0, ECX, 13, 0, "cx16"},
+    {1, 0, ECX, 19, 0, "sse4_1"},
+    {1, 0, ECX, 20, 0, "sse4_2"},
+    {1, 0, ECX, 22, 0, "movbe"},
+    {1, 0, ECX, 23, 0, "popcnt"},
+    {1, 0, ECX, 25, 0, "aes"},
+    {1, 0, ECX, 26, 0, "xsave"},
+    {1, 0, ECX, 28, xcrYmm, "avx"},
+    {1, 0, ECX, 29, 0, "f16c"},
+    {1, 0, ECX, 30, 0, "rdrand"},
+    {1, 0, ECX, 31, 0, "hypervisor"},
+    {7, 0, EBX, 0, 0, "fsgsbase"},
+    {7, 0, EBX, 3, 0, "bmi1"},
+    {7, 0, EBX, 4, 0, "hle"},
+    {7, 0, EBX, 5, xcrYmm, "avx2"},
+    {7, 0, EBX, 8, 0, "bmi2"},
+    {7, 0, EBX, 9, 0, "erms"},
+    {7, 0, EBX, 11, 0, "rtm"},
+    {7, 0, EBX, 16, xcrZmm, "avx512f"},
+    {7, 0, EBX, 17, xcrZmm, "avx512dq"},
+    {7, 0, EBX, 18, 0, "rdseed"},
+    {7, 0, EBX, 19, 0, "adx"},
+    {7, 0, EBX, 21, xcrZmm, "avx512ifma"},
+    {7, 0, EBX, 23, 0, "clflushopt"},
+    {7, 0, EBX, 24, 0, "clwb"},
+    {7, 0, EBX, 26, xcrZmm, "avx512pf"},
+    {7, 0, EBX, 27, xcrZmm, "avx512er"},
+    {7, 0, EBX, 28, xcrZmm, "avx512cd"},
+    {7, 0, EBX, 29, 0, "sha_ni"},
+    {7, 0, EBX, 30, xcrZmm, "avx512bw"},
+    {7, 0, EBX, 31, xcrZmm, "avx512vl"},
+    {7, 0, ECX, 1, xcrZmm, "avx512vbmi"},
+    {7, 0, ECX, 3, 0, "pku"},
+    {7, 0, ECX, 5, 0, "waitpkg"},
+    {7, 0, ECX, 6, xcrZmm, "avx512_vbmi2"},
+    {7, 0, ECX, 8, 0, "gfni"},
+    {7, 0, ECX, 9, xcrYmm, "vaes"},
+    {7, 0, ECX, 10, xcrYmm, "vpclmulqdq"},
+    {7, 0, ECX, 11, xcrZmm, "avx512_vnni"},
+    {7, 0, ECX, 12, xcrZmm, "avx512_bitalg"},
+    {7, 0, ECX, 14, xcrZmm, "avx512_vpopcntdq"},
+    {7, 0, ECX, 22, 0, "rdpid"},
+    {7, 0, ECX, 27, 0, "movdiri"},
+    {7, 0, ECX, 28, 0, "movdir64b"},
+    {7, 0, EDX, 2, xcrZmm, "avx512_4vnniw"},
+    {7, 0, EDX, 3, xcrZmm, "avx512_4fmaps"},
+    {7, 0, EDX, 4, 0, "fsrm"},
+    {7, 0, EDX, 8, xcrZmm, "avx512_vp2intersect"},
+    {7, 0, EDX, 14, 0, "serialize"},
+    {7, 0, EDX, 22, xcrTile, "amx_bf16"},
+    {7, 0, EDX, 23, xcrZmm, "avx512_fp16"},
+    {7, 0, EDX, 24, xcrTile, "amx_tile"},
+    {7, 0, EDX, 25, xcrTile, "amx_int8"},
+    {7, 1, EAX, 4, xcrYmm, "avx_vnni"},
+    {7, 1, EAX, 5, xcrZmm, "avx512_bf16"},
+    {0x80000001, 0, ECX, 0, 0, "lahf_lm"},
+    {0x80000001, 0, ECX, 5, 0, "abm"},
+    {0x80000001, 0, ECX, 6, 0, "sse4a"},
+    {0x80000001, 0, ECX, 11, xcrYmm, "xop"},
+    {0x80000001, 0, ECX, 16, xcrYmm, "fma4"},
+    {0x80000001, 0, EDX, 20, 0, "nx"},
+    {0x80000001, 0, EDX, 26, 0, "pdpe1gb"},
+    {0x80000001, 0, EDX, 27, 0, "rdtscp"},
+    {0x80000001, 0, EDX, 29, 0, "lm"}};
+
+/**
+* @brief Runs CPUID for a leaf and subleaf
+*
+* @param leaf    The leaf to query
+* @param subleaf The subleaf to query
+* @param regs    The EAX, EBX, ECX and EDX registers it returns
+*/
+static void cpuid(const std::uint32_t &leaf, const std::uint32_t &subleaf, std::uint32_t regs[4])
+{
+#if CGOGGLES_CPUID && defined(_MSC_VER)
+  int out[4];
+  __cpuidex(out, static_cast<int>(leaf), static_cast<int>(subleaf));
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    regs[i] = static_cast<std::uint32_t>(out[i]);
+  }
+#elif CGOGGLES_CPUID
+  __cpuid_count(leaf, subleaf, regs[EAX], regs[EBX], regs[ECX], regs[EDX]);
+#else
+  regs[EAX] = regs[EBX] = regs[ECX] = regs[EDX] = 0;
+#endif
+}
+
+/**
+* @brief Reads the register of the state components the OS has enabled, XCR0
+*
+* @return std::uint64_t The enabled state components
+*/
+static std::uint64_t xgetbv()
+{
+#if CGOGGLES_CPUID && defined(_MSC_VER)
+  return _xgetbv(0);
+#elif CGOGGLES_CPUID
+  std::uint32_t lo, hi;
+  __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+  return (static_cast<std::uint64_t>(hi) << 32) | lo;
+#else
+  return 0;
+#endif
+}
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new ProcessorId object, identifying the processor it runs on
+*/
+ProcessorId::ProcessorId()
+{
+  supported = CGOGGLES_CPUID;
+  vendor = "";
+  brand = "";
+  family = 0;
+  model = 0;
+  stepping = 0;
+  hypervisor = false;
+  features = std::vector<std::string>();
+  if (supported)
+  {
+    Identify();
+    Detect();
+  }
+}
+
+/**
+* @brief Construct a new ProcessorId object from another ProcessorId object
+*
+* @param o The ProcessorId object to move from
+*/
+ProcessorId::ProcessorId(ProcessorId &&o)
+{
+  supported = o.supported;
+  vendor = std::move(o.vendor);
+  brand = std::move(o.brand);
+  family = o.family;
+  model = o.model;
+  stepping = o.stepping;
+  hypervisor = o.hypervisor;
+  features = std::move(o.features);
+}
+#pragma endregion "Constructors"
+
+#pragma region "Constructors' Assistants"
+/**
+* @brief Fills in the vendor, brand string, family, model and stepping
+*/
+void ProcessorId::Identify()
+{
+  std::uint32_t regs[4];
+  std::uint32_t maxExtended;
+  char text[49] = {0};
+
+  cpuid(0, 0, regs);
+  std::memcpy(text, &regs[EBX], 4);
+  std::memcpy(text + 4, &regs[EDX], 4);
+  std::memcpy(text + 8, &regs[ECX], 4);
+  vendor = text;
+
+  cpuid(1, 0, regs);
+  stepping = regs[EAX] & 0xf;
+  model = (regs[EAX] >> 4) & 0xf;
+  family = (regs[EAX] >> 8) & 0xf;
+  // The extended model applies to families 6 and 15, and the extended family only to 15
+  if (family == 0x6 || family == 0xf)
+  {
+    model += ((regs[EAX] >> 16) & 0xf) << 4;
+  }
+  if (family == 0xf)
+  {
+    family += (regs[EAX] >> 20) & 0xff;
+  }
+  hypervisor = (regs[ECX] >> 31) & 1;
+
+  cpuid(0x80000000, 0, regs);
+  maxExtended = regs[EAX];
+  if (maxExtended >= 0x80000004)
+  {
+    for (std::uint32_t i = 0; i < 3; ++i)
+    {
+      cpuid(0x80000002 + i, 0, regs);
+      std::memcpy(text + i * 16, regs, 16);
+    }
+    text[48] = '\0';
+    brand = trim(std::string(text));
+  }
+}
+
+/**
+* @brief Fills in the features which the processor supports and the OS has enabled
+*/
+void ProcessorId::Detect()
+{
+  std::uint32_t regs[4];
+  std::uint32_t maxBasic;
+  std::uint32_t maxExtended;
+  std::uint32_t maxSubleaf = 0;
+  std::uint64_t xcr = 0;
+
+  cpuid(0, 0, regs);
+  maxBasic = regs[EAX];
+  cpuid(0x80000000, 0, regs);
+  maxExtended = regs[EAX];
+  cpuid(1, 0, regs);
+  // XGETBV faults unless the OS has set OSXSAVE, and without it no extended state is enabled
+  if ((regs[ECX] >> 27) & 1)
+  {
+    xcr = xgetbv();
+  }
+  if (maxBasic >= 7)
+  {
+    cpuid(7, 0, regs);
+    maxSubleaf = regs[EAX];
+  }
+
+  for (const ProcessorFeature &feat : processorFeatures)
+  {
+    if ((feat.leaf < 0x80000000 && feat.leaf > maxBasic) || (feat.leaf >= 0x80000000 && feat.leaf > maxExtended) ||
+        (feat.leaf == 7 && feat.subleaf > maxSubleaf))
+    {
+      continue;
+    }
+    cpuid(feat.leaf, feat.subleaf, regs);
+    if (((regs[feat.reg] >> feat.bit) & 1) && (xcr & feat.xcr) == feat.xcr)
+    {
+      features.push_back(feat.name);
+    }
+  }
+}
+#pragma endregion "Constructors' Assistants"
+
+#pragma region "Operators"
+/**
+* @brief Moves another ProcessorId object into this one
+*
+* @param o The ProcessorId object to move from
+*/
+void ProcessorId::operator=(ProcessorId &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  supported = o.supported;
+  vendor = std::move(o.vendor);
+  brand = std::move(o.brand);
+  family = o.family;
+  model = o.model;
+  stepping = o.stepping;
+  hypervisor = o.hypervisor;
+  features = std::move(o.features);
+}
+#pragma endregion "Operators"
+
+#pragma region "Methods"
+/**
+* @brief Checks whether the processor supports a feature, and the OS has enabled it
+*
+* @param  flag  The name of the feature, as in /proc/cpuinfo
+* @return true  The feature may be used
+* @return false The feature is missing or disabled
+*/
+bool ProcessorId::Has(const std::string &flag)
+{
+  // The kernel names SSE3 after its codename, Prescott New Instructions
+  return std::find(features.begin(), features.end(), flag == "sse3" ? "pni" : flag) != features.end();
+}
+#pragma endregion "Methods"
@@ -0,0 +1,51 @@
+/**
+*  @file      processorid.h
+*  @brief     The interface for the ProcessorId class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_PROCESSORID_H_
+#define CGOGGLES_PROCESSORID_H_
+
+#include "pch.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+/**
+* @brief Whether the processor can be identified through the CPUID instruction
+*/
+#define CGOGGLES_CPUID 1
+#else
+#define CGOGGLES_CPUID 0
+#endif
+
+/**
+* @brief Represents the identity and feature flags of the processor, as reported by CPUID
+*/
+class ProcessorId
+{
+private:
+  void Identify();
+  void Detect();
+
+public:
+  ProcessorId();
+  ProcessorId(const ProcessorId &o) = delete;
+  ProcessorId(ProcessorId &&o);
+  void operator=(const ProcessorId &o) = delete;
+  void operator=(ProcessorId &&o);
+  bool Has(const std::string &flag);
+  bool supported;
+  std::string vendor;
+  std::string brand;
+  std::uint32_t family;
+  std::uint32_t model;
+  std::uint32_t stepping;
+  bool hypervisor;
+  std::vector<std::string> features;
+};
+
+#endif // CGOGGLES_PROCESSORID_H_
@@ -0,0 +1,328 @@
+/**
+*  @file      processorpower.cpp
+*  @brief     The implementation for the ProcessorPower class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "processorpower.h"
+#include "os.h"
+#include "sysroot.h"
+#include "utils.h"
+
+/**
+* @brief The starting buffer size of each held counter, which only ever holds a single number
+*/
+const std::size_t counterBytes = 32;
+
+/**
+* @brief Reads a sysfs file holding a single unsigned number
+*
+* @param  path          The path to the file
+* @return std::uint64_t The number in the file, or 0 if it is missing
+*/
+static std::uint64_t readCounter(const std::string &path)
+{
+  std::string text;
+  if (!readFile(path, &text) || trim(text).empty() || !std::isdigit(static_cast<unsigned char>(trim(text)[0])))
+  {
+    return 0;
+  }
+  return std::stoull(text);
+}
+
+/**
+* @brief Re-reads a held sysfs file holding a single unsigned number
+*
+* @param  file          The file to read
+* @return std::uint64_t The number in the file, or 0 if it is missing
+*/
+static std::uint64_t readCounter(SourceFile *file)
+{
+  if (!file->Read())
+  {
+    return 0;
+  }
+  Scanner scan(file->Data(), file->Size());
+  return scan.Number();
+}
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new, unsampled ProcessorPower object
+*/
+ProcessorPower::ProcessorPower()
+{
+  prevTime = curTime = 0;
+  samples = 0;
+  driver = "";
+  boost = "";
+  cores = std::vector<CorePower>();
+}
+
+/**
+* @brief Construct a new ProcessorPower object with help from the assistants
+*
+* @param plt The platform of the system
+*/
+ProcessorPower::ProcessorPower(std::uint8_t plt) : ProcessorPower()
+{
+  switch (plt)
+  {
+  case OS_WIN:
+    GetWin();
+    break;
+  case OS_MAC:
+    GetMac();
+    break;
+  case OS_LUX:
+    GetLux();
+    break;
+  }
+}
+
+/**
+* @brief Construct a new ProcessorPower object from another ProcessorPower object
+*
+* @param o The ProcessorPower object to move from
+*/
+ProcessorPower::ProcessorPower(ProcessorPower &&o)
+{
+  prevTime = o.prevTime;
+  curTime = o.curTime;
+  samples = o.samples;
+  driver = std::move(o.driver);
+  boost = std::move(o.boost);
+  cores = std::move(o.cores);
+}
+#pragma endregion "Constructors"
+
+#pragma region "Constructors' Assistants"
+/**
+* @brief Fills in the power sources for Darwin systems
+*/
+void ProcessorPower::GetMac() {}
+
+/**
+* @brief Fills in the power sources for Windows systems
+*/
+void ProcessorPower::GetWin() {}
+
+/**
+* @brief Fills in the power sources for Linux systems, reading the settings which do not change between samples
+*/
+void ProcessorPower::GetLux()
+{
+  std::vector<std::uint32_t> online;
+  std::string text;
+
+  if (!readFile("/sys/devices/system/cpu/online", &text) || !parseCpuList(text, &online))
+  {
+    return;
+  }
+  driver = readFile("/sys/devices/system/cpu/cpu" + std::to_string(online.empty() ? 0 : online[0]) + "/cpufreq/scaling_driver", &text) ? trim(text) : "";
+  // acpi-cpufreq and amd-pstate expose boost, while intel_pstate inverts it as no_turbo
+  if (readFile("/sys/devices/system/cpu/cpufreq/boost", &text) && !trim(text).empty())
+  {
+    boost = trim(text) == "1" ? "Yes" : "No";
+  }
+  else if (readFile("/sys/devices/system/cpu/intel_pstate/no_turbo", &text) && !trim(text).empty())
+  {
+    boost = trim(text) == "0" ? "Yes" : "No";
+  }
+
+  cores.resize(online.size());
+  for (std::size_t i = 0; i < online.size(); ++i)
+  {
+    CorePower &core = cores[i];
+    core.cpu = online[i];
+    core.dir = "/sys/devices/system/cpu/cpu" + std::to_string(online[i]);
+    // The package counter is shared by every CPU in the package, so it is only summed once per package
+    core.package = readFile(core.dir + "/topology/physical_package_id", &text) && !trim(text).empty() ? std::stoi(text) : -1;
+    core.speed = 0;
+    core.minSpeed = readCounter(core.dir + "/cpufreq/scaling_min_freq") * 1000;
+    core.maxSpeed = readCounter(core.dir + "/cpufreq/scaling_max_freq") * 1000;
+    core.governor = readFile(core.dir + "/cpufreq/scaling_governor", &text) ? trim(text) : "";
+    core.epp = readFile(core.dir + "/cpufreq/energy_performance_preference", &text) ? trim(text) : "";
+    core.coreThrottles = core.packageThrottles = 0;
+
+    // The counters are held open and re-read in place, since a large computer has thousands of them
+    core.speedFile = SourceFile(core.dir + "/cpufreq/scaling_cur_freq", counterBytes);
+    core.coreThrottleFile = SourceFile(core.dir + "/thermal_throttle/core_throttle_count", counterBytes);
+    core.packageThrottleFile = SourceFile(core.dir + "/thermal_throttle/package_throttle_count", counterBytes);
+
+    // The states are numbered from zero, shallowest first
+    while (readFile(core.dir + "/cpuidle/state" + std::to_string(core.idleNames.size()) + "/name", &text))
+    {
+      core.idleFiles.push_back(SourceFile(core.dir + "/cpuidle/state" + std::to_string(core.idleNames.size()) + "/time", counterBytes));
+      core.idleNames.push_back(trim(text));
+    }
+    core.idlePrev.assign(core.idleNames.size(), 0);
+    core.idleCur.assign(core.idleNames.size(), 0);
+  }
+}
+
+/**
+* @brief Takes a sample of each CPU's current frequency, idle state times and throttle counts, through their held files
+*/
+void ProcessorPower::SampleLux()
+{
+  prevTime = curTime;
+  curTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  for (CorePower &core : cores)
+  {
+    core.speed = readCounter(&core.speedFile) * 1000;
+    core.coreThrottles = readCounter(&core.coreThrottleFile);
+    core.packageThrottles = readCounter(&core.packageThrottleFile);
+    std::swap(core.idlePrev, core.idleCur);
+    for (std::size_t j = 0; j < core.idleCur.size(); ++j)
+    {
+      core.idleCur[j] = readCounter(&core.idleFiles[j]);
+    }
+  }
+  ++samples;
+}
+#pragma endregion "Constructors' Assistants"
+
+#pragma region "Operators"
+/**
+* @brief Moves another ProcessorPower object into this one
+*
+* @param o The ProcessorPower object to move from
+*/
+void ProcessorPower::operator=(ProcessorPower &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  prevTime = o.prevTime;
+  curTime = o.curTime;
+  samples = o.samples;
+  driver = std::move(o.driver);
+  boost = std::move(o.boost);
+  cores = std::move(o.cores);
+}
+#pragma endregion "Operators"
+
+#pragma region "Methods"
+/**
+* @brief Takes a sample of the CPUs, keeping the previous one to compare against
+*/
+void ProcessorPower::Sample()
+{
+  if (!cores.empty())
+  {
+    SampleLux();
+  }
+}
+
+/**
+* @brief Checks whether or not there are two comparable samples
+*
+* @return true  The residency can be computed
+* @return false The residency can NOT be computed yet
+*/
+bool ProcessorPower::Ready()
+{
+  return samples >= 2 && curTime > prevTime;
+}
+
+/**
+* @brief Gets the share of time a CPU spent in an idle state between the two samples
+*
+* @param  core   The index of the CPU in cores
+* @param  state  The index of the idle state in the CPU's idleNames
+* @return double The percentage of time spent in the state
+*/
+double ProcessorPower::Residency(const std::size_t &core, const std::size_t &state)
+{
+  if (!Ready() || core >= cores.size() || state >= cores[core].idleCur.size() || cores[core].idleCur[state] < cores[core].idlePrev[state])
+  {
+    return 0;
+  }
+  // The idle times are in microseconds
+  return std::min(100.0, (cores[core].idleCur[state] - cores[core].idlePrev[state]) * 1e5 / (curTime - prevTime));
+}
+
+/**
+* @brief Gets the share of time spent in each CPU's deepest idle state, averaged over the CPUs
+*
+* @return double The percentage of time spent in the deepest idle states
+*/
+double ProcessorPower::DeepestIdle()
+{
+  double sum = 0;
+  std::size_t counted = 0;
+
+  for (std::size_t i = 0; i < cores.size(); ++i)
+  {
+    if (!cores[i].idleCur.empty())
+    {
+      sum += Residency(i, cores[i].idleCur.size() - 1);
+      ++counted;
+    }
+  }
+  return counted ? sum / counted : 0;
+}
+
+/**
+* @brief Gets the distinct governors in use, so a single CPU on powersave stands out
+*
+* @return std::string The governors, separated by commas
+*/
+std::string ProcessorPower::Governors()
+{
+  std::set<std::string> seen;
+  std::string ret;
+
+  for (const CorePower &core : cores)
+  {
+    if (!core.governor.empty() && seen.insert(core.governor).second)
+    {
+      ret += (ret.empty() ? "" : ",") + core.governor;
+    }
+  }
+  return ret;
+}
+
+/**
+* @brief Gets the number of times any core was throttled for heat, since boot
+*
+* @return std::uint64_t The core throttle events, summed over the CPUs
+*/
+std::uint64_t ProcessorPower::CoreThrottles()
+{
+  std::uint64_t sum = 0;
+  for (const CorePower &core : cores)
+  {
+    sum += core.coreThrottles;
+  }
+  return sum;
+}
+
+/**
+* @brief Gets the number of times any package was throttled for heat, since boot
+*
+* @return std::uint64_t The package throttle events, summed over the packages
+*/
+std::uint64_t ProcessorPower::PackageThrottles()
+{
+  std::map<std::int32_t, std::uint64_t> packages;
+  std::uint64_t sum = 0;
+
+  for (const CorePower &core : cores)
+  {
+    packages[core.package] = std::max(packages[core.package], core.packageThrottles);
+  }
+  for (const std::pair<const std::int32_t, std::uint64_t> &package : packages)
+  {
+    sum += package.second;
+  }
+  return sum;
+}
+#pragma endregion "Methods"
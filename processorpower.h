@@ -0,0 +1,75 @@
+/**
+*  @file      processorpower.h
+*  @brief     The interface for the ProcessorPower class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_PROCESSORPOWER_H_
+#define CGOGGLES_PROCESSORPOWER_H_
+
+#include "pch.h"
+#include "sourcefile.h"
+
+/**
+* @brief Represents the frequency scaling, idle states and throttling of a single CPU
+*/
+class CorePower
+{
+public:
+  std::uint32_t cpu;
+  std::int32_t package;
+  std::string dir;
+  std::uint64_t speed;
+  std::uint64_t minSpeed;
+  std::uint64_t maxSpeed;
+  std::string governor;
+  std::string epp;
+  std::uint64_t coreThrottles;
+  std::uint64_t packageThrottles;
+  std::vector<std::string> idleNames;
+  std::vector<std::uint64_t> idlePrev;
+  std::vector<std::uint64_t> idleCur;
+  SourceFile speedFile;
+  SourceFile coreThrottleFile;
+  SourceFile packageThrottleFile;
+  std::vector<SourceFile> idleFiles;
+};
+
+/**
+* @brief Represents a computer's CPU frequencies, governors, idle state residency and throttling between two samples
+*/
+class ProcessorPower
+{
+private:
+  std::uint64_t prevTime;
+  std::uint64_t curTime;
+  std::size_t samples;
+  void GetMac();
+  void GetWin();
+  void GetLux();
+  void SampleLux();
+
+public:
+  ProcessorPower();
+  ProcessorPower(std::uint8_t plt);
+  ProcessorPower(const ProcessorPower &o) = delete;
+  ProcessorPower(ProcessorPower &&o);
+  void operator=(const ProcessorPower &o) = delete;
+  void operator=(ProcessorPower &&o);
+  void Sample();
+  bool Ready();
+  double Residency(const std::size_t &core, const std::size_t &state);
+  double DeepestIdle();
+  std::string Governors();
+  std::uint64_t CoreThrottles();
+  std::uint64_t PackageThrottles();
+  std::string driver;
+  std::string boost;
+  std::vector<CorePower> cores;
+};
+
+#endif // CGOGGLES_PROCESSORPOWER_H_
@@ -0,0 +1,211 @@
+/**
+*  @file      processortopology.cpp
+*  @brief     The implementation for the ProcessorTopology class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "processortopology.h"
+#include "os.h"
+#include "sysroot.h"
+#include "utils.h"
+
+/**
+* @brief Reads a small sysfs file holding a single, possibly negative, number
+*
+* @param  path         The path to the file
+* @param  def          The value to use if the file is missing or empty
+* @return std::int64_t The number in the file
+*/
+static std::int64_t readNumber(const std::string &path, const std::int64_t &def)
+{
+  std::string text;
+  if (!readFile(path, &text) || trim(text).empty())
+  {
+    return def;
+  }
+  try
+  {
+    return std::stoll(text);
+  }
+  catch (...)
+  {
+    return def;
+  }
+}
+
+/**
+* @brief Parses a cache size such as 48K, 2048K or 32M into bytes
+*
+* @param  text          The size, as written by the kernel
+* @return std::uint64_t The size in bytes
+*/
+static std::uint64_t parseCacheSize(const std::string &text)
+{
+  std::size_t end = 0;
+  std::uint64_t size;
+  try
+  {
+    size = std::stoull(text, &end);
+  }
+  catch (...)
+  {
+    return 0;
+  }
+  if (end < text.size())
+  {
+    size <<= text[end] == 'K' ? 10 : text[end] == 'M' ? 20 : text[end] == 'G' ? 30 : 0;
+  }
+  return size;
+}
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new ProcessorTopology object
+*/
+ProcessorTopology::ProcessorTopology()
+{
+  sockets = 0;
+  dies = 0;
+  threads = 0;
+  cores = std::vector<ProcessorCore>();
+  caches = std::vector<ProcessorCache>();
+}
+
+/**
+* @brief Construct a new ProcessorTopology object with help from the assistants
+*
+* @param plt The platform of the system
+*/
+ProcessorTopology::ProcessorTopology(std::uint8_t plt) : ProcessorTopology()
+{
+  switch (plt)
+  {
+  case OS_WIN:
+    GetWin();
+    break;
+  case OS_MAC:
+    GetMac();
+    break;
+  case OS_LUX:
+    GetLux();
+    break;
+  }
+}
+
+/**
+* @brief Construct a new ProcessorTopology object from another ProcessorTopology object
+*
+* @param o The ProcessorTopology object to move from
+*/
+ProcessorTopology::ProcessorTopology(ProcessorTopology &&o)
+{
+  sockets = o.sockets;
+  dies = o.dies;
+  threads = o.threads;
+  cores = std::move(o.cores);
+  caches = std::move(o.caches);
+}
+#pragma endregion "Constructors"
+
+#pragma region "Constructors' Assistants"
+/**
+* @brief Fills in the topology for Darwin systems
+*/
+void ProcessorTopology::GetMac() {}
+
+/**
+* @brief Fills in the topology for Windows systems
+*/
+void ProcessorTopology::GetWin() {}
+
+/**
+* @brief Fills in the topology for Linux systems
+*/
+void ProcessorTopology::GetLux()
+{
+  std::vector<std::uint32_t> online;
+  std::vector<std::uint32_t> shared;
+  std::vector<std::string> names;
+  std::set<std::pair<std::int32_t, std::int32_t>> seenDies;
+  std::set<std::int32_t> seenSockets;
+  std::string dir;
+  std::string text;
+  ProcessorCore core;
+  ProcessorCache cache;
+
+  if (!readFile("/sys/devices/system/cpu/online", &text) || !parseCpuList(text, &online) || online.empty())
+  {
+    return;
+  }
+  threads = online.size();
+
+  for (const std::uint32_t &cpu : online)
+  {
+    dir = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+
+    // Each core and cache is read only through the first thread which shares it
+    if (readFile(dir + "/topology/thread_siblings_list", &text) && parseCpuList(text, &shared) && !shared.empty() && shared[0] == cpu)
+    {
+      core.socket = static_cast<std::int32_t>(readNumber(dir + "/topology/physical_package_id", -1));
+      core.die = static_cast<std::int32_t>(readNumber(dir + "/topology/die_id", 0));
+      core.id = static_cast<std::int32_t>(readNumber(dir + "/topology/core_id", -1));
+      core.cpuList = trim(text);
+      core.threads = shared.size();
+      seenSockets.insert(core.socket);
+      seenDies.insert(std::make_pair(core.socket, core.die));
+      cores.push_back(core);
+    }
+
+    listDirectory(dir + "/cache", &names);
+    for (std::size_t i = 0; i < names.size(); ++i)
+    {
+      if (!startswith(names[i], "index") || !readFile(dir + "/cache/" + names[i] + "/shared_cpu_list", &text) ||
+          !parseCpuList(text, &shared) || shared.empty() || shared[0] != cpu)
+      {
+        continue;
+      }
+      cache.cpuList = trim(text);
+      cache.first = cpu;
+      cache.threads = shared.size();
+      cache.level = static_cast<std::uint32_t>(readNumber(dir + "/cache/" + names[i] + "/level", 0));
+      cache.type = readFile(dir + "/cache/" + names[i] + "/type", &text) ? trim(text) : "";
+      cache.size = readFile(dir + "/cache/" + names[i] + "/size", &text) ? parseCacheSize(trim(text)) : 0;
+      cache.ways = static_cast<std::uint32_t>(readNumber(dir + "/cache/" + names[i] + "/ways_of_associativity", 0));
+      cache.lineSize = static_cast<std::uint32_t>(readNumber(dir + "/cache/" + names[i] + "/coherency_line_size", 0));
+      cache.sets = static_cast<std::uint32_t>(readNumber(dir + "/cache/" + names[i] + "/number_of_sets", 0));
+      caches.push_back(cache);
+    }
+  }
+
+  sockets = seenSockets.size();
+  dies = seenDies.size();
+  std::stable_sort(caches.begin(), caches.end(), [](const ProcessorCache &a, const ProcessorCache &b) {
+    return a.level != b.level ? a.level < b.level : a.type != b.type ? a.type < b.type : a.first < b.first;
+  });
+}
+#pragma endregion "Constructors' Assistants"
+
+#pragma region "Operators"
+/**
+* @brief Moves another ProcessorTopology object into this one
+*
+* @param o The ProcessorTopology object to move from
+*/
+void ProcessorTopology::operator=(ProcessorTopology &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  sockets = o.sockets;
+  dies = o.dies;
+  threads = o.threads;
+  cores = std::move(o.cores);
+  caches = std::move(o.caches);
+}
+#pragma endregion "Operators"
@@ -0,0 +1,70 @@
+/**
+*  @file      processortopology.h
+*  @brief     The interface for the ProcessorTopology class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_PROCESSORTOPOLOGY_H_
+#define CGOGGLES_PROCESSORTOPOLOGY_H_
+
+#include "pch.h"
+
+/**
+* @brief Represents a single physical core, and the hardware threads which share it
+*/
+class ProcessorCore
+{
+public:
+  std::int32_t socket;
+  std::int32_t die;
+  std::int32_t id;
+  std::string cpuList;
+  std::uint32_t threads;
+};
+
+/**
+* @brief Represents a single instance of a cache, and the hardware threads which share it
+*/
+class ProcessorCache
+{
+public:
+  std::uint32_t level;
+  std::string type;
+  std::uint64_t size;
+  std::uint32_t ways;
+  std::uint32_t lineSize;
+  std::uint32_t sets;
+  std::string cpuList;
+  std::uint32_t first;
+  std::uint32_t threads;
+};
+
+/**
+* @brief Represents how a computer's hardware threads are laid out across sockets, dies, cores and caches
+*/
+class ProcessorTopology
+{
+private:
+  void GetMac();
+  void GetWin();
+  void GetLux();
+
+public:
+  ProcessorTopology();
+  ProcessorTopology(std::uint8_t plt);
+  ProcessorTopology(const ProcessorTopology &o) = delete;
+  ProcessorTopology(ProcessorTopology &&o);
+  void operator=(const ProcessorTopology &o) = delete;
+  void operator=(ProcessorTopology &&o);
+  std::uint32_t sockets;
+  std::uint32_t dies;
+  std::uint32_t threads;
+  std::vector<ProcessorCore> cores;
+  std::vector<ProcessorCache> caches;
+};
+
+#endif // CGOGGLES_PROCESSORTOPOLOGY_H_
@@ -0,0 +1,279 @@
+/**
+*  @file      processorusage.cpp
+*  @brief     The implementation for the ProcessorUsage class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "processorusage.h"
+#include "os.h"
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new, unsampled ProcessorUsage object
+*/
+ProcessorUsage::ProcessorUsage()
+{
+  prev = std::vector<std::array<std::uint64_t, usageFields>>();
+  cur = std::vector<std::array<std::uint64_t, usageFields>>();
+  prevCtxt = curCtxt = 0;
+  prevIntr = curIntr = 0;
+  prevTime = curTime = 0;
+  samples = 0;
+  cpus = std::vector<std::uint32_t>();
+}
+
+/**
+* @brief Construct a new ProcessorUsage object with help from the assistants
+*
+* @param plt The platform of the system
+*/
+ProcessorUsage::ProcessorUsage(std::uint8_t plt) : ProcessorUsage()
+{
+  switch (plt)
+  {
+  case OS_WIN:
+    GetWin();
+    break;
+  case OS_MAC:
+    GetMac();
+    break;
+  case OS_LUX:
+    GetLux();
+    break;
+  }
+}
+
+/**
+* @brief Construct a new ProcessorUsage object from another ProcessorUsage object
+*
+* @param o The ProcessorUsage object to move from
+*/
+ProcessorUsage::ProcessorUsage(ProcessorUsage &&o)
+{
+  stat = std::move(o.stat);
+  prev = std::move(o.prev);
+  cur = std::move(o.cur);
+  prevCtxt = o.prevCtxt;
+  curCtxt = o.curCtxt;
+  prevIntr = o.prevIntr;
+  curIntr = o.curIntr;
+  prevTime = o.prevTime;
+  curTime = o.curTime;
+  samples = o.samples;
+  cpus = std::move(o.cpus);
+}
+#pragma endregion "Constructors"
+
+#pragma region "Constructors' Assistants"
+/**
+* @brief Fills in the usage sources for Darwin systems
+*/
+void ProcessorUsage::GetMac() {}
+
+/**
+* @brief Fills in the usage sources for Windows systems
+*/
+void ProcessorUsage::GetWin() {}
+
+/**
+* @brief Fills in the usage sources for Linux systems
+*/
+void ProcessorUsage::GetLux()
+{
+  stat = SourceFile("/proc/stat");
+}
+
+/**
+* @brief Takes a sample of /proc/stat, only allocating when the number of CPUs grows
+*/
+void ProcessorUsage::SampleLux()
+{
+  std::size_t row = 0;
+  std::uint32_t id;
+  bool changed = false;
+
+  std::swap(prev, cur);
+  prevCtxt = curCtxt;
+  prevIntr = curIntr;
+  prevTime = curTime;
+  curTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  if (!stat.Read())
+  {
+    samples = 0;
+    return;
+  }
+
+  Scanner scan(stat.Data(), stat.Size());
+  while (!scan.Done())
+  {
+    if (scan.Match("cpu"))
+    {
+      // The first line is every CPU, followed by one line per online CPU, so offline CPUs leave gaps in the ids
+      if (row > 0 && !scan.Match(" "))
+      {
+        id = scan.Number();
+        changed = changed || row > cpus.size() || cpus[row - 1] != id;
+        if (row > cpus.size())
+        {
+          cpus.push_back(id);
+        }
+        cpus[row - 1] = id;
+      }
+      if (row >= cur.size())
+      {
+        cur.resize(row + 1);
+      }
+      for (std::size_t i = 0; i < usageFields; ++i)
+      {
+        cur[row][i] = scan.Number();
+      }
+      ++row;
+    }
+    else if (scan.Match("ctxt"))
+    {
+      curCtxt = scan.Number();
+    }
+    else if (scan.Match("intr"))
+    {
+      curIntr = scan.Number();
+    }
+    scan.SkipLine();
+  }
+
+  // A CPU came or went, so the samples can't be compared, even when as many went as came
+  cpus.resize(row > 0 ? row - 1 : 0);
+  if (changed || row != cur.size() || row != prev.size())
+  {
+    cur.resize(row);
+    samples = 0;
+  }
+  ++samples;
+}
+#pragma endregion "Constructors' Assistants"
+
+#pragma region "Operators"
+/**
+* @brief Moves another ProcessorUsage object into this one
+*
+* @param o The ProcessorUsage object to move from
+*/
+void ProcessorUsage::operator=(ProcessorUsage &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  stat = std::move(o.stat);
+  prev = std::move(o.prev);
+  cur = std::move(o.cur);
+  prevCtxt = o.prevCtxt;
+  curCtxt = o.curCtxt;
+  prevIntr = o.prevIntr;
+  curIntr = o.curIntr;
+  prevTime = o.prevTime;
+  curTime = o.curTime;
+  samples = o.samples;
+  cpus = std::move(o.cpus);
+}
+#pragma endregion "Operators"
+
+#pragma region "Methods"
+/**
+* @brief Takes a sample of the CPU times, keeping the previous one to compare against
+*/
+void ProcessorUsage::Sample()
+{
+  if (stat.Good())
+  {
+    SampleLux();
+  }
+}
+
+/**
+* @brief Checks whether or not there are two comparable samples
+*
+* @return true  The usage can be computed
+* @return false The usage can NOT be computed yet
+*/
+bool ProcessorUsage::Ready()
+{
+  return samples >= 2 && curTime > prevTime;
+}
+
+/**
+* @brief Gets the number of CPUs sampled
+*
+* @return std::size_t The number of CPUs
+*/
+std::size_t ProcessorUsage::Cores()
+{
+  return cur.empty() ? 0 : cur.size() - 1;
+}
+
+/**
+* @brief Gets the share of time spent in a field between the two samples
+*
+* @param  cpu    The CPU, where 0 is every CPU and i + 1 is CPU i
+* @param  field  The index of the field in usageNames
+* @return double The percentage of time spent in the field
+*/
+double ProcessorUsage::Percent(const std::size_t &cpu, const std::size_t &field)
+{
+  std::uint64_t total = 0;
+  std::uint64_t delta;
+  std::uint64_t part = 0;
+
+  if (!Ready() || cpu >= cur.size() || field >= usageFields)
+  {
+    return 0;
+  }
+  for (std::size_t i = 0; i < usageFields; ++i)
+  {
+    // Some counters, like iowait, may go backwards
+    delta = cur[cpu][i] > prev[cpu][i] ? cur[cpu][i] - prev[cpu][i] : 0;
+    total += delta;
+    part = i == field ? delta : part;
+  }
+  return total ? 100.0 * part / total : 0;
+}
+
+/**
+* @brief Gets the share of time spent neither idle nor waiting on IO between the two samples
+*
+* @param  cpu    The CPU, where 0 is every CPU and i + 1 is CPU i
+* @return double The percentage of time spent busy
+*/
+double ProcessorUsage::Busy(const std::size_t &cpu)
+{
+  if (!Ready() || cpu >= cur.size())
+  {
+    return 0;
+  }
+  return std::max(0.0, 100.0 - Percent(cpu, 3) - Percent(cpu, 4));
+}
+
+/**
+* @brief Gets the rate of context switches between the two samples
+*
+* @return double The context switches per second
+*/
+double ProcessorUsage::ContextSwitches()
+{
+  return Ready() && curCtxt >= prevCtxt ? (curCtxt - prevCtxt) * 1e9 / (curTime - prevTime) : 0;
+}
+
+/**
+* @brief Gets the rate of interrupts between the two samples
+*
+* @return double The interrupts per second
+*/
+double ProcessorUsage::Interrupts()
+{
+  return Ready() && curIntr >= prevIntr ? (curIntr - prevIntr) * 1e9 / (curTime - prevTime) : 0;
+}
+#pragma endregion "Methods"
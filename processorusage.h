@@ -0,0 +1,65 @@
+/**
+*  @file      processorusage.h
+*  @brief     The interface for the ProcessorUsage class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_PROCESSORUSAGE_H_
+#define CGOGGLES_PROCESSORUSAGE_H_
+
+#include "pch.h"
+#include "sourcefile.h"
+
+/**
+* @brief The number of time fields kept for each CPU
+*/
+const std::size_t usageFields = 8;
+
+/**
+* @brief The names of the time fields kept for each CPU, in /proc/stat order
+*/
+const char *const usageNames[usageFields] = {"User", "Nice", "System", "Idle", "IOWait", "IRQ", "SoftIRQ", "Steal"};
+
+/**
+* @brief Represents a computer's CPU utilization between two samples
+*/
+class ProcessorUsage
+{
+private:
+  SourceFile stat;
+  std::vector<std::array<std::uint64_t, usageFields>> prev;
+  std::vector<std::array<std::uint64_t, usageFields>> cur;
+  std::uint64_t prevCtxt;
+  std::uint64_t curCtxt;
+  std::uint64_t prevIntr;
+  std::uint64_t curIntr;
+  std::uint64_t prevTime;
+  std::uint64_t curTime;
+  std::size_t samples;
+  void GetMac();
+  void GetWin();
+  void GetLux();
+  void SampleLux();
+
+public:
+  ProcessorUsage();
+  ProcessorUsage(std::uint8_t plt);
+  ProcessorUsage(const ProcessorUsage &o) = delete;
+  ProcessorUsage(ProcessorUsage &&o);
+  void operator=(const ProcessorUsage &o) = delete;
+  void operator=(ProcessorUsage &&o);
+  void Sample();
+  bool Ready();
+  std::size_t Cores();
+  double Percent(const std::size_t &cpu, const std::size_t &field);
+  double Busy(const std::size_t &cpu);
+  double ContextSwitches();
+  double Interrupts();
+  std::vector<std::uint32_t> cpus;
+};
+
+#endif // CGOGGLES_PROCESSORUSAGE_H_
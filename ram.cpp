@@ -49,13 +49,13 @@ RAM::RAM()
 RAM::RAM(std::uint64_t sz, std::string bk, std::string tp, std::uint64_t spd, std::string ff, std::string manuf, std::string prt, std::string srl, float vlt, float vltMin, float vltMax)
 {
   size = sz;
-  bank = bk;
-  type = tp;
+  bank = std::move(bk);
+  type = std::move(tp);
   speed = spd;
-  formFactor = ff;
-  manufacturer = manuf;
-  part = prt;
-  serial = srl;
+  formFactor = std::move(ff);
+  manufacturer = std::move(manuf);
+  part = std::move(prt);
+  serial = std::move(srl);
   voltageConfigured = vlt;
   voltageMin = vltMin;
   voltageMax = vltMax;
@@ -64,18 +64,18 @@ RAM::RAM(std::uint64_t sz, std::string bk, std::string tp, std::uint64_t spd, st
 /**
 * @brief Construct a new RAM object with values from another RAM object
 *
-* @param o The other RAM object to copy from
+* @param o The other RAM object to move from
 */
-RAM::RAM(const RAM &o)
+RAM::RAM(RAM &&o)
 {
   size = o.size;
-  bank = o.bank;
-  type = o.type;
+  bank = std::move(o.bank);
+  type = std::move(o.type);
   speed = o.speed;
-  formFactor = o.formFactor;
-  manufacturer = o.manufacturer;
-  part = o.part;
-  serial = o.serial;
+  formFactor = std::move(o.formFactor);
+  manufacturer = std::move(o.manufacturer);
+  part = std::move(o.part);
+  serial = std::move(o.serial);
   voltageConfigured = o.voltageConfigured;
   voltageMin = o.voltageMin;
   voltageMax = o.voltageMax;
@@ -84,58 +84,26 @@ RAM::RAM(const RAM &o)
 
 #pragma region "Operators"
 /**
-* @brief Reserves memory for a new RAM object
+* @brief Moves another RAM object into this one
 *
-* @param  size  The amount of memory to allocate
-* @return void* A pointer to the allocated memory
+* @param o The RAM object to move from
 */
-void *RAM::operator new(std::size_t size)
-{
-  void *o = ::new (RAM);
-  return o;
-}
-
-/**
-* @brief Sets equal two RAM objects
-*
-* @param o The RAM object to copy from
-*/
-void RAM::operator=(const RAM &o)
+void RAM::operator=(RAM &&o)
 {
   if (&o == this)
   {
     return;
   }
   size = o.size;
-  bank = o.bank;
-  type = o.type;
+  bank = std::move(o.bank);
+  type = std::move(o.type);
   speed = o.speed;
-  formFactor = o.formFactor;
-  manufacturer = o.manufacturer;
-  part = o.part;
-  serial = o.serial;
+  formFactor = std::move(o.formFactor);
+  manufacturer = std::move(o.manufacturer);
+  part = std::move(o.part);
+  serial = std::move(o.serial);
   voltageConfigured = o.voltageConfigured;
   voltageMin = o.voltageMin;
   voltageMax = o.voltageMax;
 }
-
-/**
-* @brief Sets equal two RAM objects
-*
-* @param o The RAM object to copy from
-*/
-void RAM::operator=(RAM *o)
-{
-  size = o->size;
-  bank = o->bank;
-  type = o->type;
-  speed = o->speed;
-  formFactor = o->formFactor;
-  manufacturer = o->manufacturer;
-  part = o->part;
-  serial = o->serial;
-  voltageConfigured = o->voltageConfigured;
-  voltageMin = o->voltageMin;
-  voltageMax = o->voltageMax;
-}
 #pragma endregion "Operators"
@@ -21,10 +21,10 @@ class RAM
 public:
   RAM();
   RAM(std::uint64_t sz, std::string bk, std::string tp, std::uint64_t spd, std::string ff, std::string manuf, std::string prt, std::string srl, float vlt, float vltMin, float vltMax);
-  RAM(const RAM &o);
-  void *operator new(std::size_t size);
-  void operator=(const RAM &o);
-  void operator=(RAM *o);
+  RAM(const RAM &o) = delete;
+  RAM(RAM &&o);
+  void operator=(const RAM &o) = delete;
+  void operator=(RAM &&o);
   std::uint64_t size;
   std::string bank;
   std::string type;
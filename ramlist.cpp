@@ -13,6 +13,7 @@
 #include "ram.h"
 #include "os.h"
 #include "utils.h"
+#include "sysroot.h"
 
 #pragma region "Contructors"
 /**
@@ -31,6 +32,7 @@ RAMList::RAMList()
 */
 RAMList::RAMList(std::uint8_t plt)
 {
+  total = std::uint64_t(0);
   switch (plt)
   {
   case OS_WIN:
@@ -48,11 +50,11 @@ RAMList::RAMList(std::uint8_t plt)
 /**
 * @brief Construct a new RAMList object from another RAMList object
 *
-* @param o The RAMList object to copy from
+* @param o The RAMList object to move from
 */
-RAMList::RAMList(const RAMList &o)
+RAMList::RAMList(RAMList &&o)
 {
-  chips = o.chips;
+  chips = std::move(o.chips);
   total = o.total;
 }
 #pragma endregion "Contructors"
@@ -76,7 +78,6 @@ void RAMList::GetMac()
       {"0x8551", "Qimonda AG i. In."},
       {"0x859B", "Crucial"}};
   std::vector<std::string> allChips;
-  RAM tempChip;
   std::uint64_t tempSize = 0;
   std::string tempBank = "";
   std::string tempType = "";
@@ -131,8 +132,7 @@ void RAMList::GetMac()
 
       if (i == allChips.size() - 3 || (i > 7 && i < allChips.size() - 3 && startswith(trim(allChips[i + 2]), "BANK ")))
       {
-        tempChip = (new RAM(tempSize, tempBank, tempType, tempSpeed, tempFormFactor, tempManufacturer, tempPart, tempSerial, tempVoltageConfigured, tempVoltageMin, tempVoltageMax));
-        chips.push_back(tempChip);
+        chips.emplace_back(tempSize, tempBank, tempType, tempSpeed, tempFormFactor, tempManufacturer, tempPart, tempSerial, tempVoltageConfigured, tempVoltageMin, tempVoltageMax);
       }
     }
   }
@@ -161,7 +161,6 @@ void RAMList::GetWin()
       "SODIMM", "SRIMM", "SMD", "SSMP",
       "QFP", "TQFP", "SOIC", "LCC",
       "PLCC", "BGA", "FPBGA", "LGA"};
-  RAM tempChip;
   std::uint64_t tempSize = 0;
   std::string tempBank = "";
   std::string tempType = "";
@@ -190,8 +189,7 @@ void RAMList::GetWin()
     tempVoltageMin = !allChips[i]["MinVoltage"].empty() ? std::stof(allChips[i]["MinVoltage"]) / 1000 : 0;
     tempVoltageMax = !allChips[i]["MaxVoltage"].empty() ? std::stof(allChips[i]["MaxVoltage"]) / 1000 : 0;
 
-    tempChip = (new RAM(tempSize, tempBank, tempType, tempSpeed, tempFormFactor, tempManufacturer, tempPart, tempSerial, tempVoltageConfigured, tempVoltageMin, tempVoltageMax));
-    chips.push_back(tempChip);
+    chips.emplace_back(tempSize, tempBank, tempType, tempSpeed, tempFormFactor, tempManufacturer, tempPart, tempSerial, tempVoltageConfigured, tempVoltageMin, tempVoltageMax);
   }
 }
 
@@ -199,12 +197,34 @@ void RAMList::GetWin()
 * @brief Fills in the RAMList information for Linux systems
 */
 void RAMList::GetLux()
+{
+  std::string table;
+
+  if (readFile("/sys/firmware/dmi/tables/DMI", &table))
+  {
+    ParseSmbios(table);
+    return;
+  }
+  if (activeSysroot() != nullptr)
+  {
+    return;
+  }
+  ParseLux(runCommand("export LC_ALL=C; sudo dmidecode -t memory 2>/dev/null | grep -iE \"Size:|Type|Speed|Manufacturer|Form Factor|Locator|Memory Device|Serial Number|Voltage|Part Number\"; unset LC_ALL"));
+}
+
+/**
+* @brief Fills in the RAMList information from the filtered output of dmidecode
+*
+* @param text The output of dmidecode -t memory, filtered to the used keys
+*/
+void RAMList::ParseLux(const std::string &text)
 {
   std::vector<std::string> lines;
   std::string line;
   std::string key;
   std::string val;
-  RAM tempChip;
+  bool inDevice = false;
+  bool populated = false;
   std::uint64_t tempSize = 0;
   std::string tempBank = "";
   std::string tempType = "";
@@ -216,114 +236,184 @@ void RAMList::GetLux()
   float tempVoltageConfigured = 0;
   float tempVoltageMin = 0;
   float tempVoltageMax = 0;
-  splitStringVector(runCommand("export LC_ALL=C; sudo dmidecode -t memory 2>/dev/null | grep -iE \"Size:|Type|Speed|Manufacturer|Form Factor|Locator|Memory Device|Serial Number|Voltage|Part Number\"; unset LC_ALL"), "\n", &lines);
+  splitStringVector(text, "\n", &lines);
+  lines.push_back("Handle"); // Flushes the last RAM chip
 
-  if (lines.size() <= 1)
+  for (std::size_t i = 0; i < lines.size(); ++i)
   {
-    return;
-  }
+    line = trim(lines[i]);
 
-  for (std::size_t i = 3; i < lines.size(); ++i)
-  {
-    // While in range and NOT starting a new RAM chip
-    while (i < lines.size() && !startswith(lines[i], "Handle 0x"))
+    // New RAM chip beginning, keep the previous one if it was installed
+    if (startswith(line, "Handle"))
     {
-      line = trim(lines[++i]);
-      // Residual header for new RAM chip
-      if (startswith(line, "Memory Device"))
-      {
-        continue;
-      }
-      // No module in the slot, skip it
-      if (endswith(line, "No Module Installed"))
+      if (inDevice && populated && tempManufacturer != "FFFFFFFFFFFF")
       {
-        break;
+        total += tempSize;
+        chips.emplace_back(tempSize, tempBank, tempType, tempSpeed, tempFormFactor, tempManufacturer, tempPart, tempSerial, tempVoltageConfigured, tempVoltageMin, tempVoltageMax);
       }
+      inDevice = line.find("DMI type 17,") != std::string::npos;
+      populated = false;
+      tempSize = 0;
+      tempBank = tempType = tempFormFactor = tempManufacturer = tempPart = tempSerial = "";
+      tempSpeed = 0;
+      tempVoltageConfigured = tempVoltageMin = tempVoltageMax = 0;
+      continue;
+    }
+    if (!inDevice || !splitKeyValuePair(line, &key, &val))
+    {
+      continue;
+    }
 
-      splitKeyValuePair(line, &key, &val);
-
-      if (key == "Size")
+    if (key == "Size")
+    {
+      // No module in the slot, skip it
+      populated = !endswith(val, "No Module Installed") && val.size() > 3;
+      if (populated)
       {
         tempSize = std::stoull(val.substr(0, val.size() - 3));
         tempSize *= pow(1024, endswith(val, "MB") ? 2 : 3);
-        total += tempSize;
-      }
-      if (key == "Locator")
-      {
-        tempBank = val;
-      }
-      if (key == "Type")
-      {
-        tempType = val;
-      }
-      if (key == "Speed" && val != "Unknown")
-      {
-        tempSpeed = std::stoull(val.substr(0, val.size() - 4)) * pow(1024, 2);
-      }
-      if (key == "Form Factor")
-      {
-        tempFormFactor = val;
-      }
-      if (key == "Manufacturer")
-      {
-        tempManufacturer = val;
-      }
-      if (key == "Part Number")
-      {
-        tempPart = val;
-      }
-      if (key == "Serial Number")
-      {
-        tempSerial = val;
       }
     }
-
-    // New RAM chip beginning
-    if (startswith(lines[i], "Handle 0x") && tempManufacturer != "FFFFFFFFFFFF")
+    if (key == "Locator")
     {
-      tempChip = (new RAM(tempSize, tempBank, tempType, tempSpeed, tempFormFactor, tempManufacturer, tempPart, tempSerial, tempVoltageConfigured, tempVoltageMin, tempVoltageMax));
-      chips.push_back(tempChip);
+      tempBank = val;
+    }
+    if (key == "Type")
+    {
+      tempType = val;
+    }
+    if (key == "Speed" && val != "Unknown" && val.size() > 4)
+    {
+      tempSpeed = std::stoull(val.substr(0, val.size() - 4)) * pow(1024, 2);
+    }
+    if (key == "Form Factor")
+    {
+      tempFormFactor = val;
+    }
+    if (key == "Manufacturer")
+    {
+      tempManufacturer = val;
+    }
+    if (key == "Part Number")
+    {
+      tempPart = val;
+    }
+    if (key == "Serial Number")
+    {
+      tempSerial = val;
+    }
+    if (key == "Configured Voltage" && val != "Unknown")
+    {
+      tempVoltageConfigured = std::stof(val);
+    }
+    if (key == "Minimum Voltage" && val != "Unknown")
+    {
+      tempVoltageMin = std::stof(val);
+    }
+    if (key == "Maximum Voltage" && val != "Unknown")
+    {
+      tempVoltageMax = std::stof(val);
     }
   }
 }
-#pragma endregion
 
-#pragma region "Operators"
 /**
-* @brief Reserves memory for a new RAM object
+* @brief Fills in the RAMList information from the raw SMBIOS table, like dmidecode
 *
-* @param  size  The amount of memory to allocate
-* @return void* A pointer to the allocated memory
+* @param table The contents of /sys/firmware/dmi/tables/DMI
 */
-void *RAMList::operator new(std::size_t size)
+void RAMList::ParseSmbios(const std::string &table)
 {
-  void *o = ::new (RAMList);
-  return o;
+  std::string formFactors[17] = {
+      "Unknown", "Other", "Unknown", "SIMM", "SIP", "Chip", "DIP", "ZIP", "Proprietary Card",
+      "DIMM", "TSOP", "Row Of Chips", "RIMM", "SODIMM", "SRIMM", "FB-DIMM", "Die"};
+  std::string memoryTypes[37] = {
+      "Unknown", "Other", "Unknown", "DRAM", "EDRAM", "VRAM", "SRAM", "RAM", "ROM", "Flash",
+      "EEPROM", "FEPROM", "EPROM", "CDRAM", "3DRAM", "SDRAM", "SGRAM", "RDRAM", "DDR", "DDR2",
+      "DDR2 FB-DIMM", "Reserved", "Reserved", "Reserved", "DDR3", "FBD2", "DDR4", "LPDDR", "LPDDR2", "LPDDR3",
+      "LPDDR4", "Logical non-volatile device", "HBM", "HBM2", "DDR5", "LPDDR5", "HBM3"};
+  const unsigned char *data = reinterpret_cast<const unsigned char *>(table.data());
+  std::size_t pos = 0;
+  std::size_t end;
+  std::vector<std::string> strings;
+  std::uint64_t tempSize;
+  std::uint64_t tempSpeed;
+
+  // Reads a little-endian word or double word from the current structure
+  auto word = [&data, &pos](const std::size_t &off) { return std::uint32_t(data[pos + off]) | std::uint32_t(data[pos + off + 1]) << 8; };
+  auto dword = [&word](const std::size_t &off) { return word(off) | word(off + 2) << 16; };
+  auto text = [&strings, &data, &pos](const std::size_t &off) { return data[pos + off] && data[pos + off] <= strings.size() ? strings[data[pos + off] - 1] : std::string(""); };
+
+  while (pos + 4 <= table.size())
+  {
+    std::uint8_t type = data[pos];
+    std::uint8_t length = data[pos + 1];
+    if (length < 4 || pos + length > table.size())
+    {
+      break;
+    }
+
+    // The strings follow the formatted area, and end with an empty string
+    strings.clear();
+    end = pos + length;
+    while (end < table.size() && data[end] != 0)
+    {
+      std::size_t len = std::strlen(table.data() + end);
+      strings.push_back(trim(table.substr(end, len)));
+      end += len + 1;
+    }
+    end = strings.empty() ? end + 2 : end + 1;
+
+    if (type == 127)
+    {
+      break;
+    }
+    if (type == 17 && length >= 0x15 && word(0x0C) != 0 && word(0x0C) != 0xFFFF)
+    {
+      tempSize = word(0x0C) == 0x7FFF && length >= 0x20
+                     ? std::uint64_t(dword(0x1C) & 0x7FFFFFFF) * 1024 * 1024
+                     : std::uint64_t(word(0x0C) & 0x7FFF) * (word(0x0C) & 0x8000 ? 1024 : 1024 * 1024);
+      tempSpeed = length >= 0x17 ? word(0x15) : 0;
+      if (tempSpeed == 0xFFFF)
+      {
+        tempSpeed = length >= 0x58 ? dword(0x54) : 0;
+      }
+
+      if (length < 0x1B || text(0x17) != "FFFFFFFFFFFF")
+      {
+        total += tempSize;
+        chips.emplace_back(
+            tempSize,
+            text(0x10),
+            data[pos + 0x12] < 37 ? memoryTypes[data[pos + 0x12]] : "Unknown",
+            tempSpeed * std::uint64_t(pow(1024, 2)),
+            data[pos + 0x0E] < 17 ? formFactors[data[pos + 0x0E]] : "Unknown",
+            length >= 0x18 ? text(0x17) : "",
+            length >= 0x1B ? text(0x1A) : "",
+            length >= 0x19 ? text(0x18) : "",
+            length >= 0x2C ? word(0x2A) / 1000.0f : 0,
+            length >= 0x28 ? word(0x26) / 1000.0f : 0,
+            length >= 0x2A ? word(0x28) / 1000.0f : 0);
+      }
+    }
+    pos = end;
+  }
 }
+#pragma endregion
 
+#pragma region "Operators"
 /**
-* @brief Sets equal two RAM objects
+* @brief Moves another RAMList object into this one
 *
-* @param o The RAM object to copy from
+* @param o The RAMList object to move from
 */
-void RAMList::operator=(const RAMList &o)
+void RAMList::operator=(RAMList &&o)
 {
   if (&o == this)
   {
     return;
   }
-  chips = o.chips;
+  chips = std::move(o.chips);
   total = o.total;
 }
-
-/**
-* @brief Sets equal two RAM objects
-*
-* @param o The RAM object to copy from
-*/
-void RAMList::operator=(RAMList *o)
-{
-  chips = o->chips;
-  total = o->total;
-}
 #pragma endregion "Operators"
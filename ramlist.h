@@ -27,10 +27,12 @@ private:
 public:
   RAMList();
   RAMList(std::uint8_t plt);
-  RAMList(const RAMList &o);
-  void *operator new(std::size_t size);
-  void operator=(const RAMList &o);
-  void operator=(RAMList *o);
+  RAMList(const RAMList &o) = delete;
+  RAMList(RAMList &&o);
+  void operator=(const RAMList &o) = delete;
+  void operator=(RAMList &&o);
+  void ParseLux(const std::string &text);
+  void ParseSmbios(const std::string &table);
   std::vector<RAM> chips;
   std::uint64_t total;
 };
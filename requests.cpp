@@ -13,73 +13,132 @@
 #include "utils.h"
 #include "os.h"
 #include "processor.h"
+#include "processorusage.h"
 #include "chassis.h"
 #include "ram.h"
 #include "ramlist.h"
+#include "memorystats.h"
+#include "sensorlist.h"
+#include "temperature.h"
 #include "storage.h"
 #include "storagelist.h"
+#include "diskstats.h"
+#include "networklist.h"
+#include "processlist.h"
+#include "timerwheel.h"
+#include "history.h"
 #include "fs.h"
 #include "fslist.h"
 #include "graphics.h"
 #include "graphicslist.h"
 #include "system.h"
+#include "context.h"
+#include "snapshot.h"
+#include "sysroot.h"
 
 /**
 * @brief Filters out any unsupported requests from the queue
+*
+* @param ctx The context holding the requests
 */
-void filterRequests()
+void filterRequests(Context *ctx)
 {
   std::vector<std::string> valids = {
-      "ALL", "OS", "OS.ALL", "SYS", "SYS.ALL", "CPU", "CPU.ALL", "GPU", "GPU.ALL", "STORAGE", "STORAGE.ALL", "RAM", "RAM.ALL", "FS", "FS.ALL", "CHASSIS", "CHASSIS.ALL",
+      "ALL", "OS", "OS.ALL", "SYS", "SYS.ALL", "CPU", "CPU.ALL", "GPU", "GPU.ALL", "STORAGE", "STORAGE.ALL", "RAM", "RAM.ALL", "MEM", "MEM.ALL", "SENSORS", "SENSORS.ALL", "NET", "NET.ALL", "FS", "FS.ALL", "PROC", "PROC.ALL", "NUMA", "NUMA.ALL", "KERNEL", "KERNEL.ALL", "CGROUP", "CGROUP.ALL", "CGROUPS", "CGROUPS.ALL", "PRESSURE", "PRESSURE.ALL", "SCHED", "SCHED.ALL", "IRQ", "IRQ.ALL", "CHASSIS", "CHASSIS.ALL",
       "OS.PLATFORM", "OS.CAPTION", "OS.SERIAL", "OS.BIT", "OS.INSTALLTIME", "OS.BOOTTIME", "OS.CURTIME", "OS.KERNEL", "OS.VERSION",
       "SYS.MANUFACTURER", "SYS.MODEL", "SYS.VERSION", "SYS.SERIAL", "SYS.UUID",
-      "CPU.MANUFACTURER", "CPU.ARCHITECTURE", "CPU.SOCKETTYPE", "CPU.BRAND", "CPU.FAMILY", "CPU.MODEL", "CPU.STEPPING", "CPU.CORES", "CPU.THREADS", "CPU.SPEED", "CPU.MAXSPEED",
+      "CPU.MANUFACTURER", "CPU.ARCHITECTURE", "CPU.SOCKETTYPE", "CPU.BRAND", "CPU.FAMILY", "CPU.MODEL", "CPU.STEPPING", "CPU.CORES", "CPU.THREADS", "CPU.SPEED", "CPU.MAXSPEED", "CPU.HYPERVISOR", "CPU.FEATURES",
+      "CPU.TOPOLOGY", "CPU.TOPOLOGY.SOCKETS", "CPU.TOPOLOGY.DIES", "CPU.TOPOLOGY.CORES", "CPU.TOPOLOGY.THREADS", "CPU.TOPOLOGY.L3DOMAINS", "CPU.TOPOLOGY.CORE",
+      "CPU.CACHE", "CPU.CACHE.LEVEL", "CPU.CACHE.TYPE", "CPU.CACHE.SIZE", "CPU.CACHE.WAYS", "CPU.CACHE.LINESIZE", "CPU.CACHE.SETS", "CPU.CACHE.CPUS",
+      "CPU.USAGE", "CPU.USAGE.USER", "CPU.USAGE.NICE", "CPU.USAGE.SYSTEM", "CPU.USAGE.IDLE", "CPU.USAGE.IOWAIT", "CPU.USAGE.IRQ", "CPU.USAGE.SOFTIRQ", "CPU.USAGE.STEAL", "CPU.USAGE.BUSY", "CPU.USAGE.CONTEXTSWITCHES", "CPU.USAGE.INTERRUPTS",
+      "CPU.POWER", "CPU.POWER.DRIVER", "CPU.POWER.BOOST", "CPU.POWER.GOVERNOR", "CPU.POWER.DEEPESTIDLE", "CPU.POWER.CORETHROTTLES", "CPU.POWER.PACKAGETHROTTLES",
+      "CPU.COREPOWER", "CPU.COREPOWER.CPU", "CPU.COREPOWER.SPEED", "CPU.COREPOWER.MINSPEED", "CPU.COREPOWER.MAXSPEED", "CPU.COREPOWER.GOVERNOR", "CPU.COREPOWER.EPP", "CPU.COREPOWER.IDLE", "CPU.COREPOWER.CORETHROTTLES", "CPU.COREPOWER.PACKAGETHROTTLES",
+      "CPU.COREUSAGE", "CPU.COREUSAGE.CPU", "CPU.COREUSAGE.USER", "CPU.COREUSAGE.NICE", "CPU.COREUSAGE.SYSTEM", "CPU.COREUSAGE.IDLE", "CPU.COREUSAGE.IOWAIT", "CPU.COREUSAGE.IRQ", "CPU.COREUSAGE.SOFTIRQ", "CPU.COREUSAGE.STEAL", "CPU.COREUSAGE.BUSY",
       "CHASSIS.MANUFACTURER", "CHASSIS.MODEL", "CHASSIS.TYPE", "CHASSIS.VERSION", "CHASSIS.SERIAL", "CHASSIS.ASSETTAG",
       "GPU.VENDOR", "GPU.MODEL", "GPU.BUS", "GPU.VRAM", "GPU.DYNAMIC",
       "RAM.SIZE", "RAM.BANK", "RAM.TYPE", "RAM.SPEED", "RAM.FORMFACTOR", "RAM.MANUFACTURER", "RAM.PART", "RAM.SERIAL", "RAM.VOLTAGECONFIGURED", "RAM.VOLTAGEMIN", "RAM.VOLTAGEMAX",
+      "MEM.TOTAL", "MEM.FREE", "MEM.AVAILABLE", "MEM.BUFFERS", "MEM.CACHED", "MEM.DIRTY", "MEM.WRITEBACK", "MEM.SLAB", "MEM.SLABRECLAIMABLE", "MEM.ANON", "MEM.SHMEM", "MEM.SWAPTOTAL", "MEM.SWAPFREE", "MEM.SWAPCACHED", "MEM.SWAPUSED",
+      "MEM.PAGEFAULTS", "MEM.MAJORFAULTS", "MEM.SWAPINS", "MEM.SWAPOUTS", "MEM.RECLAIMSCANS",
+      "SENSORS.CHIP", "SENSORS.LABEL", "SENSORS.TYPE", "SENSORS.CURRENT", "SENSORS.MIN", "SENSORS.MAX", "SENSORS.AVERAGE",
       "STORAGE.NAME", "STORAGE.IDENTIFIER", "STORAGE.TYPE", "STORAGE.FILESYSTEM", "STORAGE.MOUNT", "STORAGE.TOTAL", "STORAGE.PHYSICAL", "STORAGE.UUID", "STORAGE.LABEL", "STORAGE.MODEL", "STORAGE.SERIAL", "STORAGE.REMOVABLE", "STORAGE.PROTOCOL",
+      "STORAGE.READIOPS", "STORAGE.WRITEIOPS", "STORAGE.READBYTES", "STORAGE.WRITEBYTES", "STORAGE.READLATENCY", "STORAGE.WRITELATENCY", "STORAGE.INFLIGHT", "STORAGE.UTILIZATION",
+      "NET.NAME", "NET.ADDRESS", "NET.STATE", "NET.SPEED", "NET.MTU",
+      "NET.RXBYTES", "NET.RXPACKETS", "NET.RXERRORS", "NET.RXDROPS", "NET.TXBYTES", "NET.TXPACKETS", "NET.TXERRORS", "NET.TXDROPS",
+      "NET.RXBYTESRATE", "NET.RXPACKETSRATE", "NET.RXERRORSRATE", "NET.RXDROPSRATE", "NET.TXBYTESRATE", "NET.TXPACKETSRATE", "NET.TXERRORSRATE", "NET.TXDROPSRATE",
+      "PROC.COUNT", "PROC.THREADS", "PROC.TOPCPU", "PROC.TOPRSS", "PROC.TOPIO",
+      "NUMA.COUNT", "NUMA.IMBALANCE", "NUMA.MISSRATIO", "NUMA.NODE", "NUMA.CPUS", "NUMA.CPUCOUNT", "NUMA.MEMTOTAL", "NUMA.MEMFREE", "NUMA.DISTANCE",
+      "NUMA.HIT", "NUMA.MISS", "NUMA.FOREIGN", "NUMA.INTERLEAVEHIT", "NUMA.LOCALNODE", "NUMA.OTHERNODE", "NUMA.DIMMS",
+      "KERNEL.CMDLINE", "KERNEL.MITIGATIONS", "KERNEL.ISOLCPUS", "KERNEL.NOHZFULL", "KERNEL.RCUNOCBS", "KERNEL.TRANSPARENTHUGEPAGE", "KERNEL.IRQAFFINITY",
+      "KERNEL.VULNERABLE", "KERNEL.MITIGATED", "KERNEL.VULNERABILITY", "KERNEL.VULNERABILITY.STATE", "KERNEL.VULNERABILITY.DETAIL",
+      "CGROUP.VERSION", "CGROUP.PATH", "CGROUP.CPUQUOTA", "CGROUP.CPUPERIOD", "CGROUP.CPUS", "CGROUP.EFFECTIVECPUS", "CGROUP.MEMORYMAX", "CGROUP.MEMORYHIGH",
+      "CGROUP.MEMORYCURRENT", "CGROUP.PERIODS", "CGROUP.THROTTLED", "CGROUP.THROTTLEDTIME",
+      "CGROUPS.COUNT", "CGROUPS.TOPCPU", "CGROUPS.TOPMEMORY", "CGROUPS.TOPIO", "CGROUPS.TOPPRESSURE", "CGROUPS.TREE",
+      "PRESSURE.CPU", "PRESSURE.MEMORY", "PRESSURE.IO",
+      "SCHED.STATUS", "SCHED.RUN", "SCHED.WAIT", "SCHED.TIMESLICES", "SCHED.WAITPERSLICE", "SCHED.CPU", "SCHED.PID",
+      "IRQ.INTERRUPTS", "IRQ.SYSTEM", "IRQ.SOFTIRQS", "IRQ.SKEW", "IRQ.HOTCPUS", "IRQ.CPU", "IRQ.SOFTIRQ", "IRQ.TOPIRQ", "IRQ.IRQ",
       "FS.FS", "FS.TYPE", "FS.SIZE", "FS.USED", "FS.MOUNT"};
 
-  for (int i = requests.size() - 1; i > 0; --i)
+  for (int i = ctx->requests.size() - 1; i >= 0; --i)
   {
-    if (!contains(&valids, requests[i]))
+    if (!contains(&valids, ctx->requests[i]))
     {
-      requests.erase(requests.begin() + i);
+      ctx->requests.erase(ctx->requests.begin() + i);
     }
   }
-  removeDuplicates(&requests);
+  removeDuplicates(&ctx->requests);
 }
 
 /**
 * @brief Turns the raw request string into a collection of requests
 *
+* @param ctx     The context to hold the requests
 * @param request A pointer to the raw request
 */
-void parseRequests(std::string *request)
+void parseRequests(Context *ctx, std::string *request)
 {
-  splitStringVector((*request), ",", &requests);
-  filterRequests();
+  splitStringVector((*request), ",", &ctx->requests);
+  filterRequests(ctx);
 }
 
 /**
 * @brief Turns a list of requests into a list of categories
+*
+* @param ctx  The context holding the requests
+* @param cats The categories to collect
 */
-void gatherCategories(std::vector<std::string> *cats)
+void gatherCategories(Context *ctx, std::vector<std::string> *cats)
 {
   std::string cur;
-  bool addAll = contains(&requests, "ALL");
+  bool addAll = contains(&ctx->requests, "ALL");
   bool addOS = false;
   bool addSYS = false;
   bool addCPU = false;
+  bool addCPUUSAGE = false;
+  bool addCPUPOWER = false;
+  bool usage;
+  bool power;
   bool addCHASSIS = false;
   bool addGPU = false;
   bool addRAM = false;
+  bool addMEM = false;
+  bool addSENSORS = false;
   bool addSTORAGE = false;
+  bool addSTORAGEIO = false;
+  std::vector<std::string> ioRequests = {"STORAGE", "STORAGE.ALL", "STORAGE.READIOPS", "STORAGE.WRITEIOPS", "STORAGE.READBYTES", "STORAGE.WRITEBYTES", "STORAGE.READLATENCY", "STORAGE.WRITELATENCY", "STORAGE.INFLIGHT", "STORAGE.UTILIZATION"};
+  bool addNET = false;
   bool addFS = false;
+  bool addPROC = false;
+  bool addNUMA = false;
+  bool addKERNEL = false;
+  bool addCGROUP = false;
+  bool addCGROUPS = false;
+  bool addPRESSURE = false;
+  bool addSCHED = false;
+  bool addIRQ = false;
 
-  for (std::size_t i = 0; i < requests.size(); ++i)
+  for (std::size_t i = 0; i < ctx->requests.size(); ++i)
   {
-    cur = requests[i];
+    cur = ctx->requests[i];
 
     if (!addOS && (addAll || startswith(cur, "OS")))
     {
@@ -91,11 +150,23 @@ void gatherCategories(std::vector<std::string> *cats)
       cats->push_back("SYS");
       addSYS = true;
     }
-    if (!addCPU && (addAll || startswith(cur, "CPU")))
+    usage = startswith(cur, "CPU.USAGE") || startswith(cur, "CPU.COREUSAGE");
+    power = startswith(cur, "CPU.POWER") || startswith(cur, "CPU.COREPOWER");
+    if (!addCPU && (addAll || (startswith(cur, "CPU") && !usage && !power)))
     {
       cats->push_back("CPU");
       addCPU = true;
     }
+    if (!addCPUUSAGE && (addAll || cur == "CPU" || cur == "CPU.ALL" || usage))
+    {
+      cats->push_back("CPU.USAGE");
+      addCPUUSAGE = true;
+    }
+    if (!addCPUPOWER && (addAll || cur == "CPU" || cur == "CPU.ALL" || power))
+    {
+      cats->push_back("CPU.POWER");
+      addCPUPOWER = true;
+    }
     if (!addCHASSIS && (addAll || startswith(cur, "CHASSIS")))
     {
       cats->push_back("CHASSIS");
@@ -111,487 +182,2173 @@ void gatherCategories(std::vector<std::string> *cats)
       cats->push_back("RAM");
       addRAM = true;
     }
+    if (!addMEM && (addAll || startswith(cur, "MEM")))
+    {
+      cats->push_back("MEM");
+      addMEM = true;
+    }
+    if (!addSENSORS && (addAll || startswith(cur, "SENSORS")))
+    {
+      cats->push_back("SENSORS");
+      addSENSORS = true;
+    }
     if (!addSTORAGE && (addAll || startswith(cur, "STORAGE")))
     {
       cats->push_back("STORAGE");
       addSTORAGE = true;
     }
+    if (!addSTORAGEIO && (addAll || contains(&ioRequests, cur)))
+    {
+      cats->push_back("STORAGE.IO");
+      addSTORAGEIO = true;
+    }
+    if (!addNET && (addAll || startswith(cur, "NET")))
+    {
+      cats->push_back("NET");
+      addNET = true;
+    }
     if (!addFS && (addAll || startswith(cur, "FS")))
     {
       cats->push_back("FS");
       addFS = true;
     }
+    if (!addPROC && (addAll || startswith(cur, "PROC")))
+    {
+      cats->push_back("PROC");
+      addPROC = true;
+    }
+    if (!addNUMA && (addAll || startswith(cur, "NUMA")))
+    {
+      // The DIMMs are mapped onto the nodes from the RAM category, so it is collected first
+      if (!addRAM && (cur == "NUMA" || cur == "NUMA.ALL" || cur == "NUMA.DIMMS"))
+      {
+        cats->push_back("RAM");
+        addRAM = true;
+      }
+      cats->push_back("NUMA");
+      addNUMA = true;
+    }
+    if (!addKERNEL && (addAll || startswith(cur, "KERNEL")))
+    {
+      cats->push_back("KERNEL");
+      addKERNEL = true;
+    }
+    if (!addCGROUP && (addAll || cur == "CGROUP" || startswith(cur, "CGROUP.")))
+    {
+      cats->push_back("CGROUP");
+      addCGROUP = true;
+    }
+    if (!addCGROUPS && (addAll || startswith(cur, "CGROUPS")))
+    {
+      cats->push_back("CGROUPS");
+      addCGROUPS = true;
+    }
+    if (!addPRESSURE && (addAll || startswith(cur, "PRESSURE")))
+    {
+      cats->push_back("PRESSURE");
+      addPRESSURE = true;
+    }
+    if (!addSCHED && (addAll || startswith(cur, "SCHED")))
+    {
+      cats->push_back("SCHED");
+      addSCHED = true;
+    }
+    if (!addIRQ && (addAll || startswith(cur, "IRQ")))
+    {
+      cats->push_back("IRQ");
+      addIRQ = true;
+    }
   }
 }
 
 /**
-* @brief Turns the list of requests into a list of data
+* @brief Collects the data for a single category into the snapshot
+*
+* @param ctx  The context holding the requests
+* @param snap The snapshot to collect into
+* @param cat  The category to collect
 */
-void gatherRequests(std::vector<std::string> *keys, std::vector<std::string> *vals, std::vector<std::string> *cats)
+void collectCategory(Context *ctx, Snapshot *snap, const std::string &cat)
 {
-  bool osAll = contains(&requests, "ALL") || contains(&requests, "OS.ALL") || contains(&requests, "OS");
-  bool sysAll = contains(&requests, "ALL") || contains(&requests, "SYS.ALL") || contains(&requests, "SYS");
-  bool cpuAll = contains(&requests, "ALL") || contains(&requests, "CPU.ALL") || contains(&requests, "CPU");
-  bool chassisAll = contains(&requests, "ALL") || contains(&requests, "CHASSIS.ALL") || contains(&requests, "CHASSIS");
-  bool gpuAll = contains(&requests, "ALL") || contains(&requests, "GPU.ALL") || contains(&requests, "GPU");
-  bool ramAll = contains(&requests, "ALL") || contains(&requests, "RAM.ALL") || contains(&requests, "RAM");
-  bool stoAll = contains(&requests, "ALL") || contains(&requests, "STORAGE.ALL") || contains(&requests, "STORAGE");
-  bool fsAll = contains(&requests, "ALL") || contains(&requests, "FS.ALL") || contains(&requests, "FS");
-  std::stringstream buffer;
+  Timings *timings = ctx->timings != TimingStyle::None ? &snap->timings : nullptr;
+
+  if (cat == "OS")
+  {
+    TimingScope scope(timings, "os");
+    snap->os = OperatingSystem(CGOGGLES_OS);
+  }
+  if (cat == "SYS")
+  {
+    TimingScope scope(timings, "sys");
+    snap->sys = System(CGOGGLES_OS);
+  }
+  if (cat == "CPU")
+  {
+    TimingScope scope(timings, "cpu");
+    snap->cpu = Processor(CGOGGLES_OS);
+  }
+  if (cat == "CPU.USAGE")
+  {
+    TimingScope scope(timings, "cpu.usage");
+    snap->cpuUsage = ProcessorUsage(CGOGGLES_OS);
+  }
+  if (cat == "CPU.POWER")
+  {
+    TimingScope scope(timings, "cpu.power");
+    snap->cpuPower = ProcessorPower(CGOGGLES_OS);
+  }
+  if (cat == "CHASSIS")
+  {
+    TimingScope scope(timings, "chassis");
+    snap->chassis = Chassis(CGOGGLES_OS);
+  }
+  if (cat == "GPU")
+  {
+    TimingScope scope(timings, "gpu");
+    snap->gpu = GraphicsList(CGOGGLES_OS);
+  }
+  if (cat == "RAM")
+  {
+    TimingScope scope(timings, "ram");
+    snap->ram = RAMList(CGOGGLES_OS);
+  }
+  if (cat == "MEM")
+  {
+    TimingScope scope(timings, "mem");
+    snap->mem = MemoryStats(CGOGGLES_OS);
+  }
+  if (cat == "SENSORS")
+  {
+    TimingScope scope(timings, "sensors");
+    snap->sensors = SensorList(CGOGGLES_OS);
+  }
+  if (cat == "STORAGE")
+  {
+    TimingScope scope(timings, "storage");
+    snap->storage = StorageList(CGOGGLES_OS);
+  }
+  if (cat == "STORAGE.IO")
+  {
+    TimingScope scope(timings, "storage.io");
+    snap->disks = DiskStats(CGOGGLES_OS);
+  }
+  if (cat == "NET")
+  {
+    TimingScope scope(timings, "net");
+    snap->net = NetworkList(CGOGGLES_OS);
+  }
+  if (cat == "FS")
+  {
+    TimingScope scope(timings, "fs");
+    snap->fs = FileSystemList(CGOGGLES_OS);
+  }
+  if (cat == "PROC")
+  {
+    TimingScope scope(timings, "proc");
+    snap->proc = ProcessList(CGOGGLES_OS, ctx->top);
+  }
+  if (cat == "NUMA")
+  {
+    TimingScope scope(timings, "numa");
+    snap->numa = NumaList(CGOGGLES_OS);
+    snap->numa.MapBanks(snap->ram);
+  }
+  if (cat == "KERNEL")
+  {
+    TimingScope scope(timings, "kernel");
+    snap->kernel = KernelConfig(CGOGGLES_OS);
+  }
+  if (cat == "CGROUP")
+  {
+    TimingScope scope(timings, "cgroup");
+    snap->cgroup = ControlGroup(CGOGGLES_OS);
+  }
+  if (cat == "CGROUPS")
+  {
+    TimingScope scope(timings, "cgroups");
+    snap->cgroups = ControlGroupTree(CGOGGLES_OS, ctx->top);
+  }
+  if (cat == "PRESSURE")
+  {
+    TimingScope scope(timings, "pressure");
+    snap->pressure = PressureStats(CGOGGLES_OS);
+  }
+  if (cat == "SCHED")
+  {
+    TimingScope scope(timings, "sched");
+    snap->sched = SchedulerStats(CGOGGLES_OS, ctx->pids);
+  }
+  if (cat == "IRQ")
+  {
+    TimingScope scope(timings, "irq");
+    snap->irq = InterruptStats(CGOGGLES_OS, ctx->top, contains(&ctx->requests, "IRQ.IRQ"));
+  }
+}
+
+/**
+* @brief Collects the data for each of the categories into the snapshot
+*
+* @param ctx  The context holding the requests
+* @param snap The snapshot to collect into
+* @param cats The categories to collect
+*/
+void collectRequests(Context *ctx, Snapshot *snap, std::vector<std::string> *cats)
+{
+  for (std::size_t i = 0; i < cats->size(); ++i)
+  {
+    collectCategory(ctx, snap, (*cats)[i]);
+  }
+}
+
+/**
+* @brief Takes a sample of a single category, if it is measured over time
+*
+* @param  ctx   The context holding the requests
+* @param  snap  The snapshot to sample into
+* @param  cat   The category to sample
+* @return true  The category needs another sample to compare against
+* @return false The category is ready
+*/
+bool sampleCategory(Context *ctx, Snapshot *snap, const std::string &cat)
+{
+  Timings *timings = ctx->timings != TimingStyle::None ? &snap->timings : nullptr;
+  bool again = false;
+  bool memRates = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "MEM.ALL") || contains(&ctx->requests, "MEM");
+  bool netRates = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "NET.ALL") || contains(&ctx->requests, "NET");
+  bool procRates = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "PROC.ALL") || contains(&ctx->requests, "PROC") ||
+                   contains(&ctx->requests, "PROC.TOPCPU") || contains(&ctx->requests, "PROC.TOPIO");
+  bool powerRates = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "CPU.ALL") || contains(&ctx->requests, "CPU") ||
+                    contains(&ctx->requests, "CPU.POWER") || contains(&ctx->requests, "CPU.POWER.DEEPESTIDLE") ||
+                    contains(&ctx->requests, "CPU.COREPOWER") || contains(&ctx->requests, "CPU.COREPOWER.IDLE");
+  bool cgroupsRates = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "CGROUPS.ALL") || contains(&ctx->requests, "CGROUPS") ||
+                      contains(&ctx->requests, "CGROUPS.TOPCPU") || contains(&ctx->requests, "CGROUPS.TOPIO") ||
+                      contains(&ctx->requests, "CGROUPS.TOPPRESSURE") || contains(&ctx->requests, "CGROUPS.TREE");
+  bool schedRates = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "SCHED.ALL") || contains(&ctx->requests, "SCHED") ||
+                    contains(&ctx->requests, "SCHED.RUN") || contains(&ctx->requests, "SCHED.WAIT") || contains(&ctx->requests, "SCHED.TIMESLICES") ||
+                    contains(&ctx->requests, "SCHED.WAITPERSLICE") || contains(&ctx->requests, "SCHED.CPU") || contains(&ctx->requests, "SCHED.PID");
+  bool sensorWindow = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "SENSORS.ALL") || contains(&ctx->requests, "SENSORS") ||
+                      contains(&ctx->requests, "SENSORS.MIN") || contains(&ctx->requests, "SENSORS.MAX") || contains(&ctx->requests, "SENSORS.AVERAGE");
 
-  if (contains(cats, "OS"))
+  if (cat == "CPU.USAGE")
+  {
+    TimingScope scope(timings, "cpu.usage");
+    snap->cpuUsage.Sample();
+    again = again || !snap->cpuUsage.Ready();
+  }
+  if (cat == "CPU.POWER")
+  {
+    TimingScope scope(timings, "cpu.power");
+    snap->cpuPower.Sample();
+    again = again || (powerRates && !snap->cpuPower.Ready());
+  }
+  if (cat == "MEM")
+  {
+    TimingScope scope(timings, "mem");
+    snap->mem.Sample();
+    for (std::size_t i = 0; i < vmFields && !memRates; ++i)
+    {
+      memRates = contains(&ctx->requests, "MEM." + toUpper(vmNames[i]));
+    }
+    again = again || (memRates && !snap->mem.Ready());
+  }
+  if (cat == "SENSORS")
+  {
+    TimingScope scope(timings, "sensors");
+    snap->sensors.Sample();
+    again = again || (sensorWindow && !snap->sensors.Ready());
+  }
+  if (cat == "STORAGE.IO")
   {
-    compOS = new OperatingSystem(CGOGGLES_OS);
+    TimingScope scope(timings, "storage.io");
+    snap->disks.Sample();
+    again = again || !snap->disks.Ready();
   }
-  if (contains(cats, "SYS"))
+  if (cat == "NET")
   {
-    compSys = new System(CGOGGLES_OS);
+    TimingScope scope(timings, "net");
+    snap->net.Sample();
+    for (std::size_t i = 0; i < netFields && !netRates; ++i)
+    {
+      netRates = contains(&ctx->requests, "NET." + toUpper(netNames[i]) + "RATE");
+    }
+    again = again || (netRates && !snap->net.Ready());
   }
-  if (contains(cats, "CPU"))
+  if (cat == "PROC")
   {
-    compCPU = new Processor(CGOGGLES_OS);
+    TimingScope scope(timings, "proc");
+    snap->proc.Sample();
+    again = again || (procRates && !snap->proc.Ready());
   }
-  if (contains(cats, "CHASSIS"))
+  if (cat == "CGROUPS")
   {
-    compChassis = new Chassis(CGOGGLES_OS);
+    TimingScope scope(timings, "cgroups");
+    snap->cgroups.Sample();
+    again = again || (cgroupsRates && !snap->cgroups.Ready());
   }
-  if (contains(cats, "GPU"))
+  if (cat == "PRESSURE")
   {
-    compGPU = new GraphicsList(CGOGGLES_OS);
+    TimingScope scope(timings, "pressure");
+    snap->pressure.Sample();
+    again = again || !snap->pressure.Ready();
   }
-  if (contains(cats, "RAM"))
+  if (cat == "SCHED")
   {
-    compRAM = new RAMList(CGOGGLES_OS);
+    TimingScope scope(timings, "sched");
+    snap->sched.Sample();
+    again = again || (schedRates && (snap->sched.enabled || !snap->sched.pids.empty()) && !snap->sched.Ready());
   }
-  if (contains(cats, "STORAGE"))
+  if (cat == "IRQ")
   {
-    compStorage = new StorageList(CGOGGLES_OS);
+    TimingScope scope(timings, "irq");
+    snap->irq.Sample();
+    again = again || !snap->irq.Ready();
   }
-  if (contains(cats, "FS"))
+  return again;
+}
+
+/**
+* @brief Takes a sample of each of the categories which are measured over time
+*
+* @param  ctx   The context holding the requests
+* @param  snap  The snapshot to sample into
+* @param  cats  The categories collected
+* @return true  A category needs another sample to compare against
+* @return false Every category is ready
+*/
+bool sampleRequests(Context *ctx, Snapshot *snap, std::vector<std::string> *cats)
+{
+  bool again = false;
+  for (std::size_t i = 0; i < cats->size(); ++i)
   {
-    compFS = new FileSystemList(CGOGGLES_OS);
+    again = sampleCategory(ctx, snap, (*cats)[i]) || again;
   }
+  return again;
+}
+
+/**
+* @brief Turns the collected snapshot into a list of data
+*
+* @param ctx  The context holding the requests
+* @param snap The snapshot to read from and add the keys and values to
+*/
+void gatherRequests(Context *ctx, Snapshot *snap)
+{
+  bool osAll = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "OS.ALL") || contains(&ctx->requests, "OS");
+  bool sysAll = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "SYS.ALL") || contains(&ctx->requests, "SYS");
+  bool cpuAll = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "CPU.ALL") || contains(&ctx->requests, "CPU");
+  bool chassisAll = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "CHASSIS.ALL") || contains(&ctx->requests, "CHASSIS");
+  bool gpuAll = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "GPU.ALL") || contains(&ctx->requests, "GPU");
+  bool ramAll = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "RAM.ALL") || contains(&ctx->requests, "RAM");
+  bool memAll = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "MEM.ALL") || contains(&ctx->requests, "MEM");
+  bool sensorsAll = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "SENSORS.ALL") || contains(&ctx->requests, "SENSORS");
+  bool stoAll = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "STORAGE.ALL") || contains(&ctx->requests, "STORAGE");
+  std::size_t row;
+  bool netAll = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "NET.ALL") || contains(&ctx->requests, "NET");
+  bool fsAll = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "FS.ALL") || contains(&ctx->requests, "FS");
+  bool procAll = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "PROC.ALL") || contains(&ctx->requests, "PROC");
+  bool numaAll = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "NUMA.ALL") || contains(&ctx->requests, "NUMA");
+  bool kernelAll = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "KERNEL.ALL") || contains(&ctx->requests, "KERNEL");
+  bool cgroupAll = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "CGROUP.ALL") || contains(&ctx->requests, "CGROUP");
+  bool cgroupsAll = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "CGROUPS.ALL") || contains(&ctx->requests, "CGROUPS");
+  bool pressureAll = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "PRESSURE.ALL") || contains(&ctx->requests, "PRESSURE");
+  bool schedAll = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "SCHED.ALL") || contains(&ctx->requests, "SCHED");
+  bool irqAll = contains(&ctx->requests, "ALL") || contains(&ctx->requests, "IRQ.ALL") || contains(&ctx->requests, "IRQ");
+  std::stringstream buffer;
 
-  if (osAll || contains(&requests, "OS.PLATFORM"))
+  if (osAll || contains(&ctx->requests, "OS.PLATFORM"))
   {
-    keys->push_back("os.Platform");
-    vals->push_back(compOS.platform);
+    snap->Add("os.Platform", snap->os.platform);
   }
-  if (osAll || contains(&requests, "OS.CAPTION"))
+  if (osAll || contains(&ctx->requests, "OS.CAPTION"))
   {
-    keys->push_back("os.Caption");
-    vals->push_back(compOS.caption);
+    snap->Add("os.Caption", snap->os.caption);
   }
-  if (osAll || contains(&requests, "OS.SERIAL"))
+  if (osAll || contains(&ctx->requests, "OS.SERIAL"))
   {
-    keys->push_back("os.Serial");
-    vals->push_back(compOS.serial);
+    snap->Add("os.Serial", snap->os.serial);
   }
-  if (osAll || contains(&requests, "OS.BIT"))
+  if (osAll || contains(&ctx->requests, "OS.BIT"))
   {
-    keys->push_back("os.Bit");
-    vals->push_back(std::to_string(compOS.bit));
+    snap->Add("os.Bit", std::to_string(snap->os.bit));
   }
-  if (osAll || contains(&requests, "OS.INSTALLTIME"))
+  if (osAll || contains(&ctx->requests, "OS.INSTALLTIME"))
   {
-    buffer << std::put_time(&compOS.installTime, "%Y-%m-%dT%H:%M:%S");
-    keys->push_back("os.InstallTime");
-    vals->push_back(buffer.str());
+    buffer << std::put_time(&snap->os.installTime, "%Y-%m-%dT%H:%M:%S");
+    snap->Add("os.InstallTime", buffer.str());
     buffer.str("");
   }
-  if (osAll || contains(&requests, "OS.BOOTTIME"))
+  if (osAll || contains(&ctx->requests, "OS.BOOTTIME"))
   {
-    buffer << std::put_time(&compOS.bootTime, "%Y-%m-%dT%H:%M:%S");
-    keys->push_back("os.BootTime");
-    vals->push_back(buffer.str());
+    buffer << std::put_time(&snap->os.bootTime, "%Y-%m-%dT%H:%M:%S");
+    snap->Add("os.BootTime", buffer.str());
     buffer.str("");
   }
-  if (osAll || contains(&requests, "OS.CURTIME"))
+  if (osAll || contains(&ctx->requests, "OS.CURTIME"))
   {
-    buffer << std::put_time(&compOS.curTime, "%Y-%m-%dT%H:%M:%S");
-    keys->push_back("os.CurTime");
-    vals->push_back(buffer.str());
+    buffer << std::put_time(&snap->os.curTime, "%Y-%m-%dT%H:%M:%S");
+    snap->Add("os.CurTime", buffer.str());
     buffer.str("");
   }
-  if (osAll || contains(&requests, "OS.KERNEL"))
+  if (osAll || contains(&ctx->requests, "OS.KERNEL"))
   {
-    keys->push_back("os.Kernel");
-    vals->push_back(compOS.kernel.Pretty());
+    snap->Add("os.Kernel", snap->os.kernel.Pretty());
   }
-  if (osAll || contains(&requests, "OS.VERSION"))
+  if (osAll || contains(&ctx->requests, "OS.VERSION"))
   {
-    keys->push_back("os.Version");
-    vals->push_back(compOS.version.Pretty());
+    snap->Add("os.Version", snap->os.version.Pretty());
   }
 
-  if (sysAll || contains(&requests, "SYS.MANUFACTURER"))
+  if (sysAll || contains(&ctx->requests, "SYS.MANUFACTURER"))
   {
-    keys->push_back("sys.Manufacturer");
-    vals->push_back(compSys.manufacturer);
+    snap->Add("sys.Manufacturer", snap->sys.manufacturer);
   }
-  if (sysAll || contains(&requests, "SYS.MODEL"))
+  if (sysAll || contains(&ctx->requests, "SYS.MODEL"))
   {
-    keys->push_back("sys.Model");
-    vals->push_back(compSys.model);
+    snap->Add("sys.Model", snap->sys.model);
   }
-  if (sysAll || contains(&requests, "SYS.VERSION"))
+  if (sysAll || contains(&ctx->requests, "SYS.VERSION"))
   {
-    keys->push_back("sys.Version");
-    vals->push_back(compSys.version);
+    snap->Add("sys.Version", snap->sys.version);
   }
-  if (sysAll || contains(&requests, "SYS.SERIAL"))
+  if (sysAll || contains(&ctx->requests, "SYS.SERIAL"))
   {
-    keys->push_back("sys.Serial");
-    vals->push_back(compSys.serial);
+    snap->Add("sys.Serial", snap->sys.serial);
   }
-  if (sysAll || contains(&requests, "SYS.UUID"))
+  if (sysAll || contains(&ctx->requests, "SYS.UUID"))
   {
-    keys->push_back("sys.UUID");
-    vals->push_back(compSys.uuid);
+    snap->Add("sys.UUID", snap->sys.uuid);
   }
 
-  if (cpuAll || contains(&requests, "CPU.MANUFACTURER"))
+  if (cpuAll || contains(&ctx->requests, "CPU.MANUFACTURER"))
+  {
+    snap->Add("cpu.Manufacturer", snap->cpu.manufacturer);
+  }
+  if (cpuAll || contains(&ctx->requests, "CPU.ARCHITECTURE"))
+  {
+    snap->Add("cpu.Architecture", snap->cpu.architecture);
+  }
+  if (cpuAll || contains(&ctx->requests, "CPU.SOCKETTYPE"))
   {
-    keys->push_back("cpu.Manufacturer");
-    vals->push_back(compCPU.manufacturer);
+    snap->Add("cpu.SocketType", snap->cpu.socketType);
   }
-  if (cpuAll || contains(&requests, "CPU.ARCHITECTURE"))
+  if (cpuAll || contains(&ctx->requests, "CPU.BRAND"))
   {
-    keys->push_back("cpu.Architecture");
-    vals->push_back(compCPU.architecture);
+    snap->Add("cpu.Brand", snap->cpu.brand);
   }
-  if (cpuAll || contains(&requests, "CPU.SOCKETTYPE"))
+  if (cpuAll || contains(&ctx->requests, "CPU.FAMILY"))
   {
-    keys->push_back("cpu.SocketType");
-    vals->push_back(compCPU.socketType);
+    snap->Add("cpu.Family", std::to_string(snap->cpu.family));
   }
-  if (cpuAll || contains(&requests, "CPU.BRAND"))
+  if (cpuAll || contains(&ctx->requests, "CPU.MODEL"))
   {
-    keys->push_back("cpu.Brand");
-    vals->push_back(compCPU.brand);
+    snap->Add("cpu.Model", std::to_string(snap->cpu.model));
   }
-  if (cpuAll || contains(&requests, "CPU.FAMILY"))
+  if (cpuAll || contains(&ctx->requests, "CPU.STEPPING"))
   {
-    keys->push_back("cpu.Family");
-    vals->push_back(std::to_string(compCPU.family));
+    snap->Add("cpu.Stepping", std::to_string(snap->cpu.stepping));
   }
-  if (cpuAll || contains(&requests, "CPU.MODEL"))
+  if (cpuAll || contains(&ctx->requests, "CPU.CORES"))
   {
-    keys->push_back("cpu.Model");
-    vals->push_back(std::to_string(compCPU.model));
+    snap->Add("cpu.Cores", std::to_string(snap->cpu.cores));
   }
-  if (cpuAll || contains(&requests, "CPU.STEPPING"))
+  if (cpuAll || contains(&ctx->requests, "CPU.THREADS"))
   {
-    keys->push_back("cpu.Stepping");
-    vals->push_back(std::to_string(compCPU.stepping));
+    snap->Add("cpu.Threads", std::to_string(snap->cpu.threads));
   }
-  if (cpuAll || contains(&requests, "CPU.CORES"))
+  if (cpuAll || contains(&ctx->requests, "CPU.SPEED"))
   {
-    keys->push_back("cpu.Cores");
-    vals->push_back(std::to_string(compCPU.cores));
+    snap->Add("cpu.Speed", ctx->pretty
+                               ? siUnits(snap->cpu.speed, "Hz")
+                               : std::to_string(snap->cpu.speed));
   }
-  if (cpuAll || contains(&requests, "CPU.THREADS"))
+  if (cpuAll || contains(&ctx->requests, "CPU.MAXSPEED"))
   {
-    keys->push_back("cpu.Threads");
-    vals->push_back(std::to_string(compCPU.threads));
+    snap->Add("cpu.MaxSpeed", ctx->pretty
+                                  ? siUnits(snap->cpu.maxSpeed, "Hz")
+                                  : std::to_string(snap->cpu.maxSpeed));
   }
-  if (cpuAll || contains(&requests, "CPU.SPEED"))
+  if (cpuAll || contains(&ctx->requests, "CPU.HYPERVISOR"))
   {
-    keys->push_back("cpu.Speed");
-    vals->push_back(pretty
-                        ? siUnits(compCPU.speed, "Hz")
-                        : std::to_string(compCPU.speed));
+    snap->Add("cpu.Hypervisor", snap->cpu.hypervisor ? "Yes" : "No");
   }
-  if (cpuAll || contains(&requests, "CPU.MAXSPEED"))
+  if (cpuAll || contains(&ctx->requests, "CPU.FEATURES"))
   {
-    keys->push_back("cpu.MaxSpeed");
-    vals->push_back(pretty
-                        ? siUnits(compCPU.maxSpeed, "Hz")
-                        : std::to_string(compCPU.maxSpeed));
+    for (std::size_t i = 0; i < snap->cpu.features.size(); ++i)
+    {
+      buffer << (i > 0 ? " " : "") << snap->cpu.features[i];
+    }
+    snap->Add("cpu.Features", buffer.str());
+    buffer.str("");
   }
 
-  if (chassisAll || contains(&requests, "CHASSIS.MANUFACTURER"))
+  ProcessorTopology *topo = &snap->cpu.topology;
+  bool topoAll = cpuAll || contains(&ctx->requests, "CPU.TOPOLOGY");
+  if (topoAll || contains(&ctx->requests, "CPU.TOPOLOGY.SOCKETS"))
   {
-    keys->push_back("chassis.Manufacturer");
-    vals->push_back(compChassis.manufacturer);
+    snap->Add("cpu.Topology.Sockets", std::to_string(topo->sockets));
   }
-  if (chassisAll || contains(&requests, "CHASSIS.MODEL"))
+  if (topoAll || contains(&ctx->requests, "CPU.TOPOLOGY.DIES"))
   {
-    keys->push_back("chassis.Model");
-    vals->push_back(compChassis.model);
+    snap->Add("cpu.Topology.Dies", std::to_string(topo->dies));
   }
-  if (chassisAll || contains(&requests, "CHASSIS.TYPE"))
+  if (topoAll || contains(&ctx->requests, "CPU.TOPOLOGY.CORES"))
   {
-    keys->push_back("chassis.Type");
-    vals->push_back(compChassis.type);
+    snap->Add("cpu.Topology.Cores", std::to_string(topo->cores.size()));
   }
-  if (chassisAll || contains(&requests, "CHASSIS.VERSION"))
+  if (topoAll || contains(&ctx->requests, "CPU.TOPOLOGY.THREADS"))
   {
-    keys->push_back("chassis.Version");
-    vals->push_back(compChassis.version);
+    snap->Add("cpu.Topology.Threads", std::to_string(topo->threads));
   }
-  if (chassisAll || contains(&requests, "CHASSIS.SERIAL"))
+  if (topoAll || contains(&ctx->requests, "CPU.TOPOLOGY.L3DOMAINS"))
   {
-    keys->push_back("chassis.Serial");
-    vals->push_back(compChassis.serial);
+    row = 0;
+    for (std::size_t i = 0; i < topo->caches.size(); ++i)
+    {
+      row += topo->caches[i].level == 3 ? 1 : 0;
+    }
+    snap->Add("cpu.Topology.L3Domains", std::to_string(row));
   }
-  if (chassisAll || contains(&requests, "CHASSIS.ASSETTAG"))
+  if (topoAll || contains(&ctx->requests, "CPU.TOPOLOGY.CORE"))
   {
-    keys->push_back("chassis.AssetTag");
-    vals->push_back(compChassis.assetTag);
+    for (std::size_t i = 0; i < topo->cores.size(); ++i)
+    {
+      std::string key = "cpu.Topology.Core[" + std::to_string(i) + "].";
+      snap->Add(key + "Socket", std::to_string(topo->cores[i].socket));
+      snap->Add(key + "Die", std::to_string(topo->cores[i].die));
+      snap->Add(key + "ID", std::to_string(topo->cores[i].id));
+      snap->Add(key + "CPUs", topo->cores[i].cpuList);
+    }
   }
 
-  for (std::size_t i = 0; i < compGPU.controllers.size(); ++i)
+  bool cacheAll = cpuAll || contains(&ctx->requests, "CPU.CACHE");
+  for (std::size_t i = 0; i < topo->caches.size(); ++i)
   {
-    if (gpuAll || contains(&requests, "GPU.VENDOR"))
+    ProcessorCache *cache = &topo->caches[i];
+    std::string key = "cpu.Cache[" + std::to_string(i) + "].";
+    if (cacheAll || contains(&ctx->requests, "CPU.CACHE.LEVEL"))
+    {
+      snap->Add(key + "Level", "L" + std::to_string(cache->level));
+    }
+    if (cacheAll || contains(&ctx->requests, "CPU.CACHE.TYPE"))
+    {
+      snap->Add(key + "Type", cache->type);
+    }
+    if (cacheAll || contains(&ctx->requests, "CPU.CACHE.SIZE"))
+    {
+      snap->Add(key + "Size", ctx->pretty ? siUnits(cache->size, "B") : std::to_string(cache->size));
+    }
+    if (cacheAll || contains(&ctx->requests, "CPU.CACHE.WAYS"))
     {
-      keys->push_back("gpu[" + std::to_string(i) + "].Vendor");
-      vals->push_back(compGPU.controllers[i].vendor);
+      snap->Add(key + "Ways", std::to_string(cache->ways));
     }
-    if (gpuAll || contains(&requests, "GPU.MODEL"))
+    if (cacheAll || contains(&ctx->requests, "CPU.CACHE.LINESIZE"))
     {
-      keys->push_back("gpu[" + std::to_string(i) + "].Model");
-      vals->push_back(compGPU.controllers[i].model);
+      snap->Add(key + "LineSize", ctx->pretty ? siUnits(cache->lineSize, "B", 0) : std::to_string(cache->lineSize));
     }
-    if (gpuAll || contains(&requests, "GPU.BUS"))
+    if (cacheAll || contains(&ctx->requests, "CPU.CACHE.SETS"))
     {
-      keys->push_back("gpu[" + std::to_string(i) + "].Bus");
-      vals->push_back(compGPU.controllers[i].bus);
+      snap->Add(key + "Sets", std::to_string(cache->sets));
     }
-    if (gpuAll || contains(&requests, "GPU.VRAM"))
+    if (cacheAll || contains(&ctx->requests, "CPU.CACHE.CPUS"))
     {
-      keys->push_back("gpu[" + std::to_string(i) + "].VRAM");
-      vals->push_back(pretty ? siUnits(compGPU.controllers[i].vram, "B")
-                             : std::to_string(compGPU.controllers[i].vram));
+      snap->Add(key + "CPUs", cache->cpuList);
     }
-    if (gpuAll || contains(&requests, "GPU.DYNAMIC"))
+  }
+
+  bool usageAll = cpuAll || contains(&ctx->requests, "CPU.USAGE");
+  bool coreUsageAll = cpuAll || contains(&ctx->requests, "CPU.COREUSAGE");
+  for (std::size_t i = 0; i < usageFields; ++i)
+  {
+    if (usageAll || contains(&ctx->requests, "CPU.USAGE." + toUpper(usageNames[i])))
     {
-      keys->push_back("gpu[" + std::to_string(i) + "].Dynamic");
-      vals->push_back(compGPU.controllers[i].dynamic ? "Yes" : "No");
+      buffer << std::fixed << std::setprecision(2) << snap->cpuUsage.Percent(0, i) << (ctx->pretty ? " %" : "");
+      snap->Add(std::string("cpu.Usage.") + usageNames[i], buffer.str());
+      buffer.str("");
     }
   }
+  if (usageAll || contains(&ctx->requests, "CPU.USAGE.BUSY"))
+  {
+    buffer << std::fixed << std::setprecision(2) << snap->cpuUsage.Busy(0) << (ctx->pretty ? " %" : "");
+    snap->Add("cpu.Usage.Busy", buffer.str());
+    buffer.str("");
+  }
+  if (usageAll || contains(&ctx->requests, "CPU.USAGE.CONTEXTSWITCHES"))
+  {
+    buffer << std::fixed << std::setprecision(0) << snap->cpuUsage.ContextSwitches();
+    snap->Add("cpu.Usage.ContextSwitches", ctx->pretty ? siUnits((float)snap->cpuUsage.ContextSwitches(), "/s") : buffer.str());
+    buffer.str("");
+  }
+  if (usageAll || contains(&ctx->requests, "CPU.USAGE.INTERRUPTS"))
+  {
+    buffer << std::fixed << std::setprecision(0) << snap->cpuUsage.Interrupts();
+    snap->Add("cpu.Usage.Interrupts", ctx->pretty ? siUnits((float)snap->cpuUsage.Interrupts(), "/s") : buffer.str());
+    buffer.str("");
+  }
 
-  for (std::size_t i = 0; i < compRAM.chips.size(); ++i)
+  // Which fields of each row are wanted only depends on the requests, so it is decided once rather than for every CPU
+  std::array<bool, usageFields> coreUsageFields;
+  for (std::size_t j = 0; j < usageFields; ++j)
+  {
+    coreUsageFields[j] = coreUsageAll || contains(&ctx->requests, "CPU.COREUSAGE." + toUpper(usageNames[j]));
+  }
+  bool coreUsageCPU = coreUsageAll || contains(&ctx->requests, "CPU.COREUSAGE.CPU");
+  bool coreUsageBusy = coreUsageAll || contains(&ctx->requests, "CPU.COREUSAGE.BUSY");
+  for (std::size_t i = 0; i < snap->cpuUsage.Cores(); ++i)
   {
-    if (ramAll || contains(&requests, "RAM.SIZE"))
+    if (coreUsageCPU)
     {
-      keys->push_back("ram[" + std::to_string(i) + "].Size");
-      vals->push_back(pretty
-                          ? siUnits(compRAM.chips[i].size, "B", 0)
-                          : std::to_string(compRAM.chips[i].size));
+      snap->Add("cpu.CoreUsage[" + std::to_string(i) + "].CPU", std::to_string(snap->cpuUsage.cpus[i]));
     }
-    if (ramAll || contains(&requests, "RAM.BANK"))
+    for (std::size_t j = 0; j < usageFields; ++j)
     {
-      keys->push_back("ram[" + std::to_string(i) + "].Bank");
-      vals->push_back(compRAM.chips[i].bank);
+      if (coreUsageFields[j])
+      {
+        buffer << std::fixed << std::setprecision(2) << snap->cpuUsage.Percent(i + 1, j) << (ctx->pretty ? " %" : "");
+        snap->Add("cpu.CoreUsage[" + std::to_string(i) + "]." + usageNames[j], buffer.str());
+        buffer.str("");
+      }
     }
-    if (ramAll || contains(&requests, "RAM.TYPE"))
+    if (coreUsageBusy)
+    {
+      buffer << std::fixed << std::setprecision(2) << snap->cpuUsage.Busy(i + 1) << (ctx->pretty ? " %" : "");
+      snap->Add("cpu.CoreUsage[" + std::to_string(i) + "].Busy", buffer.str());
+      buffer.str("");
+    }
+  }
+
+  ProcessorPower *power = &snap->cpuPower;
+  bool powerAll = cpuAll || contains(&ctx->requests, "CPU.POWER");
+  bool corePowerAll = cpuAll || contains(&ctx->requests, "CPU.COREPOWER");
+  if (powerAll || contains(&ctx->requests, "CPU.POWER.DRIVER"))
+  {
+    snap->Add("cpu.Power.Driver", power->driver);
+  }
+  if (powerAll || contains(&ctx->requests, "CPU.POWER.BOOST"))
+  {
+    snap->Add("cpu.Power.Boost", power->boost);
+  }
+  if (powerAll || contains(&ctx->requests, "CPU.POWER.GOVERNOR"))
+  {
+    snap->Add("cpu.Power.Governor", power->Governors());
+  }
+  if (powerAll || contains(&ctx->requests, "CPU.POWER.DEEPESTIDLE"))
+  {
+    buffer << std::fixed << std::setprecision(2) << power->DeepestIdle() << (ctx->pretty ? " %" : "");
+    snap->Add("cpu.Power.DeepestIdle", buffer.str());
+    buffer.str("");
+  }
+  if (powerAll || contains(&ctx->requests, "CPU.POWER.CORETHROTTLES"))
+  {
+    snap->Add("cpu.Power.CoreThrottles", std::to_string(power->CoreThrottles()));
+  }
+  if (powerAll || contains(&ctx->requests, "CPU.POWER.PACKAGETHROTTLES"))
+  {
+    snap->Add("cpu.Power.PackageThrottles", std::to_string(power->PackageThrottles()));
+  }
+  bool corePowerCPU = corePowerAll || contains(&ctx->requests, "CPU.COREPOWER.CPU");
+  bool corePowerSpeed = corePowerAll || contains(&ctx->requests, "CPU.COREPOWER.SPEED");
+  bool corePowerMinSpeed = corePowerAll || contains(&ctx->requests, "CPU.COREPOWER.MINSPEED");
+  bool corePowerMaxSpeed = corePowerAll || contains(&ctx->requests, "CPU.COREPOWER.MAXSPEED");
+  bool corePowerGovernor = corePowerAll || contains(&ctx->requests, "CPU.COREPOWER.GOVERNOR");
+  bool corePowerEPP = corePowerAll || contains(&ctx->requests, "CPU.COREPOWER.EPP");
+  bool corePowerIdle = corePowerAll || contains(&ctx->requests, "CPU.COREPOWER.IDLE");
+  bool corePowerCoreThrottles = corePowerAll || contains(&ctx->requests, "CPU.COREPOWER.CORETHROTTLES");
+  bool corePowerPackageThrottles = corePowerAll || contains(&ctx->requests, "CPU.COREPOWER.PACKAGETHROTTLES");
+  for (std::size_t i = 0; i < power->cores.size(); ++i)
+  {
+    CorePower *core = &power->cores[i];
+    std::string key = "cpu.CorePower[" + std::to_string(i) + "].";
+    if (corePowerCPU)
     {
-      keys->push_back("ram[" + std::to_string(i) + "].Type");
-      vals->push_back(compRAM.chips[i].type);
+      snap->Add(key + "CPU", std::to_string(core->cpu));
     }
-    if (ramAll || contains(&requests, "RAM.SPEED"))
+    if (corePowerSpeed)
     {
-      keys->push_back("ram[" + std::to_string(i) + "].Speed");
-      vals->push_back(pretty
-                          ? siUnits(compRAM.chips[i].speed, "Hz")
-                          : std::to_string(compRAM.chips[i].speed));
+      snap->Add(key + "Speed", ctx->pretty ? siUnits(core->speed, "Hz") : std::to_string(core->speed));
     }
-    if (ramAll || contains(&requests, "RAM.FORMFACTOR"))
+    if (corePowerMinSpeed)
     {
-      keys->push_back("ram[" + std::to_string(i) + "].FormFactor");
-      vals->push_back(compRAM.chips[i].formFactor);
+      snap->Add(key + "MinSpeed", ctx->pretty ? siUnits(core->minSpeed, "Hz") : std::to_string(core->minSpeed));
     }
-    if (ramAll || contains(&requests, "RAM.MANUFACTURER"))
+    if (corePowerMaxSpeed)
     {
-      keys->push_back("ram[" + std::to_string(i) + "].Manufacturer");
-      vals->push_back(compRAM.chips[i].manufacturer);
+      snap->Add(key + "MaxSpeed", ctx->pretty ? siUnits(core->maxSpeed, "Hz") : std::to_string(core->maxSpeed));
     }
-    if (ramAll || contains(&requests, "RAM.PART"))
+    if (corePowerGovernor)
     {
-      keys->push_back("ram[" + std::to_string(i) + "].Part");
-      vals->push_back(compRAM.chips[i].part);
+      snap->Add(key + "Governor", core->governor);
     }
-    if (ramAll || contains(&requests, "RAM.SERIAL"))
+    if (corePowerEPP)
     {
-      keys->push_back("ram[" + std::to_string(i) + "].Serial");
-      vals->push_back(compRAM.chips[i].serial);
+      snap->Add(key + "EPP", core->epp);
     }
-    if (ramAll || contains(&requests, "RAM.VOLTAGECONFIGURED"))
+    if (corePowerIdle)
     {
-      buffer << std::fixed << std::setprecision(1) << compRAM.chips[i].voltageConfigured << " V";
-      keys->push_back("ram[" + std::to_string(i) + "].VoltageConfigured");
-      vals->push_back(buffer.str());
-      buffer.str("");
+      for (std::size_t j = 0; j < core->idleNames.size(); ++j)
+      {
+        buffer << std::fixed << std::setprecision(2) << power->Residency(i, j) << (ctx->pretty ? " %" : "");
+        snap->Add(key + "Idle." + core->idleNames[j], buffer.str());
+        buffer.str("");
+      }
     }
-    if (ramAll || contains(&requests, "RAM.VOLTAGEMIN"))
+    if (corePowerCoreThrottles)
     {
-      buffer << std::fixed << std::setprecision(1) << compRAM.chips[i].voltageMin << " V";
-      keys->push_back("ram[" + std::to_string(i) + "].VoltageMin");
-      vals->push_back(buffer.str());
-      buffer.str("");
+      snap->Add(key + "CoreThrottles", std::to_string(core->coreThrottles));
     }
-    if (ramAll || contains(&requests, "RAM.VOLTAGEMAX"))
+    if (corePowerPackageThrottles)
     {
-      buffer << std::fixed << std::setprecision(1) << compRAM.chips[i].voltageMax << " V";
-      keys->push_back("ram[" + std::to_string(i) + "].VoltageMax");
-      vals->push_back(buffer.str());
-      buffer.str("");
+      snap->Add(key + "PackageThrottles", std::to_string(core->packageThrottles));
     }
   }
 
-  for (std::size_t i = 0; i < compStorage.drives.size(); ++i)
+  if (chassisAll || contains(&ctx->requests, "CHASSIS.MANUFACTURER"))
+  {
+    snap->Add("chassis.Manufacturer", snap->chassis.manufacturer);
+  }
+  if (chassisAll || contains(&ctx->requests, "CHASSIS.MODEL"))
+  {
+    snap->Add("chassis.Model", snap->chassis.model);
+  }
+  if (chassisAll || contains(&ctx->requests, "CHASSIS.TYPE"))
+  {
+    snap->Add("chassis.Type", snap->chassis.type);
+  }
+  if (chassisAll || contains(&ctx->requests, "CHASSIS.VERSION"))
+  {
+    snap->Add("chassis.Version", snap->chassis.version);
+  }
+  if (chassisAll || contains(&ctx->requests, "CHASSIS.SERIAL"))
+  {
+    snap->Add("chassis.Serial", snap->chassis.serial);
+  }
+  if (chassisAll || contains(&ctx->requests, "CHASSIS.ASSETTAG"))
+  {
+    snap->Add("chassis.AssetTag", snap->chassis.assetTag);
+  }
+
+  for (std::size_t i = 0; i < snap->gpu.controllers.size(); ++i)
   {
-    if (stoAll || contains(&requests, "STORAGE.NAME"))
+    if (gpuAll || contains(&ctx->requests, "GPU.VENDOR"))
+    {
+      snap->Add("gpu[" + std::to_string(i) + "].Vendor", snap->gpu.controllers[i].vendor);
+    }
+    if (gpuAll || contains(&ctx->requests, "GPU.MODEL"))
+    {
+      snap->Add("gpu[" + std::to_string(i) + "].Model", snap->gpu.controllers[i].model);
+    }
+    if (gpuAll || contains(&ctx->requests, "GPU.BUS"))
+    {
+      snap->Add("gpu[" + std::to_string(i) + "].Bus", snap->gpu.controllers[i].bus);
+    }
+    if (gpuAll || contains(&ctx->requests, "GPU.VRAM"))
     {
-      keys->push_back("storage[" + std::to_string(i) + "].Name");
-      vals->push_back(compStorage.drives[i].name);
+      snap->Add("gpu[" + std::to_string(i) + "].VRAM", ctx->pretty ? siUnits(snap->gpu.controllers[i].vram, "B")
+                                                                   : std::to_string(snap->gpu.controllers[i].vram));
     }
-    if (stoAll || contains(&requests, "STORAGE.IDENTIFIER"))
+    if (gpuAll || contains(&ctx->requests, "GPU.DYNAMIC"))
     {
-      keys->push_back("storage[" + std::to_string(i) + "].Identifier");
-      vals->push_back(compStorage.drives[i].identifier);
+      snap->Add("gpu[" + std::to_string(i) + "].Dynamic", snap->gpu.controllers[i].dynamic ? "Yes" : "No");
     }
-    if (stoAll || contains(&requests, "STORAGE.TYPE"))
+  }
+
+  for (std::size_t i = 0; i < snap->ram.chips.size(); ++i)
+  {
+    if (ramAll || contains(&ctx->requests, "RAM.SIZE"))
     {
-      keys->push_back("storage[" + std::to_string(i) + "].Type");
-      vals->push_back(compStorage.drives[i].type);
+      snap->Add("ram[" + std::to_string(i) + "].Size", ctx->pretty
+                                                           ? siUnits(snap->ram.chips[i].size, "B", 0)
+                                                           : std::to_string(snap->ram.chips[i].size));
     }
-    if (stoAll || contains(&requests, "STORAGE.FILESYSTEM"))
+    if (ramAll || contains(&ctx->requests, "RAM.BANK"))
     {
-      keys->push_back("storage[" + std::to_string(i) + "].FileSystem");
-      vals->push_back(compStorage.drives[i].filesystem);
+      snap->Add("ram[" + std::to_string(i) + "].Bank", snap->ram.chips[i].bank);
     }
-    if (stoAll || contains(&requests, "STORAGE.MOUNT"))
+    if (ramAll || contains(&ctx->requests, "RAM.TYPE"))
     {
-      keys->push_back("storage[" + std::to_string(i) + "].Mount");
-      vals->push_back(compStorage.drives[i].mount);
+      snap->Add("ram[" + std::to_string(i) + "].Type", snap->ram.chips[i].type);
     }
-    if (stoAll || contains(&requests, "STORAGE.TOTAL"))
+    if (ramAll || contains(&ctx->requests, "RAM.SPEED"))
     {
-      keys->push_back("storage[" + std::to_string(i) + "].Total");
-      vals->push_back(pretty ? siUnits(compStorage.drives[i].total, "B")
-                             : std::to_string(compStorage.drives[i].total));
+      snap->Add("ram[" + std::to_string(i) + "].Speed", ctx->pretty
+                                                            ? siUnits(snap->ram.chips[i].speed, "Hz")
+                                                            : std::to_string(snap->ram.chips[i].speed));
     }
-    if (stoAll || contains(&requests, "STORAGE.PHYSICAL"))
+    if (ramAll || contains(&ctx->requests, "RAM.FORMFACTOR"))
     {
-      keys->push_back("storage[" + std::to_string(i) + "].Physical");
-      vals->push_back(compStorage.drives[i].physical);
+      snap->Add("ram[" + std::to_string(i) + "].FormFactor", snap->ram.chips[i].formFactor);
     }
-    if (stoAll || contains(&requests, "STORAGE.UUID"))
+    if (ramAll || contains(&ctx->requests, "RAM.MANUFACTURER"))
     {
-      keys->push_back("storage[" + std::to_string(i) + "].UUID");
-      vals->push_back(compStorage.drives[i].uuid);
+      snap->Add("ram[" + std::to_string(i) + "].Manufacturer", snap->ram.chips[i].manufacturer);
     }
-    if (stoAll || contains(&requests, "STORAGE.LABEL"))
+    if (ramAll || contains(&ctx->requests, "RAM.PART"))
     {
-      keys->push_back("storage[" + std::to_string(i) + "].Label");
-      vals->push_back(compStorage.drives[i].label);
+      snap->Add("ram[" + std::to_string(i) + "].Part", snap->ram.chips[i].part);
     }
-    if (stoAll || contains(&requests, "STORAGE.MODEL"))
+    if (ramAll || contains(&ctx->requests, "RAM.SERIAL"))
     {
-      keys->push_back("storage[" + std::to_string(i) + "].Model");
-      vals->push_back(compStorage.drives[i].model);
+      snap->Add("ram[" + std::to_string(i) + "].Serial", snap->ram.chips[i].serial);
     }
-    if (stoAll || contains(&requests, "STORAGE.SERIAL"))
+    if (ramAll || contains(&ctx->requests, "RAM.VOLTAGECONFIGURED"))
     {
-      keys->push_back("storage[" + std::to_string(i) + "].Serial");
-      vals->push_back(compStorage.drives[i].serial);
+      buffer << std::fixed << std::setprecision(1) << snap->ram.chips[i].voltageConfigured << " V";
+      snap->Add("ram[" + std::to_string(i) + "].VoltageConfigured", buffer.str());
+      buffer.str("");
     }
-    if (stoAll || contains(&requests, "STORAGE.REMOVABLE"))
+    if (ramAll || contains(&ctx->requests, "RAM.VOLTAGEMIN"))
     {
-      keys->push_back("storage[" + std::to_string(i) + "].Removable");
-      vals->push_back(compStorage.drives[i].removable ? "Yes" : "No");
+      buffer << std::fixed << std::setprecision(1) << snap->ram.chips[i].voltageMin << " V";
+      snap->Add("ram[" + std::to_string(i) + "].VoltageMin", buffer.str());
+      buffer.str("");
     }
-    if (stoAll || contains(&requests, "STORAGE.PROTOCOL"))
+    if (ramAll || contains(&ctx->requests, "RAM.VOLTAGEMAX"))
     {
-      keys->push_back("storage[" + std::to_string(i) + "].Protocol");
-      vals->push_back(compStorage.drives[i].protocol);
+      buffer << std::fixed << std::setprecision(1) << snap->ram.chips[i].voltageMax << " V";
+      snap->Add("ram[" + std::to_string(i) + "].VoltageMax", buffer.str());
+      buffer.str("");
     }
   }
 
-  for (std::size_t i = 0; i < compFS.fsList.size(); ++i)
+  for (std::size_t i = 0; i < memFields; ++i)
+  {
+    if (memAll || contains(&ctx->requests, "MEM." + toUpper(memNames[i])))
+    {
+      snap->Add(std::string("mem.") + memNames[i], ctx->pretty ? siUnits(snap->mem.Size(i), "B")
+                                                              : std::to_string(snap->mem.Size(i)));
+    }
+  }
+  if (memAll || contains(&ctx->requests, "MEM.SWAPUSED"))
+  {
+    std::uint64_t used = snap->mem.Size(memSwapTotal) > snap->mem.Size(memSwapFree) ? snap->mem.Size(memSwapTotal) - snap->mem.Size(memSwapFree) : 0;
+    snap->Add("mem.SwapUsed", ctx->pretty ? siUnits(used, "B") : std::to_string(used));
+  }
+  for (std::size_t i = 0; i < vmFields; ++i)
   {
-    if (fsAll || contains(&requests, "FS.FS"))
+    if (memAll || contains(&ctx->requests, "MEM." + toUpper(vmNames[i])))
     {
-      keys->push_back("fs[" + std::to_string(i) + "].FS");
-      vals->push_back(compFS.fsList[i].fs);
+      buffer << std::fixed << std::setprecision(0) << snap->mem.Rate(i);
+      snap->Add(std::string("mem.") + vmNames[i], ctx->pretty ? siUnits((float)snap->mem.Rate(i), "/s") : buffer.str());
+      buffer.str("");
     }
-    if (fsAll || contains(&requests, "FS.TYPE"))
+  }
+
+  const char *readings[] = {"Current", "Min", "Max", "Average"};
+  float values[4];
+  std::array<bool, 4> sensorsReadings;
+  for (std::size_t j = 0; j < 4; ++j)
+  {
+    sensorsReadings[j] = sensorsAll || contains(&ctx->requests, "SENSORS." + toUpper(readings[j]));
+  }
+  bool sensorsChip = sensorsAll || contains(&ctx->requests, "SENSORS.CHIP");
+  bool sensorsLabel = sensorsAll || contains(&ctx->requests, "SENSORS.LABEL");
+  bool sensorsType = sensorsAll || contains(&ctx->requests, "SENSORS.TYPE");
+  for (std::size_t i = 0; i < snap->sensors.sensors.size(); ++i)
+  {
+    Sensor *sensor = &snap->sensors.sensors[i];
+    if (sensorsChip)
     {
-      keys->push_back("fs[" + std::to_string(i) + "].Type");
-      vals->push_back(compFS.fsList[i].type);
+      snap->Add("sensors[" + std::to_string(i) + "].Chip", sensor->chip);
     }
-    if (fsAll || contains(&requests, "FS.SIZE"))
+    if (sensorsLabel)
     {
-      keys->push_back("fs[" + std::to_string(i) + "].Size");
-      vals->push_back(pretty ? siUnits(compFS.fsList[i].size, "B")
-                             : std::to_string(compFS.fsList[i].size));
+      snap->Add("sensors[" + std::to_string(i) + "].Label", sensor->label);
     }
-    if (fsAll || contains(&requests, "FS.USED"))
+    if (sensorsType)
     {
-      keys->push_back("fs[" + std::to_string(i) + "].Used");
-      vals->push_back(pretty ? siUnits(compFS.fsList[i].used, "B")
-                             : std::to_string(compFS.fsList[i].used));
+      snap->Add("sensors[" + std::to_string(i) + "].Type", sensor->type);
     }
-    if (fsAll || contains(&requests, "FS.MOUNT"))
+    values[0] = sensor->current;
+    values[1] = sensor->minimum;
+    values[2] = sensor->maximum;
+    values[3] = sensor->Average();
+    for (std::size_t j = 0; j < 4; ++j)
     {
-      keys->push_back("fs[" + std::to_string(i) + "].Mount");
-      vals->push_back(compFS.fsList[i].mount);
+      if (sensor->count == 0 || !sensorsReadings[j])
+      {
+        continue;
+      }
+      if (sensor->type == "Temperature")
+      {
+        buffer << std::fixed << std::setprecision(1) << ktoc(values[j]) << (ctx->pretty ? " \u00B0C" : "");
+      }
+      else if (sensor->type == "Fan")
+      {
+        buffer << std::fixed << std::setprecision(0) << values[j] << (ctx->pretty ? " RPM" : "");
+      }
+      else
+      {
+        buffer << std::fixed << std::setprecision(3) << values[j] << (ctx->pretty ? " V" : "");
+      }
+      snap->Add("sensors[" + std::to_string(i) + "]." + readings[j], buffer.str());
+      buffer.str("");
     }
   }
-}
 
-/**
-* @brief Processes simple output, like a list or default view
-*
-* @param stream The output stream
-* @param keys   The keys to output
-* @param vals   The values to output
-* @param del    The delimiter character
-*/
-void outputSimple(std::ostream &stream, std::vector<std::string> *keys, std::vector<std::string> *vals, const char &del)
-{
-  for (std::size_t i = 0; i < keys->size(); ++i)
+  bool stoName = stoAll || contains(&ctx->requests, "STORAGE.NAME");
+  bool stoIdentifier = stoAll || contains(&ctx->requests, "STORAGE.IDENTIFIER");
+  bool stoType = stoAll || contains(&ctx->requests, "STORAGE.TYPE");
+  bool stoFileSystem = stoAll || contains(&ctx->requests, "STORAGE.FILESYSTEM");
+  bool stoMount = stoAll || contains(&ctx->requests, "STORAGE.MOUNT");
+  bool stoTotal = stoAll || contains(&ctx->requests, "STORAGE.TOTAL");
+  bool stoPhysical = stoAll || contains(&ctx->requests, "STORAGE.PHYSICAL");
+  bool stoUUID = stoAll || contains(&ctx->requests, "STORAGE.UUID");
+  bool stoLabel = stoAll || contains(&ctx->requests, "STORAGE.LABEL");
+  bool stoModel = stoAll || contains(&ctx->requests, "STORAGE.MODEL");
+  bool stoSerial = stoAll || contains(&ctx->requests, "STORAGE.SERIAL");
+  bool stoRemovable = stoAll || contains(&ctx->requests, "STORAGE.REMOVABLE");
+  bool stoProtocol = stoAll || contains(&ctx->requests, "STORAGE.PROTOCOL");
+  bool stoReadIOPS = stoAll || contains(&ctx->requests, "STORAGE.READIOPS");
+  bool stoWriteIOPS = stoAll || contains(&ctx->requests, "STORAGE.WRITEIOPS");
+  bool stoReadBytes = stoAll || contains(&ctx->requests, "STORAGE.READBYTES");
+  bool stoWriteBytes = stoAll || contains(&ctx->requests, "STORAGE.WRITEBYTES");
+  bool stoReadLatency = stoAll || contains(&ctx->requests, "STORAGE.READLATENCY");
+  bool stoWriteLatency = stoAll || contains(&ctx->requests, "STORAGE.WRITELATENCY");
+  bool stoInFlight = stoAll || contains(&ctx->requests, "STORAGE.INFLIGHT");
+  bool stoUtilization = stoAll || contains(&ctx->requests, "STORAGE.UTILIZATION");
+  for (std::size_t i = 0; i < snap->storage.drives.size(); ++i)
   {
-    stream << (*keys)[i] << del << (*vals)[i] << '\n';
-  }
-}
+    if (stoName)
+    {
+      snap->Add("storage[" + std::to_string(i) + "].Name", snap->storage.drives[i].name);
+    }
+    if (stoIdentifier)
+    {
+      snap->Add("storage[" + std::to_string(i) + "].Identifier", snap->storage.drives[i].identifier);
+    }
+    if (stoType)
+    {
+      snap->Add("storage[" + std::to_string(i) + "].Type", snap->storage.drives[i].type);
+    }
+    if (stoFileSystem)
+    {
+      snap->Add("storage[" + std::to_string(i) + "].FileSystem", snap->storage.drives[i].filesystem);
+    }
+    if (stoMount)
+    {
+      snap->Add("storage[" + std::to_string(i) + "].Mount", snap->storage.drives[i].mount);
+    }
+    if (stoTotal)
+    {
+      snap->Add("storage[" + std::to_string(i) + "].Total", ctx->pretty ? siUnits(snap->storage.drives[i].total, "B")
+                                                                        : std::to_string(snap->storage.drives[i].total));
+    }
+    if (stoPhysical)
+    {
+      snap->Add("storage[" + std::to_string(i) + "].Physical", snap->storage.drives[i].physical);
+    }
+    if (stoUUID)
+    {
+      snap->Add("storage[" + std::to_string(i) + "].UUID", snap->storage.drives[i].uuid);
+    }
+    if (stoLabel)
+    {
+      snap->Add("storage[" + std::to_string(i) + "].Label", snap->storage.drives[i].label);
+    }
+    if (stoModel)
+    {
+      snap->Add("storage[" + std::to_string(i) + "].Model", snap->storage.drives[i].model);
+    }
+    if (stoSerial)
+    {
+      snap->Add("storage[" + std::to_string(i) + "].Serial", snap->storage.drives[i].serial);
+    }
+    if (stoRemovable)
+    {
+      snap->Add("storage[" + std::to_string(i) + "].Removable", snap->storage.drives[i].removable ? "Yes" : "No");
+    }
+    if (stoProtocol)
+    {
+      snap->Add("storage[" + std::to_string(i) + "].Protocol", snap->storage.drives[i].protocol);
+    }
 
-/**
-* @brief Processes value output, just the values for the key(s)
-*
-* @param stream The output stream
-* @param vals   The values to output
-*/
-void outputValue(std::ostream &stream, std::vector<std::string> *vals)
-{
-  for (std::size_t i = 0; i < vals->size(); ++i)
+    if (!snap->disks.Find(snap->storage.drives[i].identifier, &row))
+    {
+      continue;
+    }
+    if (stoReadIOPS)
+    {
+      buffer << std::fixed << std::setprecision(0) << snap->disks.ReadIOPS(row);
+      snap->Add("storage[" + std::to_string(i) + "].ReadIOPS", ctx->pretty ? siUnits((float)snap->disks.ReadIOPS(row), "IO/s") : buffer.str());
+      buffer.str("");
+    }
+    if (stoWriteIOPS)
+    {
+      buffer << std::fixed << std::setprecision(0) << snap->disks.WriteIOPS(row);
+      snap->Add("storage[" + std::to_string(i) + "].WriteIOPS", ctx->pretty ? siUnits((float)snap->disks.WriteIOPS(row), "IO/s") : buffer.str());
+      buffer.str("");
+    }
+    if (stoReadBytes)
+    {
+      buffer << std::fixed << std::setprecision(0) << snap->disks.ReadBytes(row);
+      snap->Add("storage[" + std::to_string(i) + "].ReadBytes", ctx->pretty ? siUnits((float)snap->disks.ReadBytes(row), "B/s") : buffer.str());
+      buffer.str("");
+    }
+    if (stoWriteBytes)
+    {
+      buffer << std::fixed << std::setprecision(0) << snap->disks.WriteBytes(row);
+      snap->Add("storage[" + std::to_string(i) + "].WriteBytes", ctx->pretty ? siUnits((float)snap->disks.WriteBytes(row), "B/s") : buffer.str());
+      buffer.str("");
+    }
+    if (stoReadLatency)
+    {
+      buffer << std::fixed << std::setprecision(2) << snap->disks.ReadLatency(row) << (ctx->pretty ? " ms" : "");
+      snap->Add("storage[" + std::to_string(i) + "].ReadLatency", buffer.str());
+      buffer.str("");
+    }
+    if (stoWriteLatency)
+    {
+      buffer << std::fixed << std::setprecision(2) << snap->disks.WriteLatency(row) << (ctx->pretty ? " ms" : "");
+      snap->Add("storage[" + std::to_string(i) + "].WriteLatency", buffer.str());
+      buffer.str("");
+    }
+    if (stoInFlight)
+    {
+      snap->Add("storage[" + std::to_string(i) + "].InFlight", std::to_string(snap->disks.InFlight(row)));
+    }
+    if (stoUtilization)
+    {
+      buffer << std::fixed << std::setprecision(2) << snap->disks.Utilization(row) << (ctx->pretty ? " %" : "");
+      snap->Add("storage[" + std::to_string(i) + "].Utilization", buffer.str());
+      buffer.str("");
+    }
+  }
+
+  std::array<bool, netFields> netTotals;
+  std::array<bool, netFields> netRates;
+  for (std::size_t j = 0; j < netFields; ++j)
+  {
+    netTotals[j] = netAll || contains(&ctx->requests, "NET." + toUpper(netNames[j]));
+    netRates[j] = netAll || contains(&ctx->requests, "NET." + toUpper(netNames[j]) + "RATE");
+  }
+  bool netName = netAll || contains(&ctx->requests, "NET.NAME");
+  bool netAddress = netAll || contains(&ctx->requests, "NET.ADDRESS");
+  bool netState = netAll || contains(&ctx->requests, "NET.STATE");
+  bool netSpeed = netAll || contains(&ctx->requests, "NET.SPEED");
+  bool netMTU = netAll || contains(&ctx->requests, "NET.MTU");
+  for (std::size_t i = 0; i < snap->net.interfaces.size(); ++i)
+  {
+    if (netName)
+    {
+      snap->Add("net[" + std::to_string(i) + "].Name", snap->net.interfaces[i].name);
+    }
+    if (netAddress)
+    {
+      snap->Add("net[" + std::to_string(i) + "].Address", snap->net.interfaces[i].address);
+    }
+    if (netState)
+    {
+      snap->Add("net[" + std::to_string(i) + "].State", snap->net.interfaces[i].state);
+    }
+    if (netSpeed)
+    {
+      snap->Add("net[" + std::to_string(i) + "].Speed", ctx->pretty ? siUnits(snap->net.interfaces[i].speed, "b/s")
+                                                                   : std::to_string(snap->net.interfaces[i].speed));
+    }
+    if (netMTU)
+    {
+      snap->Add("net[" + std::to_string(i) + "].MTU", std::to_string(snap->net.interfaces[i].mtu));
+    }
+    for (std::size_t j = 0; j < netFields; ++j)
+    {
+      // Bytes are sized, while packets, errors and drops are plain counts
+      bool bytes = j % 4 == 0;
+      if (netTotals[j])
+      {
+        snap->Add("net[" + std::to_string(i) + "]." + netNames[j], ctx->pretty && bytes ? siUnits(snap->net.Total(i, j), "B")
+                                                                                       : std::to_string(snap->net.Total(i, j)));
+      }
+      if (netRates[j])
+      {
+        buffer << std::fixed << std::setprecision(0) << snap->net.Rate(i, j);
+        snap->Add("net[" + std::to_string(i) + "]." + netNames[j] + "Rate", ctx->pretty ? siUnits((float)snap->net.Rate(i, j), bytes ? "B/s" : "/s")
+                                                                                         : buffer.str());
+        buffer.str("");
+      }
+    }
+  }
+
+  bool fsFS = fsAll || contains(&ctx->requests, "FS.FS");
+  bool fsType = fsAll || contains(&ctx->requests, "FS.TYPE");
+  bool fsSize = fsAll || contains(&ctx->requests, "FS.SIZE");
+  bool fsUsed = fsAll || contains(&ctx->requests, "FS.USED");
+  bool fsMount = fsAll || contains(&ctx->requests, "FS.MOUNT");
+  for (std::size_t i = 0; i < snap->fs.fsList.size(); ++i)
+  {
+    if (fsFS)
+    {
+      snap->Add("fs[" + std::to_string(i) + "].FS", snap->fs.fsList[i].fs);
+    }
+    if (fsType)
+    {
+      snap->Add("fs[" + std::to_string(i) + "].Type", snap->fs.fsList[i].type);
+    }
+    if (fsSize)
+    {
+      snap->Add("fs[" + std::to_string(i) + "].Size", ctx->pretty ? siUnits(snap->fs.fsList[i].size, "B")
+                                                                  : std::to_string(snap->fs.fsList[i].size));
+    }
+    if (fsUsed)
+    {
+      snap->Add("fs[" + std::to_string(i) + "].Used", ctx->pretty ? siUnits(snap->fs.fsList[i].used, "B")
+                                                                  : std::to_string(snap->fs.fsList[i].used));
+    }
+    if (fsMount)
+    {
+      snap->Add("fs[" + std::to_string(i) + "].Mount", snap->fs.fsList[i].mount);
+    }
+  }
+
+  if (procAll || contains(&ctx->requests, "PROC.COUNT"))
+  {
+    snap->Add("proc.Count", std::to_string(snap->proc.count));
+  }
+  if (procAll || contains(&ctx->requests, "PROC.THREADS"))
+  {
+    snap->Add("proc.Threads", std::to_string(snap->proc.threads));
+  }
+  for (std::size_t m = 0; m < procMetrics; ++m)
+  {
+    if (!procAll && !contains(&ctx->requests, "PROC." + toUpper(procRankings[m])))
+    {
+      continue;
+    }
+    for (std::size_t i = 0; i < snap->proc.ranked[m].size(); ++i)
+    {
+      Process *p = &snap->proc.ranked[m][i];
+      std::string key = std::string("proc.") + procRankings[m] + "[" + std::to_string(i) + "].";
+      snap->Add(key + "PID", std::to_string(p->pid));
+      snap->Add(key + "Name", p->name);
+      snap->Add(key + "State", p->state);
+      snap->Add(key + "Threads", std::to_string(p->threads));
+      buffer << std::fixed << std::setprecision(2) << p->cpu << (ctx->pretty ? " %" : "");
+      snap->Add(key + "CPU", buffer.str());
+      buffer.str("");
+      snap->Add(key + "RSS", ctx->pretty ? siUnits(p->rss, "B") : std::to_string(p->rss));
+      buffer << std::fixed << std::setprecision(0) << p->io;
+      snap->Add(key + "IO", ctx->pretty ? siUnits((float)p->io, "B/s") : buffer.str());
+      buffer.str("");
+    }
+  }
+
+  if (numaAll || contains(&ctx->requests, "NUMA.COUNT"))
+  {
+    snap->Add("numa.Count", std::to_string(snap->numa.nodes.size()));
+  }
+  if (numaAll || contains(&ctx->requests, "NUMA.IMBALANCE"))
+  {
+    buffer << std::fixed << std::setprecision(2) << snap->numa.Imbalance() << (ctx->pretty ? " %" : "");
+    snap->Add("numa.Imbalance", buffer.str());
+    buffer.str("");
+  }
+  if (numaAll || contains(&ctx->requests, "NUMA.MISSRATIO"))
+  {
+    buffer << std::fixed << std::setprecision(2) << snap->numa.MissRatio() << (ctx->pretty ? " %" : "");
+    snap->Add("numa.MissRatio", buffer.str());
+    buffer.str("");
+  }
+  std::array<bool, numaFields> numaCounters;
+  for (std::size_t f = 0; f < numaFields; ++f)
+  {
+    numaCounters[f] = numaAll || contains(&ctx->requests, "NUMA." + toUpper(numaNames[f]));
+  }
+  bool numaNode = numaAll || contains(&ctx->requests, "NUMA.NODE");
+  bool numaCPUs = numaAll || contains(&ctx->requests, "NUMA.CPUS");
+  bool numaCPUCount = numaAll || contains(&ctx->requests, "NUMA.CPUCOUNT");
+  bool numaMemTotal = numaAll || contains(&ctx->requests, "NUMA.MEMTOTAL");
+  bool numaMemFree = numaAll || contains(&ctx->requests, "NUMA.MEMFREE");
+  bool numaDistance = numaAll || contains(&ctx->requests, "NUMA.DISTANCE");
+  bool numaDIMMs = numaAll || contains(&ctx->requests, "NUMA.DIMMS");
+  for (std::size_t i = 0; i < snap->numa.nodes.size(); ++i)
+  {
+    NumaNode *node = &snap->numa.nodes[i];
+    std::string key = "numa[" + std::to_string(i) + "].";
+    if (numaNode)
+    {
+      snap->Add(key + "Node", std::to_string(node->id));
+    }
+    if (numaCPUs)
+    {
+      snap->Add(key + "CPUs", node->cpuList);
+    }
+    if (numaCPUCount)
+    {
+      snap->Add(key + "CPUCount", std::to_string(node->cpus.size()));
+    }
+    if (numaMemTotal)
+    {
+      snap->Add(key + "MemTotal", ctx->pretty ? siUnits(node->memTotal, "B") : std::to_string(node->memTotal));
+    }
+    if (numaMemFree)
+    {
+      snap->Add(key + "MemFree", ctx->pretty ? siUnits(node->memFree, "B") : std::to_string(node->memFree));
+    }
+    if (numaDistance)
+    {
+      for (std::size_t j = 0; j < node->distances.size(); ++j)
+      {
+        buffer << (j > 0 ? " " : "") << node->distances[j];
+      }
+      snap->Add(key + "Distance", buffer.str());
+      buffer.str("");
+    }
+    for (std::size_t f = 0; f < numaFields; ++f)
+    {
+      if (numaCounters[f])
+      {
+        snap->Add(key + numaNames[f], std::to_string(node->counters[f]));
+      }
+    }
+    if (numaDIMMs)
+    {
+      for (std::size_t j = 0; j < node->banks.size(); ++j)
+      {
+        buffer << (j > 0 ? ", " : "") << node->banks[j];
+      }
+      snap->Add(key + "DIMMs", buffer.str());
+      buffer.str("");
+    }
+  }
+
+  if (kernelAll || contains(&ctx->requests, "KERNEL.CMDLINE"))
+  {
+    snap->Add("kernel.CmdLine", snap->kernel.cmdline);
+  }
+  if (kernelAll || contains(&ctx->requests, "KERNEL.MITIGATIONS"))
+  {
+    snap->Add("kernel.Mitigations", snap->kernel.Param("mitigations", "auto"));
+  }
+  if (kernelAll || contains(&ctx->requests, "KERNEL.ISOLCPUS"))
+  {
+    snap->Add("kernel.IsolCPUs", snap->kernel.Param("isolcpus"));
+  }
+  if (kernelAll || contains(&ctx->requests, "KERNEL.NOHZFULL"))
+  {
+    snap->Add("kernel.NoHzFull", snap->kernel.Param("nohz_full"));
+  }
+  if (kernelAll || contains(&ctx->requests, "KERNEL.RCUNOCBS"))
+  {
+    snap->Add("kernel.RcuNoCbs", snap->kernel.Param("rcu_nocbs"));
+  }
+  if (kernelAll || contains(&ctx->requests, "KERNEL.TRANSPARENTHUGEPAGE"))
+  {
+    // The live setting wins over the boot parameter, which may have been changed since
+    snap->Add("kernel.TransparentHugepage", snap->kernel.hugepages.empty() ? snap->kernel.Param("transparent_hugepage") : snap->kernel.hugepages);
+  }
+  if (kernelAll || contains(&ctx->requests, "KERNEL.IRQAFFINITY"))
+  {
+    snap->Add("kernel.IRQAffinity", snap->kernel.irqAffinity);
+  }
+  if (kernelAll || contains(&ctx->requests, "KERNEL.VULNERABLE"))
+  {
+    snap->Add("kernel.Vulnerable", std::to_string(snap->kernel.Count("Vulnerable")));
+  }
+  if (kernelAll || contains(&ctx->requests, "KERNEL.MITIGATED"))
+  {
+    snap->Add("kernel.Mitigated", std::to_string(snap->kernel.Count("Mitigated")));
+  }
+  bool vulnAll = kernelAll || contains(&ctx->requests, "KERNEL.VULNERABILITY");
+  for (std::size_t i = 0; i < snap->kernel.vulnerabilities.size(); ++i)
+  {
+    Vulnerability *vuln = &snap->kernel.vulnerabilities[i];
+    // Keyed by name rather than position, so the same vulnerability lines up across kernels
+    std::string key = "kernel.Vulnerability." + vuln->name + ".";
+    if (vulnAll || contains(&ctx->requests, "KERNEL.VULNERABILITY.STATE"))
+    {
+      snap->Add(key + "State", vuln->state);
+    }
+    if (vulnAll || contains(&ctx->requests, "KERNEL.VULNERABILITY.DETAIL"))
+    {
+      snap->Add(key + "Detail", vuln->detail);
+    }
+  }
+
+  if (cgroupAll || contains(&ctx->requests, "CGROUP.VERSION"))
+  {
+    snap->Add("cgroup.Version", std::to_string(snap->cgroup.version));
+  }
+  if (cgroupAll || contains(&ctx->requests, "CGROUP.PATH"))
+  {
+    snap->Add("cgroup.Path", snap->cgroup.path);
+  }
+  if (cgroupAll || contains(&ctx->requests, "CGROUP.CPUQUOTA"))
+  {
+    // Unlimited limits read as max, the same as the kernel writes them
+    buffer << std::fixed << std::setprecision(2) << snap->cgroup.Quota();
+    snap->Add("cgroup.CPUQuota", snap->cgroup.cpuQuota == 0 ? "max" : buffer.str());
+    buffer.str("");
+  }
+  if (cgroupAll || contains(&ctx->requests, "CGROUP.CPUPERIOD"))
+  {
+    snap->Add("cgroup.CPUPeriod", std::to_string(snap->cgroup.cpuPeriod) + (ctx->pretty ? " us" : ""));
+  }
+  if (cgroupAll || contains(&ctx->requests, "CGROUP.CPUS"))
+  {
+    snap->Add("cgroup.CPUs", snap->cgroup.cpuList);
+  }
+  if (cgroupAll || contains(&ctx->requests, "CGROUP.EFFECTIVECPUS"))
+  {
+    snap->Add("cgroup.EffectiveCPUs", std::to_string(snap->cgroup.EffectiveCPUs()));
+  }
+  if (cgroupAll || contains(&ctx->requests, "CGROUP.MEMORYMAX"))
+  {
+    snap->Add("cgroup.MemoryMax", snap->cgroup.memoryMax == 0 ? "max" : ctx->pretty ? siUnits(snap->cgroup.memoryMax, "B") : std::to_string(snap->cgroup.memoryMax));
+  }
+  if (cgroupAll || contains(&ctx->requests, "CGROUP.MEMORYHIGH"))
+  {
+    snap->Add("cgroup.MemoryHigh", snap->cgroup.memoryHigh == 0 ? "max" : ctx->pretty ? siUnits(snap->cgroup.memoryHigh, "B") : std::to_string(snap->cgroup.memoryHigh));
+  }
+  if (cgroupAll || contains(&ctx->requests, "CGROUP.MEMORYCURRENT"))
+  {
+    snap->Add("cgroup.MemoryCurrent", ctx->pretty ? siUnits(snap->cgroup.memoryCurrent, "B") : std::to_string(snap->cgroup.memoryCurrent));
+  }
+  if (cgroupAll || contains(&ctx->requests, "CGROUP.PERIODS"))
+  {
+    snap->Add("cgroup.Periods", std::to_string(snap->cgroup.periods));
+  }
+  if (cgroupAll || contains(&ctx->requests, "CGROUP.THROTTLED"))
+  {
+    snap->Add("cgroup.Throttled", std::to_string(snap->cgroup.throttled));
+  }
+  if (cgroupAll || contains(&ctx->requests, "CGROUP.THROTTLEDTIME"))
+  {
+    snap->Add("cgroup.ThrottledTime", std::to_string(snap->cgroup.throttledTime) + (ctx->pretty ? " us" : ""));
+  }
+
+  if (cgroupsAll || contains(&ctx->requests, "CGROUPS.COUNT"))
+  {
+    snap->Add("cgroups.Count", std::to_string(snap->cgroups.nodes.size()));
+  }
+  // The whole tree can run to thousands of cgroups, so it is only given when asked for by name
+  std::vector<std::pair<std::string, std::size_t>> groups;
+  for (std::size_t m = 0; m < cgroupMetrics; ++m)
+  {
+    bool ranking = cgroupsAll || contains(&ctx->requests, "CGROUPS." + toUpper(cgroupRankings[m]));
+    for (std::size_t i = 0; ranking && i < snap->cgroups.ranked[m].size(); ++i)
+    {
+      groups.emplace_back(std::string("cgroups.") + cgroupRankings[m] + "[" + std::to_string(i) + "].", snap->cgroups.ranked[m][i]);
+    }
+  }
+  bool cgroupsTree = contains(&ctx->requests, "CGROUPS.TREE");
+  for (std::size_t i = 0; cgroupsTree && i < snap->cgroups.nodes.size(); ++i)
+  {
+    groups.emplace_back("cgroups.Tree[" + std::to_string(i) + "].", i);
+  }
+  for (std::size_t g = 0; g < groups.size(); ++g)
+  {
+    ControlGroupSample *c = &snap->cgroups.nodes[groups[g].second];
+    const std::string &key = groups[g].first;
+    snap->Add(key + "Path", "/" + c->path);
+    buffer << std::fixed << std::setprecision(2) << c->cpu << (ctx->pretty ? " %" : "");
+    snap->Add(key + "CPU", buffer.str());
+    buffer.str("");
+    snap->Add(key + "Memory", ctx->pretty ? siUnits(c->memory, "B") : std::to_string(c->memory));
+    buffer << std::fixed << std::setprecision(0) << c->ioRate;
+    snap->Add(key + "IO", ctx->pretty ? siUnits((float)c->ioRate, "B/s") : buffer.str());
+    buffer.str("");
+    for (std::size_t k = 0; k < pressureKinds; ++k)
+    {
+      buffer << std::fixed << std::setprecision(2) << c->pressure[k] << (ctx->pretty ? " %" : "");
+      snap->Add(key + pressureNames[k] + "Pressure", buffer.str());
+      buffer.str("");
+    }
+  }
+
+  for (std::size_t k = 0; k < pressureKinds; ++k)
+  {
+    if (!pressureAll && !contains(&ctx->requests, "PRESSURE." + toUpper(pressureNames[k])))
+    {
+      continue;
+    }
+    for (std::size_t l = 0; l < pressureLines; ++l)
+    {
+      PressureLine *line = &snap->pressure.lines[k][l];
+      std::string key = std::string("pressure.") + pressureNames[k] + "." + pressureLineNames[l] + ".";
+      // Kernels before 5.13 have no full line for the CPU
+      if (!line->present)
+      {
+        continue;
+      }
+      for (std::size_t a = 0; a < pressureAverages; ++a)
+      {
+        buffer << std::fixed << std::setprecision(2) << line->avg[a] << (ctx->pretty ? " %" : "");
+        snap->Add(key + pressureAverageNames[a], buffer.str());
+        buffer.str("");
+      }
+      snap->Add(key + "Total", std::to_string(line->total) + (ctx->pretty ? " us" : ""));
+    }
+  }
+
+  if (schedAll || contains(&ctx->requests, "SCHED.STATUS"))
+  {
+    snap->Add("sched.Status", snap->sched.status);
+  }
+
+  // The totals over every CPU come first, then each CPU and each process followed, all with the same counters
+  bool schedCPU = schedAll || contains(&ctx->requests, "SCHED.CPU");
+  bool schedPID = schedAll || contains(&ctx->requests, "SCHED.PID");
+  bool schedTimeslices = contains(&ctx->requests, "SCHED.TIMESLICES");
+  bool schedWaitPerSlice = contains(&ctx->requests, "SCHED.WAITPERSLICE");
+  for (std::size_t row = 0; row < snap->sched.PidRow(snap->sched.pids.size()); ++row)
+  {
+    std::string key = "sched.";
+    if (row == 0 && !snap->sched.enabled)
+    {
+      continue;
+    }
+    if (row > 0 && row <= snap->sched.cpus.size())
+    {
+      if (!schedCPU)
+      {
+        continue;
+      }
+      key += "CPU[" + std::to_string(row - 1) + "].";
+      snap->Add(key + "CPU", std::to_string(snap->sched.cpus[row - 1]));
+    }
+    if (row > snap->sched.cpus.size())
+    {
+      std::size_t i = row - snap->sched.PidRow(0);
+      if (!schedPID)
+      {
+        continue;
+      }
+      key += "PID[" + std::to_string(i) + "].";
+      snap->Add(key + "PID", std::to_string(snap->sched.pids[i]));
+      snap->Add(key + "Name", snap->sched.names[i]);
+    }
+    bool whole = schedAll || row > 0;
+    for (std::size_t f = 0; f < 2; ++f)
+    {
+      if (whole || contains(&ctx->requests, "SCHED." + toUpper(schedNames[f])))
+      {
+        buffer << std::fixed << std::setprecision(2) << snap->sched.Share(row, f) << (ctx->pretty ? " %" : "");
+        snap->Add(key + schedNames[f], buffer.str());
+        buffer.str("");
+      }
+    }
+    if (whole || schedTimeslices)
+    {
+      buffer << std::fixed << std::setprecision(0) << snap->sched.Timeslices(row);
+      snap->Add(key + "Timeslices", ctx->pretty ? siUnits((float)snap->sched.Timeslices(row), "/s") : buffer.str());
+      buffer.str("");
+    }
+    if (whole || schedWaitPerSlice)
+    {
+      buffer << std::fixed << std::setprecision(2) << snap->sched.WaitPerSlice(row) << (ctx->pretty ? " us" : "");
+      snap->Add(key + "WaitPerSlice", buffer.str());
+      buffer.str("");
+    }
+  }
+
+  InterruptStats *irq = &snap->irq;
+  std::array<double, 3> irqTotals = {0, 0, 0};
+  std::array<const char *, 3> irqTotalNames = {"Interrupts", "System", "Softirqs"};
+  for (std::size_t c = 0; c < irq->device.size(); ++c)
+  {
+    irqTotals[0] += irq->device[c];
+    irqTotals[1] += irq->system[c];
+    irqTotals[2] += irq->softirq[c];
+  }
+  for (std::size_t t = 0; t < irqTotals.size(); ++t)
+  {
+    if (irqAll || contains(&ctx->requests, "IRQ." + toUpper(irqTotalNames[t])))
+    {
+      buffer << std::fixed << std::setprecision(0) << irqTotals[t];
+      snap->Add(std::string("irq.") + irqTotalNames[t], ctx->pretty ? siUnits((float)irqTotals[t], "/s") : buffer.str());
+      buffer.str("");
+    }
+  }
+  if (irqAll || contains(&ctx->requests, "IRQ.SKEW"))
+  {
+    buffer << std::fixed << std::setprecision(2) << irq->Skew();
+    snap->Add("irq.Skew", buffer.str());
+    buffer.str("");
+  }
+  if (irqAll || contains(&ctx->requests, "IRQ.HOTCPUS"))
+  {
+    std::vector<std::uint32_t> hot;
+    for (std::size_t c = 0; c < irq->hot.size(); ++c)
+    {
+      if (irq->hot[c])
+      {
+        hot.push_back(irq->irqs.cpus[c]);
+      }
+    }
+    snap->Add("irq.HotCPUs", formatCpuList(hot));
+  }
+  bool irqCPU = irqAll || contains(&ctx->requests, "IRQ.CPU");
+  for (std::size_t c = 0; irqCPU && c < irq->irqs.cpus.size(); ++c)
+  {
+    std::string key = "irq.CPU[" + std::to_string(c) + "].";
+    std::array<double, 3> rates = {irq->device[c], irq->system[c], irq->softirq[c]};
+    snap->Add(key + "CPU", std::to_string(irq->irqs.cpus[c]));
+    for (std::size_t t = 0; t < rates.size(); ++t)
+    {
+      buffer << std::fixed << std::setprecision(0) << rates[t];
+      snap->Add(key + irqTotalNames[t], ctx->pretty ? siUnits((float)rates[t], "/s") : buffer.str());
+      buffer.str("");
+    }
+    buffer << std::fixed << std::setprecision(2) << (irqTotals[0] > 0 ? irq->device[c] / irqTotals[0] * 100 : 0) << (ctx->pretty ? " %" : "");
+    snap->Add(key + "Share", buffer.str());
+    buffer.str("");
+    snap->Add(key + "Hot", irq->hot[c] ? "Yes" : "No");
+  }
+  bool irqSoftirq = irqAll || contains(&ctx->requests, "IRQ.SOFTIRQ");
+  for (std::size_t r = 0; irqSoftirq && r < irq->soft.labels.size(); ++r)
+  {
+    std::string key = "irq.Softirq[" + std::to_string(r) + "].";
+    snap->Add(key + "Name", irq->soft.labels[r]);
+    buffer << std::fixed << std::setprecision(0) << irq->soft.rates[r];
+    snap->Add(key + "Rate", ctx->pretty ? siUnits((float)irq->soft.rates[r], "/s") : buffer.str());
+    buffer.str("");
+    buffer << std::fixed << std::setprecision(2) << irq->soft.skews[r];
+    snap->Add(key + "Skew", buffer.str());
+    buffer.str("");
+    snap->Add(key + "Busiest", std::to_string(irq->soft.busiest[r]));
+  }
+  // Every IRQ can run to thousands on a large computer, so they are only given when asked for by name
+  std::vector<std::pair<std::string, std::size_t>> lines;
+  bool irqTopIRQ = irqAll || contains(&ctx->requests, "IRQ.TOPIRQ");
+  for (std::size_t i = 0; irqTopIRQ && i < irq->ranked.size(); ++i)
+  {
+    lines.emplace_back("irq.TopIRQ[" + std::to_string(i) + "].", irq->ranked[i]);
+  }
+  bool irqIRQ = contains(&ctx->requests, "IRQ.IRQ");
+  for (std::size_t r = 0, i = 0; irqIRQ && r < irq->irqs.labels.size(); ++r)
+  {
+    if (irq->Device(r))
+    {
+      lines.emplace_back("irq.IRQ[" + std::to_string(i++) + "].", r);
+    }
+  }
+  for (std::size_t l = 0; l < lines.size(); ++l)
+  {
+    const std::string &key = lines[l].first;
+    const std::size_t &r = lines[l].second;
+    snap->Add(key + "IRQ", irq->irqs.labels[r]);
+    snap->Add(key + "Device", irq->irqs.devices[r]);
+    buffer << std::fixed << std::setprecision(0) << irq->irqs.rates[r];
+    snap->Add(key + "Rate", ctx->pretty ? siUnits((float)irq->irqs.rates[r], "/s") : buffer.str());
+    buffer.str("");
+    buffer << std::fixed << std::setprecision(2) << irq->irqs.skews[r];
+    snap->Add(key + "Skew", buffer.str());
+    buffer.str("");
+    snap->Add(key + "Busiest", std::to_string(irq->irqs.busiest[r]));
+    snap->Add(key + "Affinity", irq->affinity[r]);
+    snap->Add(key + "Effective", irq->effective[r]);
+  }
+}
+
+/**
+* @brief Processes simple output, like a list or default view
+*
+* @param stream The output stream
+* @param keys   The keys to output
+* @param vals   The values to output
+* @param del    The delimiter character
+*/
+void outputSimple(std::ostream &stream, std::vector<const char *> *keys, std::vector<const char *> *vals, const char &del)
+{
+  for (std::size_t i = 0; i < keys->size(); ++i)
+  {
+    stream << (*keys)[i] << del << (*vals)[i] << '\n';
+  }
+}
+
+/**
+* @brief Processes value output, just the values for the key(s)
+*
+* @param stream The output stream
+* @param vals   The values to output
+*/
+void outputValue(std::ostream &stream, std::vector<const char *> *vals)
+{
+  for (std::size_t i = 0; i < vals->size(); ++i)
   {
     stream << (*vals)[i] << '\n';
   }
 }
 
 /**
-* @brief Outputs all of the requests
+* @brief Processes JSON output, a single object of the keys and values
+*
+* @param stream The output stream
+* @param keys   The keys to output
+* @param vals   The values to output
+*/
+void outputJson(std::ostream &stream, std::vector<const char *> *keys, std::vector<const char *> *vals)
+{
+  stream << '{';
+  for (std::size_t i = 0; i < keys->size(); ++i)
+  {
+    stream << (i ? "," : "") << '"' << jsonEscape((*keys)[i]) << "\":\"" << jsonEscape((*vals)[i]) << '"';
+  }
+  stream << '}' << '\n';
+}
+
+/**
+* @brief Outputs a single sample of a watch as one line, led by its timestamp
+*
+* @param ctx     The context holding the output settings
+* @param keys    The keys to output
+* @param vals    The values to output
+* @param removed The keys which were in the last sample, but are not in this one
+* @param ts      The monotonic time of the sample, in nanoseconds
+* @param stream  The output stream
+*/
+void outputTick(Context *ctx, std::vector<const char *> *keys, std::vector<const char *> *vals, std::vector<std::string> *removed, const std::uint64_t &ts, std::ostream &stream)
+{
+  if (ctx->style == OutputStyle::Json)
+  {
+    stream << "{\"ts\":";
+  }
+  stream << ts / 1000000000 << '.' << std::setw(3) << std::setfill('0') << ts / 1000000 % 1000 << std::setfill(' ');
+  for (std::size_t i = 0; i < keys->size(); ++i)
+  {
+    switch (ctx->style)
+    {
+    case OutputStyle::Json:
+      stream << ",\"" << jsonEscape((*keys)[i]) << "\":\"" << jsonEscape((*vals)[i]) << '"';
+      break;
+    case OutputStyle::Value:
+      stream << '\t' << (*vals)[i];
+      break;
+    default:
+      stream << '\t' << (*keys)[i] << '=' << (*vals)[i];
+      break;
+    }
+  }
+  for (std::size_t i = 0; i < removed->size(); ++i)
+  {
+    if (ctx->style == OutputStyle::Json)
+    {
+      stream << ",\"" << jsonEscape((*removed)[i]) << "\":null";
+    }
+    else
+    {
+      stream << '\t' << (*removed)[i];
+    }
+  }
+  stream << (ctx->style == OutputStyle::Json ? "}\n" : "\n") << std::flush;
+}
+
+/**
+* @brief Finds the fields of a snapshot which changed since the last one
+*
+* @param snap    The snapshot to compare
+* @param last    The values of the last snapshot, by key, which is updated to this one
+* @param tick    The number of this snapshot, to mark the fields it still has
+* @param keys    The keys which are new or changed
+* @param vals    The values which are new or changed
+* @param removed The keys which the last snapshot had, but this one does not
+*/
+void diffRequests(Snapshot *snap, std::unordered_map<std::string, SeenField> *last, const std::uint64_t &tick,
+                  std::vector<const char *> *keys, std::vector<const char *> *vals, std::vector<std::string> *removed)
+{
+  std::string key;
+  std::unordered_map<std::string, SeenField>::iterator field;
+  keys->clear();
+  vals->clear();
+  removed->clear();
+
+  for (std::size_t i = 0; i < snap->keys.size(); ++i)
+  {
+    key.assign(snap->keys[i]);
+    field = last->find(key);
+    if (field == last->end())
+    {
+      field = last->emplace(key, SeenField()).first;
+    }
+    else if (field->second.val == snap->vals[i])
+    {
+      field->second.tick = tick;
+      continue;
+    }
+    field->second.val.assign(snap->vals[i]);
+    field->second.tick = tick;
+    keys->push_back(snap->keys[i]);
+    vals->push_back(snap->vals[i]);
+  }
+
+  for (field = last->begin(); field != last->end();)
+  {
+    if (field->second.tick == tick)
+    {
+      ++field;
+      continue;
+    }
+    removed->push_back(field->first);
+    field = last->erase(field);
+  }
+  std::sort(removed->begin(), removed->end());
+}
+
+/**
+* @brief Collects and formats a snapshot of all of the requests
+*
+* @param ctx  The context holding the requests
+* @param snap The snapshot to fill
+*/
+void queryRequests(Context *ctx, Snapshot *snap)
+{
+  std::vector<std::string> cats;
+  Sysroot root = ctx->root.empty() ? Sysroot() : Sysroot(ctx->root);
+  if (!ctx->root.empty() && !root.Good())
+  {
+    throw std::runtime_error("cannot open root directory " + ctx->root);
+  }
+
+  SysrootScope rootScope(ctx->root.empty() ? nullptr : &root);
+  gatherCategories(ctx, &cats);
+  collectRequests(ctx, snap, &cats);
+  if (sampleRequests(ctx, snap, &cats))
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ctx->window));
+    sampleRequests(ctx, snap, &cats);
+  }
+  TimingScope scope(ctx->timings != TimingStyle::None ? &snap->timings : nullptr, "format");
+  gatherRequests(ctx, snap);
+}
+
+/**
+* @brief Set by SIGINT or SIGTERM to stop a watch after its current sample
+*/
+static volatile std::sig_atomic_t stopWatch = 0;
+
+/**
+* @brief Stops a watch after its current sample, so its history is written out
+*
+* @param sig The signal received
+*/
+static void onWatchSignal(int sig)
+{
+  stopWatch = sig;
+}
+
+/**
+* @brief Gets what a row of a list is known by, which unlike its place in the list stays the same between samples
+*
+* @param  snap  The snapshot the row was gathered from
+* @param  list  The list, the key up to the bracket, like fs or proc.TopCPU
+* @param  row   The place of the row in the list
+* @param  id    The identity, like the mount point, PID or cgroup path
+* @return true  The row has an identity
+* @return false The list keeps its order, like the RAM chips, so its rows are known by their place
+*/
+bool rowIdentity(Snapshot *snap, const std::string &list, const std::size_t &row, std::string *id)
+{
+  InterruptStats *irq = &snap->irq;
+
+  if (list == "cpu.CoreUsage" && row < snap->cpuUsage.cpus.size())
+  {
+    *id = std::to_string(snap->cpuUsage.cpus[row]);
+    return true;
+  }
+  if (list == "cpu.CorePower" && row < snap->cpuPower.cores.size())
+  {
+    *id = std::to_string(snap->cpuPower.cores[row].cpu);
+    return true;
+  }
+  if (list == "sensors" && row < snap->sensors.sensors.size())
+  {
+    *id = snap->sensors.sensors[row].chip + "/" + snap->sensors.sensors[row].label;
+    return true;
+  }
+  if (list == "storage" && row < snap->storage.drives.size())
+  {
+    *id = snap->storage.drives[row].name;
+    return true;
+  }
+  if (list == "net" && row < snap->net.interfaces.size())
+  {
+    *id = snap->net.interfaces[row].name;
+    return true;
+  }
+  if (list == "fs" && row < snap->fs.fsList.size())
+  {
+    *id = snap->fs.fsList[row].mount;
+    return true;
+  }
+  if (list == "numa" && row < snap->numa.nodes.size())
+  {
+    *id = std::to_string(snap->numa.nodes[row].id);
+    return true;
+  }
+  for (std::size_t m = 0; m < procMetrics; ++m)
+  {
+    if (list.compare(0, 5, "proc.") == 0 && list.compare(5, std::string::npos, procRankings[m]) == 0 && row < snap->proc.ranked[m].size())
+    {
+      *id = std::to_string(snap->proc.ranked[m][row].pid);
+      return true;
+    }
+  }
+  for (std::size_t m = 0; m < cgroupMetrics; ++m)
+  {
+    if (list.compare(0, 8, "cgroups.") == 0 && list.compare(8, std::string::npos, cgroupRankings[m]) == 0 && row < snap->cgroups.ranked[m].size())
+    {
+      *id = "/" + snap->cgroups.nodes[snap->cgroups.ranked[m][row]].path;
+      return true;
+    }
+  }
+  if (list == "cgroups.Tree" && row < snap->cgroups.nodes.size())
+  {
+    *id = "/" + snap->cgroups.nodes[row].path;
+    return true;
+  }
+  if (list == "sched.CPU" && row < snap->sched.cpus.size())
+  {
+    *id = std::to_string(snap->sched.cpus[row]);
+    return true;
+  }
+  if (list == "sched.PID" && row < snap->sched.pids.size())
+  {
+    *id = std::to_string(snap->sched.pids[row]);
+    return true;
+  }
+  if (list == "irq.CPU" && row < irq->irqs.cpus.size())
+  {
+    *id = std::to_string(irq->irqs.cpus[row]);
+    return true;
+  }
+  if (list == "irq.Softirq" && row < irq->soft.labels.size())
+  {
+    *id = irq->soft.labels[row];
+    return true;
+  }
+  if (list == "irq.TopIRQ" && row < irq->ranked.size())
+  {
+    *id = irq->irqs.labels[irq->ranked[row]];
+    return true;
+  }
+  for (std::size_t r = 0, i = 0; list == "irq.IRQ" && r < irq->irqs.labels.size(); ++r)
+  {
+    if (irq->Device(r) && i++ == row)
+    {
+      *id = irq->irqs.labels[r];
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+* @brief Appends every numeric value of a snapshot to a history file
+*
+* @param ctx  The context holding the output settings
+* @param snap The snapshot to record, which is left holding no keys
+* @param hist The history to append to
+* @param ts   The time of the snapshot, in milliseconds since the epoch
+*/
+void recordRequests(Context *ctx, Snapshot *snap, History *hist, const std::int64_t &ts)
+{
+  bool pretty = ctx->pretty;
+  std::string list;
+  std::string name;
+  std::string id;
+  const char *open;
+  const char *close;
+  char *end;
+  double val;
+
+  ctx->pretty = false;
+  gatherRequests(ctx, snap);
+  ctx->pretty = pretty;
+  for (std::size_t i = 0; i < snap->keys.size(); ++i)
+  {
+    val = std::strtod(snap->vals[i], &end);
+    if (end == snap->vals[i] || *end != '\0' || !std::isfinite(val))
+    {
+      continue;
+    }
+    // Rows are recorded by what they are rather than where they rank, so that one series never mixes two mounts or processes
+    open = std::strchr(snap->keys[i], '[');
+    close = open == nullptr ? nullptr : std::strchr(open, ']');
+    if (close != nullptr && std::isdigit(static_cast<unsigned char>(open[1])))
+    {
+      list.assign(snap->keys[i], open - snap->keys[i]);
+      if (rowIdentity(snap, list, std::strtoul(open + 1, nullptr, 10), &id))
+      {
+        name.assign(list).append(1, '[').append(id).append(close);
+        hist->Append(name.c_str(), ts, val);
+        continue;
+      }
+    }
+    hist->Append(snap->keys[i], ts, val);
+  }
+  snap->keys.clear();
+  snap->vals.clear();
+}
+
+/**
+* @brief Summarizes each requested key of a history file over the last --since
+*
+* @param ctx  The context holding the history file, window and requests
+* @param snap The snapshot to add the summaries to
+*/
+void historyRequests(Context *ctx, Snapshot *snap)
+{
+  History hist(ctx->history, false);
+  HistoryStats stats;
+  std::stringstream buffer;
+  std::int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+  if (!hist.Good())
+  {
+    throw std::runtime_error("cannot open history file " + ctx->history);
+  }
+
+  for (std::size_t i = 0; i < ctx->requests.size(); ++i)
+  {
+    if (!hist.Query(ctx->requests[i], now - ctx->since, now, &stats))
+    {
+      continue;
+    }
+    snap->Add(stats.name + ".Resolution", historyNames[stats.level]);
+    snap->Add(stats.name + ".Count", std::to_string(stats.count));
+    const double vals[] = {stats.min, stats.max, stats.avg, stats.p50, stats.p90, stats.p99, stats.firstVal, stats.lastVal, stats.lastVal - stats.firstVal};
+    const char *names[] = {".Min", ".Max", ".Avg", ".P50", ".P90", ".P99", ".First", ".Last", ".Change"};
+    for (std::size_t v = 0; v < sizeof(vals) / sizeof(vals[0]); ++v)
+    {
+      buffer << std::fixed << std::setprecision(2) << vals[v];
+      snap->Add(stats.name + names[v], buffer.str());
+      buffer.str("");
+    }
+    snap->Add(stats.name + ".Span", std::to_string((stats.last - stats.first) / 1000) + (ctx->pretty ? " s" : ""));
+  }
+}
+
+/**
+* @brief Checks whether a category is measured over time, rather than collected once
+*
+* @param  cat   The category to check
+* @return true  The category is sampled
+* @return false The category is collected once
+*/
+bool sampledCategory(const std::string &cat)
+{
+  return cat == "CPU.USAGE" || cat == "CPU.POWER" || cat == "MEM" || cat == "SENSORS" || cat == "STORAGE.IO" || cat == "NET" || cat == "PROC" || cat == "CGROUPS" || cat == "PRESSURE" || cat == "SCHED" || cat == "IRQ";
+}
+
+/**
+* @brief Repeats the requests every interval, outputting a line per sample
+*
+* Each category is collected once, which resolves and opens its sources, then a
+* timer wheel re-samples each category at its own period (--every, or the
+* interval), and re-collects any other category given a period. With
+* --changes-only, each line after the first holds only the fields which changed.
+* With --trigger, a line is output whenever the kernel signals a pressure stall
+* instead of every interval, and the sampled categories are sampled for it.
+*
+* @param ctx    The context holding the requests, periods, interval and count
+* @param snap   The snapshot to sample into
+* @param stream The output stream
+*/
+void watchRequests(Context *ctx, Snapshot *snap, std::ostream &stream)
+{
+  std::vector<std::string> cats;
+  std::vector<std::string> timed;
+  std::vector<std::size_t> due;
+  std::map<std::string, std::uint32_t>::iterator period;
+  std::chrono::steady_clock::time_point start;
+  std::chrono::steady_clock::time_point now;
+  std::uint64_t elapsed;
+  std::uint64_t outputs = 0;
+  std::unordered_map<std::string, SeenField> last;
+  std::vector<const char *> keys;
+  std::vector<const char *> vals;
+  std::vector<std::string> removed;
+  History hist;
+  TimerWheel wheel;
+  SourceCache cache;
+  PressureStats alarms;
+  std::size_t dot;
+  std::size_t tick = std::numeric_limits<std::size_t>::max();
+  std::size_t sync = tick;
+  bool fired = false;
+  bool ticking;
+  Sysroot root = ctx->root.empty() ? Sysroot() : Sysroot(ctx->root);
+  if (!ctx->root.empty() && !root.Good())
+  {
+    throw std::runtime_error("cannot open root directory " + ctx->root);
+  }
+
+  if (!ctx->history.empty())
+  {
+    hist = History(ctx->history, true);
+    if (!hist.Good())
+    {
+      throw std::runtime_error("cannot open history file " + ctx->history);
+    }
+  }
+
+  SysrootScope rootScope(ctx->root.empty() ? nullptr : &root);
+  gatherCategories(ctx, &cats);
+  for (period = ctx->periods.begin(); period != ctx->periods.end(); ++period)
+  {
+    if (!contains(&cats, period->first))
+    {
+      throw std::runtime_error("cannot set the period of " + period->first + ", it is not being watched");
+    }
+  }
+  if (!ctx->triggers.empty() && !ctx->root.empty())
+  {
+    throw std::runtime_error("cannot arm pressure triggers under a root directory");
+  }
+  for (auto trigger = ctx->triggers.begin(); trigger != ctx->triggers.end(); ++trigger)
+  {
+    dot = trigger->first.find('.');
+    std::size_t kind = std::find_if(pressureSources, pressureSources + pressureKinds, [&trigger, &dot](const char *src) { return trigger->first.compare(0, dot, src) == 0; }) - pressureSources;
+    if (!alarms.Arm(kind, trigger->first.substr(dot + 1) == "full", trigger->second.first, trigger->second.second))
+    {
+      int err = errno;
+      // Without CAP_SYS_RESOURCE, the kernel only takes windows which are a multiple of 2s
+      throw std::runtime_error("cannot arm pressure trigger " + trigger->first + ", " + std::strerror(err) +
+                               (err == EINVAL && trigger->second.second % 2000 != 0 ? " (unprivileged triggers need a window which is a multiple of 2s)" : ""));
+    }
+  }
+  collectRequests(ctx, snap, &cats);
+  sampleRequests(ctx, snap, &cats);
+
+  // Triggered lines sample every sampled category themselves, so only the explicit periods keep a timer
+  for (std::size_t i = 0; i < cats.size(); ++i)
+  {
+    period = ctx->periods.find(cats[i]);
+    if (period != ctx->periods.end())
+    {
+      wheel.Add(period->second, period->second / 20);
+      timed.push_back(cats[i]);
+    }
+    else if (sampledCategory(cats[i]) && !alarms.Armed())
+    {
+      wheel.Add(ctx->interval);
+      timed.push_back(cats[i]);
+    }
+  }
+  if (!alarms.Armed())
+  {
+    tick = wheel.Add(ctx->interval);
+  }
+  // The held points are written on their own timer, so that a killed watch loses at most a minute of them
+  if (hist.Good())
+  {
+    sync = wheel.Add(static_cast<std::uint32_t>(flushAge[0]));
+  }
+  ticking = !timed.empty() || !alarms.Armed() || hist.Good();
+  start = std::chrono::steady_clock::now();
+  stopWatch = 0;
+  std::signal(SIGINT, onWatchSignal);
+  std::signal(SIGTERM, onWatchSignal);
+
+  while ((ctx->count == 0 || outputs < ctx->count) && !stopWatch)
+  {
+    if (alarms.Armed())
+    {
+      elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+      fired = alarms.Wait(!ticking ? -1 : static_cast<int>(wheel.Next() > elapsed ? wheel.Next() - elapsed : 0));
+    }
+    else
+    {
+      std::this_thread::sleep_until(start + std::chrono::milliseconds(wheel.Next()));
+    }
+    now = std::chrono::steady_clock::now();
+    elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count();
+    due.clear();
+    // Categories due on the same tick share their reads, like /proc/stat for cpu.usage and os, or mountinfo for fs and the cgroups
+    SourceCacheScope cacheScope(&cache);
+    if (ticking)
+    {
+      wheel.Advance(fired ? elapsed : std::max(elapsed, wheel.Next()), &due);
+    }
+    if (fired)
+    {
+      for (std::size_t i = 0; i < cats.size(); ++i)
+      {
+        if (sampledCategory(cats[i]) && !contains(&timed, cats[i]))
+        {
+          sampleCategory(ctx, snap, cats[i]);
+        }
+      }
+      due.push_back(tick);
+    }
+    std::sort(due.begin(), due.end());
+    due.erase(std::unique(due.begin(), due.end()), due.end());
+
+    for (std::size_t i = 0; i < due.size(); ++i)
+    {
+      if (hist.Good() && due[i] == sync)
+      {
+        TimingScope scope(ctx->timings != TimingStyle::None ? &snap->timings : nullptr, "history");
+        hist.Sync();
+        continue;
+      }
+      if (due[i] < timed.size())
+      {
+        if (sampledCategory(timed[due[i]]))
+        {
+          sampleCategory(ctx, snap, timed[due[i]]);
+        }
+        else
+        {
+          collectCategory(ctx, snap, timed[due[i]]);
+        }
+        continue;
+      }
+
+      if (outputs > 0)
+      {
+        snap->Clear();
+      }
+      now = std::chrono::steady_clock::now();
+      if (hist.Good())
+      {
+        TimingScope scope(ctx->timings != TimingStyle::None ? &snap->timings : nullptr, "history");
+        recordRequests(ctx, snap, &hist, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+      }
+      {
+        TimingScope scope(ctx->timings != TimingStyle::None ? &snap->timings : nullptr, "format");
+        gatherRequests(ctx, snap);
+        if (hist.Good())
+        {
+          snap->Add("history.Dropped", std::to_string(hist.Dropped()));
+        }
+      }
+      // The sensors' minimum, maximum and average cover the time since the last output, rather than since watch started
+      snap->sensors.Reset();
+      ++outputs;
+      if (!ctx->changesOnly)
+      {
+        outputTick(ctx, &snap->keys, &snap->vals, &removed, std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count(), stream);
+        continue;
+      }
+      diffRequests(snap, &last, outputs, &keys, &vals, &removed);
+      if (!keys.empty() || !removed.empty())
+      {
+        outputTick(ctx, &keys, &vals, &removed, std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count(), stream);
+      }
+    }
+  }
+  std::signal(SIGINT, SIG_DFL);
+  std::signal(SIGTERM, SIG_DFL);
+}
+
+/**
+* @brief Outputs all of the requests in a snapshot
 *
+* @param ctx    The context holding the output settings
+* @param snap   The snapshot to output
 * @param stream The output stream
 */
-void outputRequests(std::ostream &stream)
+void outputRequests(Context *ctx, Snapshot *snap, std::ostream &stream)
 {
-  std::vector<std::string> *keys = new std::vector<std::string>;
-  std::vector<std::string> *vals = new std::vector<std::string>;
-  std::vector<std::string> *cats = new std::vector<std::string>;
-  gatherCategories(cats);
-  gatherRequests(keys, vals, cats);
+  TimingScope scope(ctx->timings != TimingStyle::None ? &snap->timings : nullptr, "output");
 
-  switch (style)
+  switch (ctx->style)
   {
   case OutputStyle::Default:
-    return outputSimple(stream, keys, vals);
+    return outputSimple(stream, &snap->keys, &snap->vals);
   case OutputStyle::List:
-    return outputSimple(stream, keys, vals, '=');
+    return outputSimple(stream, &snap->keys, &snap->vals, '=');
   case OutputStyle::Value:
-    return outputValue(stream, vals);
+    return outputValue(stream, &snap->vals);
+  case OutputStyle::Json:
+    return outputJson(stream, &snap->keys, &snap->vals);
   }
 }
@@ -25,26 +25,40 @@
 #include "graphics.h"
 #include "graphicslist.h"
 #include "system.h"
+#include "context.h"
+#include "snapshot.h"
+#include "history.h"
 
-extern std::vector<std::string> requests;
-extern OutputStyle style;
-extern bool pretty;
-
-extern OperatingSystem compOS;
-extern System compSys;
-extern Processor compCPU;
-extern Chassis compChassis;
-extern GraphicsList compGPU;
-extern RAMList compRAM;
-extern StorageList compStorage;
-extern FileSystemList compFS;
+/**
+* @brief Represents the last value output for a single key of a watch
+*/
+class SeenField
+{
+public:
+  std::string val;
+  std::uint64_t tick;
+};
 
-void filterRequests();
-void parseRequests(std::string *request);
-void gatherCategories(std::vector<std::string> *cats);
-void gatherRequests(std::vector<std::string> *keys, std::vector<std::string> *vals, std::vector<std::string> *cats);
-void outputSimple(std::ostream &stream, std::vector<std::string> *keys, std::vector<std::string> *vals, const char &del = '\n');
-void outputValue(std::ostream &stream, std::vector<std::string> *vals);
-void outputRequests(std::ostream &stream = std::cout);
+void filterRequests(Context *ctx);
+void parseRequests(Context *ctx, std::string *request);
+void gatherCategories(Context *ctx, std::vector<std::string> *cats);
+void collectCategory(Context *ctx, Snapshot *snap, const std::string &cat);
+void collectRequests(Context *ctx, Snapshot *snap, std::vector<std::string> *cats);
+bool sampleCategory(Context *ctx, Snapshot *snap, const std::string &cat);
+bool sampleRequests(Context *ctx, Snapshot *snap, std::vector<std::string> *cats);
+bool sampledCategory(const std::string &cat);
+void gatherRequests(Context *ctx, Snapshot *snap);
+void queryRequests(Context *ctx, Snapshot *snap);
+void outputSimple(std::ostream &stream, std::vector<const char *> *keys, std::vector<const char *> *vals, const char &del = '\n');
+void outputValue(std::ostream &stream, std::vector<const char *> *vals);
+void outputJson(std::ostream &stream, std::vector<const char *> *keys, std::vector<const char *> *vals);
+void outputTick(Context *ctx, std::vector<const char *> *keys, std::vector<const char *> *vals, std::vector<std::string> *removed, const std::uint64_t &ts, std::ostream &stream = std::cout);
+void diffRequests(Snapshot *snap, std::unordered_map<std::string, SeenField> *last, const std::uint64_t &tick,
+                  std::vector<const char *> *keys, std::vector<const char *> *vals, std::vector<std::string> *removed);
+bool rowIdentity(Snapshot *snap, const std::string &list, const std::size_t &row, std::string *id);
+void recordRequests(Context *ctx, Snapshot *snap, History *hist, const std::int64_t &ts);
+void historyRequests(Context *ctx, Snapshot *snap);
+void watchRequests(Context *ctx, Snapshot *snap, std::ostream &stream = std::cout);
+void outputRequests(Context *ctx, Snapshot *snap, std::ostream &stream = std::cout);
 
 #endif // CGOGGLES_REQUESTS_H_
@@ -0,0 +1,316 @@
+/**
+*  @file      schedulerstats.cpp
+*  @brief     The implementation for the SchedulerStats class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "schedulerstats.h"
+#include "os.h"
+#include "utils.h"
+
+/**
+* @brief The number of counters on each CPU line of /proc/schedstat
+*/
+const std::size_t schedCpuFields = 9;
+
+/**
+* @brief The position of the time running on each CPU line of /proc/schedstat, followed by the time waiting and the timeslices
+*/
+const std::size_t schedCpuRun = 6;
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new, unsampled SchedulerStats object
+*/
+SchedulerStats::SchedulerStats()
+{
+  pidFiles = std::vector<SourceFile>();
+  prev = std::vector<std::array<std::uint64_t, schedFields>>();
+  cur = std::vector<std::array<std::uint64_t, schedFields>>();
+  prevTime = curTime = 0;
+  samples = 0;
+  enabled = false;
+  status = "";
+  version = 0;
+  cpus = std::vector<std::uint32_t>();
+  pids = std::vector<std::uint32_t>();
+  names = std::vector<std::string>();
+}
+
+/**
+* @brief Construct a new SchedulerStats object with help from the assistants
+*
+* @param plt The platform of the system
+* @param ids The process IDs to follow
+*/
+SchedulerStats::SchedulerStats(std::uint8_t plt, const std::vector<std::uint32_t> &ids) : SchedulerStats()
+{
+  switch (plt)
+  {
+  case OS_WIN:
+    GetWin();
+    break;
+  case OS_MAC:
+    GetMac();
+    break;
+  case OS_LUX:
+    GetLux(ids);
+    break;
+  }
+}
+
+/**
+* @brief Construct a new SchedulerStats object from another SchedulerStats object
+*
+* @param o The SchedulerStats object to move from
+*/
+SchedulerStats::SchedulerStats(SchedulerStats &&o)
+{
+  schedstat = std::move(o.schedstat);
+  pidFiles = std::move(o.pidFiles);
+  prev = std::move(o.prev);
+  cur = std::move(o.cur);
+  prevTime = o.prevTime;
+  curTime = o.curTime;
+  samples = o.samples;
+  enabled = o.enabled;
+  status = std::move(o.status);
+  version = o.version;
+  cpus = std::move(o.cpus);
+  pids = std::move(o.pids);
+  names = std::move(o.names);
+}
+#pragma endregion "Constructors"
+
+#pragma region "Constructors' Assistants"
+/**
+* @brief Fills in the scheduler sources for Darwin systems, which has none
+*/
+void SchedulerStats::GetMac()
+{
+  status = "Unavailable";
+}
+
+/**
+* @brief Fills in the scheduler sources for Windows systems, which has none
+*/
+void SchedulerStats::GetWin()
+{
+  status = "Unavailable";
+}
+
+/**
+* @brief Fills in the scheduler sources for Linux systems, and the names of the processes followed
+*
+* @param ids The process IDs to follow
+*/
+void SchedulerStats::GetLux(const std::vector<std::uint32_t> &ids)
+{
+  std::string comm;
+
+  schedstat = SourceFile("/proc/schedstat");
+  enabled = schedstat.Good();
+  status = enabled ? "Enabled" : "Unavailable, the kernel was built without CONFIG_SCHEDSTATS";
+
+  // Processes which have already exited, or kernels without CONFIG_SCHED_INFO, are left out
+  for (std::size_t i = 0; i < ids.size(); ++i)
+  {
+    SourceFile file("/proc/" + std::to_string(ids[i]) + "/schedstat");
+    if (!file.Good())
+    {
+      continue;
+    }
+    pids.push_back(ids[i]);
+    names.push_back(readFile("/proc/" + std::to_string(ids[i]) + "/comm", &comm) ? trim(comm) : "");
+    pidFiles.push_back(std::move(file));
+  }
+}
+
+/**
+* @brief Takes a sample of /proc/schedstat, and of each process followed, in a single pass each
+*/
+void SchedulerStats::SampleLux()
+{
+  std::array<std::uint64_t, schedCpuFields> fields;
+  std::size_t count = 0;
+  std::uint32_t id;
+  bool changed = false;
+
+  std::swap(prev, cur);
+  prevTime = curTime;
+  curTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  cur.resize(1);
+  cur[0].fill(0);
+
+  if (schedstat.Read())
+  {
+    Scanner scan(schedstat.Data(), schedstat.Size());
+    for (; !scan.Done(); scan.SkipLine())
+    {
+      if (scan.Match("version"))
+      {
+        version = scan.Number();
+        continue;
+      }
+      // The domain lines which follow each CPU start with a d, so only the CPU lines match
+      if (!scan.Match("cpu"))
+      {
+        continue;
+      }
+      id = scan.Number();
+      for (std::size_t i = 0; i < schedCpuFields; ++i)
+      {
+        fields[i] = scan.Number();
+      }
+      changed = changed || count >= cpus.size() || cpus[count] != id;
+      if (count >= cpus.size())
+      {
+        cpus.push_back(id);
+      }
+      cpus[count++] = id;
+      cur.push_back({fields[schedCpuRun], fields[schedCpuRun + 1], fields[schedCpuRun + 2]});
+      for (std::size_t f = 0; f < schedFields; ++f)
+      {
+        cur[0][f] += cur.back()[f];
+      }
+    }
+  }
+  changed = changed || count != cpus.size();
+  cpus.resize(count);
+
+  // Each process's file is its time running, its time waiting and its timeslices
+  for (std::size_t i = 0; i < pidFiles.size(); ++i)
+  {
+    cur.push_back({0, 0, 0});
+    if (pidFiles[i].Read())
+    {
+      Scanner scan(pidFiles[i].Data(), pidFiles[i].Size());
+      for (std::size_t f = 0; f < schedFields; ++f)
+      {
+        cur.back()[f] = scan.Number();
+      }
+    }
+  }
+
+  // A CPU came or went, so the samples can't be compared
+  if (changed || cur.size() != prev.size())
+  {
+    samples = 0;
+  }
+  ++samples;
+}
+#pragma endregion "Constructors' Assistants"
+
+#pragma region "Operators"
+/**
+* @brief Moves another SchedulerStats object into this one
+*
+* @param o The SchedulerStats object to move from
+*/
+void SchedulerStats::operator=(SchedulerStats &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  schedstat = std::move(o.schedstat);
+  pidFiles = std::move(o.pidFiles);
+  prev = std::move(o.prev);
+  cur = std::move(o.cur);
+  prevTime = o.prevTime;
+  curTime = o.curTime;
+  samples = o.samples;
+  enabled = o.enabled;
+  status = std::move(o.status);
+  version = o.version;
+  cpus = std::move(o.cpus);
+  pids = std::move(o.pids);
+  names = std::move(o.names);
+}
+#pragma endregion "Operators"
+
+#pragma region "Methods"
+/**
+* @brief Takes a sample of the run queues and the processes followed
+*/
+void SchedulerStats::Sample()
+{
+  if (enabled || !pidFiles.empty())
+  {
+    SampleLux();
+  }
+}
+
+/**
+* @brief Checks whether or not there are two comparable samples
+*
+* @return true  The deltas can be computed
+* @return false The deltas can NOT be computed yet
+*/
+bool SchedulerStats::Ready()
+{
+  return samples >= 2 && curTime > prevTime;
+}
+
+/**
+* @brief Gets the row of a process followed
+*
+* @param  i           The index of the process in pids
+* @return std::size_t The row, after every CPU
+*/
+std::size_t SchedulerStats::PidRow(const std::size_t &i)
+{
+  return 1 + cpus.size() + i;
+}
+
+/**
+* @brief Gets the time spent running or waiting to run as a share of the time between the samples
+*
+* @param  row    The row, 0 for every CPU, then each CPU, then each process followed
+* @param  field  The index of the counter in schedNames, either Run or Wait
+* @return double The time as a percentage, which may pass 100 when several tasks wait on one CPU
+*/
+double SchedulerStats::Share(const std::size_t &row, const std::size_t &field)
+{
+  if (!Ready() || row >= cur.size() || field >= 2 || cur[row][field] < prev[row][field])
+  {
+    return 0;
+  }
+  return 100.0 * (cur[row][field] - prev[row][field]) / (curTime - prevTime);
+}
+
+/**
+* @brief Gets the timeslices run per second
+*
+* @param  row    The row, 0 for every CPU, then each CPU, then each process followed
+* @return double The timeslices per second
+*/
+double SchedulerStats::Timeslices(const std::size_t &row)
+{
+  if (!Ready() || row >= cur.size() || cur[row][2] < prev[row][2])
+  {
+    return 0;
+  }
+  return (cur[row][2] - prev[row][2]) * 1e9 / (curTime - prevTime);
+}
+
+/**
+* @brief Gets the average run-queue wait before each timeslice
+*
+* @param  row    The row, 0 for every CPU, then each CPU, then each process followed
+* @return double The average wait in microseconds, or 0 if nothing ran
+*/
+double SchedulerStats::WaitPerSlice(const std::size_t &row)
+{
+  if (!Ready() || row >= cur.size() || cur[row][2] <= prev[row][2] || cur[row][1] < prev[row][1])
+  {
+    return 0;
+  }
+  return (cur[row][1] - prev[row][1]) / 1e3 / (cur[row][2] - prev[row][2]);
+}
+#pragma endregion "Methods"
@@ -0,0 +1,66 @@
+/**
+*  @file      schedulerstats.h
+*  @brief     The interface for the SchedulerStats class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_SCHEDULERSTATS_H_
+#define CGOGGLES_SCHEDULERSTATS_H_
+
+#include "pch.h"
+#include "sourcefile.h"
+
+/**
+* @brief The number of counters kept for each CPU and process
+*/
+const std::size_t schedFields = 3;
+
+/**
+* @brief The names of the counters kept for each CPU and process, the nanoseconds running and waiting to run, and the timeslices run
+*/
+const char *const schedNames[schedFields] = {"Run", "Wait", "Timeslices"};
+
+/**
+* @brief Represents the time tasks spent running and waiting on the run queues between two samples
+*/
+class SchedulerStats
+{
+private:
+  SourceFile schedstat;
+  std::vector<SourceFile> pidFiles;
+  std::vector<std::array<std::uint64_t, schedFields>> prev;
+  std::vector<std::array<std::uint64_t, schedFields>> cur;
+  std::uint64_t prevTime;
+  std::uint64_t curTime;
+  std::size_t samples;
+  void GetMac();
+  void GetWin();
+  void GetLux(const std::vector<std::uint32_t> &ids);
+  void SampleLux();
+
+public:
+  SchedulerStats();
+  SchedulerStats(std::uint8_t plt, const std::vector<std::uint32_t> &ids);
+  SchedulerStats(const SchedulerStats &o) = delete;
+  SchedulerStats(SchedulerStats &&o);
+  void operator=(const SchedulerStats &o) = delete;
+  void operator=(SchedulerStats &&o);
+  void Sample();
+  bool Ready();
+  std::size_t PidRow(const std::size_t &i);
+  double Share(const std::size_t &row, const std::size_t &field);
+  double Timeslices(const std::size_t &row);
+  double WaitPerSlice(const std::size_t &row);
+  bool enabled;
+  std::string status;
+  std::uint32_t version;
+  std::vector<std::uint32_t> cpus;
+  std::vector<std::uint32_t> pids;
+  std::vector<std::string> names;
+};
+
+#endif // CGOGGLES_SCHEDULERSTATS_H_
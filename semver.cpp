@@ -18,7 +18,7 @@
 */
 SemVer::SemVer()
 {
-  ver = new std::uint32_t[5]{0, 0, 0, 0, 0};
+  std::fill(ver, ver + 5, 0);
 }
 
 /**
@@ -28,7 +28,6 @@ SemVer::SemVer()
 */
 SemVer::SemVer(const SemVer &o)
 {
-  ver = new std::uint32_t[5]{0, 0, 0, 0, 0};
   for (std::size_t i = 0; i < 5; ++i)
   {
     ver[i] = o.ver[i];
@@ -43,7 +42,7 @@ SemVer::SemVer(const SemVer &o)
 */
 SemVer::SemVer(const std::string &rawVer, const std::uint8_t &fmt)
 {
-  ver = new std::uint32_t[5]{0, 0, 0, 0, 0};
+  std::fill(ver, ver + 5, 0);
   std::vector<std::string> spl;
   std::uint8_t i = 0xFF;
   splitStringVector(rawVer, ".", &spl);
@@ -79,7 +78,7 @@ SemVer::SemVer(const std::string &rawVer, const std::uint8_t &fmt)
 */
 SemVer::SemVer(const std::string &rawVer, const std::uint8_t &fmt, const std::string &bld)
 {
-  ver = new std::uint32_t[5]{0, 0, 0, 0, 0};
+  std::fill(ver, ver + 5, 0);
   std::vector<std::string> spl;
   std::uint8_t i = 0xFF;
   splitStringVector(rawVer, ".", &spl);
@@ -98,29 +97,9 @@ SemVer::SemVer(const std::string &rawVer, const std::uint8_t &fmt, const std::st
   }
   ver[3] = std::stoi(bld);
 }
-
-/**
-* @brief Destroy the SemVer object
-*/
-SemVer::~SemVer()
-{
-  delete ver;
-}
 #pragma endregion "Contructors"
 
 #pragma region "Operators"
-/**
-* @brief Reserves memory for a new SemVer object
-*
-* @param  size  The amount of memory to allocate
-* @return void* A pointer to the allocated memory
-*/
-void *SemVer::operator new(std::size_t size)
-{
-  void *o = ::new (SemVer);
-  return o;
-}
-
 /**
 * @brief Sets equal two SemVer objects
 *
@@ -132,8 +111,6 @@ void SemVer::operator=(const SemVer &o)
   {
     return;
   }
-  ver = new std::uint32_t[5]{0, 0, 0, 0, 0};
-
   ver[0] = o.ver[0];
   ver[1] = o.ver[1];
   ver[2] = o.ver[2];
@@ -141,26 +118,6 @@ void SemVer::operator=(const SemVer &o)
   ver[4] = o.ver[4];
 }
 
-/**
-* @brief Sets equal two SemVer objects
-*
-* @param o The SemVer object to copy from
-*/
-void SemVer::operator=(SemVer *o)
-{
-  if ((*o) == (*this))
-  {
-    return;
-  }
-  ver = new std::uint32_t[5]{0, 0, 0, 0, 0};
-
-  ver[0] = o->ver[0];
-  ver[1] = o->ver[1];
-  ver[2] = o->ver[2];
-  ver[3] = o->ver[3];
-  ver[4] = o->ver[4];
-}
-
 /**
 * @brief Compares the equality two SemVer objects
 *
@@ -22,17 +22,14 @@ private:
   /**
   * @brief The underlying value of the SemVer class
   */
-  std::uint32_t *ver;
+  std::uint32_t ver[5];
 
 public:
   SemVer();
   SemVer(const SemVer &o);
   SemVer(const std::string &ver, const std::uint8_t &fmt);
   SemVer(const std::string &ver, const std::uint8_t &fmt, const std::string &bld);
-  ~SemVer();
-  void *operator new(std::size_t size);
   void operator=(const SemVer &o);
-  void operator=(SemVer *o);
   bool operator==(SemVer &o);
   bool operator!=(SemVer &o);
   bool operator<(SemVer &o);
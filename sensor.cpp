@@ -0,0 +1,140 @@
+/**
+*  @file      sensor.cpp
+*  @brief     The implementation for the Sensor class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "sensor.h"
+#include "temperature.h"
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new, unopened Sensor object
+*/
+Sensor::Sensor()
+{
+  scale = 1;
+  chip = "";
+  label = "";
+  type = "";
+  current = 0.0;
+  minimum = 0.0;
+  maximum = 0.0;
+  total = 0.0;
+  count = 0;
+}
+
+/**
+* @brief Construct a new Sensor object, holding its input open
+*
+* @param chp  The chip or zone which the sensor belongs to
+* @param lbl  The label of the sensor
+* @param tp   The type of sensor, Temperature, Fan or Voltage
+* @param path The path of the sensor's input
+* @param scl  The multiplier from the input's units to degrees, RPM or volts
+*/
+Sensor::Sensor(std::string chp, std::string lbl, std::string tp, const std::string &path, const float &scl) : Sensor()
+{
+  input = SourceFile(path);
+  scale = scl;
+  chip = std::move(chp);
+  label = std::move(lbl);
+  type = std::move(tp);
+}
+
+/**
+* @brief Construct a new Sensor object from another Sensor object
+*
+* @param o The Sensor object to move from
+*/
+Sensor::Sensor(Sensor &&o)
+{
+  input = std::move(o.input);
+  scale = o.scale;
+  chip = std::move(o.chip);
+  label = std::move(o.label);
+  type = std::move(o.type);
+  current = o.current;
+  minimum = o.minimum;
+  maximum = o.maximum;
+  total = o.total;
+  count = o.count;
+}
+#pragma endregion "Constructors"
+
+#pragma region "Operators"
+/**
+* @brief Moves another Sensor object into this one
+*
+* @param o The Sensor object to move from
+*/
+void Sensor::operator=(Sensor &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  input = std::move(o.input);
+  scale = o.scale;
+  chip = std::move(o.chip);
+  label = std::move(o.label);
+  type = std::move(o.type);
+  current = o.current;
+  minimum = o.minimum;
+  maximum = o.maximum;
+  total = o.total;
+  count = o.count;
+}
+#pragma endregion "Operators"
+
+#pragma region "Methods"
+/**
+* @brief Re-reads the sensor's input, and folds it into the window's minimum, maximum and total
+*
+* @return true  The sensor was read
+* @return false The sensor could NOT be read, e.g. a fan which is powered down
+*/
+bool Sensor::Sample()
+{
+  if (!input.Read() || input.Size() == 0)
+  {
+    return false;
+  }
+
+  Scanner scan(input.Data(), input.Size());
+  current = scan.Signed() * scale;
+  if (type == "Temperature")
+  {
+    current = Temperature(current).kelvin;
+  }
+  minimum = count == 0 || current < minimum ? current : minimum;
+  maximum = count == 0 || current > maximum ? current : maximum;
+  total += current;
+  ++count;
+  return true;
+}
+
+/**
+* @brief Starts a new window from the last reading, so that the next window shares its boundary with this one
+*/
+void Sensor::Reset()
+{
+  minimum = maximum = total = current;
+  count = count ? 1 : 0;
+}
+
+/**
+* @brief Gets the average of the readings over the window
+*
+* @return float The average reading, in kelvin, RPM or volts
+*/
+float Sensor::Average()
+{
+  return count ? total / count : 0;
+}
+#pragma endregion "Methods"
@@ -0,0 +1,46 @@
+/**
+*  @file      sensor.h
+*  @brief     The interface for the Sensor class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_SENSOR_H_
+#define CGOGGLES_SENSOR_H_
+
+#include "pch.h"
+#include "sourcefile.h"
+
+/**
+* @brief Represents a single hardware sensor, and its readings over a sampling window
+*/
+class Sensor
+{
+private:
+  SourceFile input;
+  float scale;
+
+public:
+  Sensor();
+  Sensor(std::string chp, std::string lbl, std::string tp, const std::string &path, const float &scl);
+  Sensor(const Sensor &o) = delete;
+  Sensor(Sensor &&o);
+  void operator=(const Sensor &o) = delete;
+  void operator=(Sensor &&o);
+  bool Sample();
+  void Reset();
+  float Average();
+  std::string chip;
+  std::string label;
+  std::string type;
+  float current;
+  float minimum;
+  float maximum;
+  float total;
+  std::size_t count;
+};
+
+#endif // CGOGGLES_SENSOR_H_
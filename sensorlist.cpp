@@ -0,0 +1,207 @@
+/**
+*  @file      sensorlist.cpp
+*  @brief     The implementation for the SensorList class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "sensorlist.h"
+#include "os.h"
+#include "sysroot.h"
+#include "utils.h"
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new SensorList object
+*/
+SensorList::SensorList()
+{
+  samples = 0;
+  sensors = std::vector<Sensor>();
+}
+
+/**
+* @brief Construct a new SensorList object with help from the assistants
+*
+* @param plt The platform of the system
+*/
+SensorList::SensorList(std::uint8_t plt) : SensorList()
+{
+  switch (plt)
+  {
+  case OS_WIN:
+    GetWin();
+    break;
+  case OS_MAC:
+    GetMac();
+    break;
+  case OS_LUX:
+    GetLux();
+    break;
+  }
+}
+
+/**
+* @brief Construct a new SensorList object from another SensorList object
+*
+* @param o The SensorList object to move from
+*/
+SensorList::SensorList(SensorList &&o)
+{
+  samples = o.samples;
+  sensors = std::move(o.sensors);
+}
+#pragma endregion "Constructors"
+
+#pragma region "Constructors' Assistants"
+/**
+* @brief Fills in the sensors for Darwin systems
+*/
+void SensorList::GetMac() {}
+
+/**
+* @brief Fills in the sensors for Windows systems
+*/
+void SensorList::GetWin() {}
+
+/**
+* @brief Fills in the sensors for Linux systems, opening each input once
+*/
+void SensorList::GetLux()
+{
+  std::vector<std::string> dirs;
+
+  listDirectory("/sys/class/hwmon", &dirs);
+  for (std::size_t i = 0; i < dirs.size(); ++i)
+  {
+    AddHwmon("/sys/class/hwmon/" + dirs[i]);
+  }
+
+  listDirectory("/sys/class/thermal", &dirs);
+  for (std::size_t i = 0; i < dirs.size(); ++i)
+  {
+    if (startswith(dirs[i], "thermal_zone"))
+    {
+      AddThermal("/sys/class/thermal/" + dirs[i]);
+    }
+  }
+}
+
+/**
+* @brief Adds the temperature, fan and voltage inputs of a hwmon chip
+*
+* @param dir The chip's directory
+*/
+void SensorList::AddHwmon(const std::string &dir)
+{
+  std::vector<std::string> attrs;
+  std::string chip;
+  std::string label;
+  std::string base;
+  std::string type;
+  float scale;
+
+  chip = readFile(dir + "/name", &chip) ? trim(chip) : dir.substr(dir.rfind('/') + 1);
+  listDirectory(dir, &attrs);
+  for (std::size_t i = 0; i < attrs.size(); ++i)
+  {
+    if (!endswith(attrs[i], "_input"))
+    {
+      continue;
+    }
+    base = attrs[i].substr(0, attrs[i].size() - 6);
+    // Temperatures are in millidegrees Celsius, fans in RPM and voltages in millivolts
+    if (startswith(base, "temp"))
+    {
+      type = "Temperature";
+      scale = 0.001;
+    }
+    else if (startswith(base, "fan"))
+    {
+      type = "Fan";
+      scale = 1;
+    }
+    else if (startswith(base, "in"))
+    {
+      type = "Voltage";
+      scale = 0.001;
+    }
+    else
+    {
+      continue;
+    }
+    label = readFile(dir + "/" + base + "_label", &label) ? trim(label) : base;
+    sensors.push_back(Sensor(chip, label, type, dir + "/" + attrs[i], scale));
+  }
+}
+
+/**
+* @brief Adds the temperature of a thermal zone
+*
+* @param dir The zone's directory
+*/
+void SensorList::AddThermal(const std::string &dir)
+{
+  std::string label;
+
+  label = readFile(dir + "/type", &label) ? trim(label) : "";
+  sensors.push_back(Sensor(dir.substr(dir.rfind('/') + 1), label, "Temperature", dir + "/temp", 0.001));
+}
+#pragma endregion "Constructors' Assistants"
+
+#pragma region "Operators"
+/**
+* @brief Moves another SensorList object into this one
+*
+* @param o The SensorList object to move from
+*/
+void SensorList::operator=(SensorList &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  samples = o.samples;
+  sensors = std::move(o.sensors);
+}
+#pragma endregion "Operators"
+
+#pragma region "Methods"
+/**
+* @brief Re-reads every sensor through its open input
+*/
+void SensorList::Sample()
+{
+  for (std::size_t i = 0; i < sensors.size(); ++i)
+  {
+    sensors[i].Sample();
+  }
+  ++samples;
+}
+
+/**
+* @brief Starts a new window for every sensor from its last reading
+*/
+void SensorList::Reset()
+{
+  for (std::size_t i = 0; i < sensors.size(); ++i)
+  {
+    sensors[i].Reset();
+  }
+}
+
+/**
+* @brief Checks whether or not the sensors have been sampled over a window
+*
+* @return true  The minimum, maximum and average span a window
+* @return false Only a single reading has been taken
+*/
+bool SensorList::Ready()
+{
+  return samples >= 2 || sensors.empty();
+}
+#pragma endregion "Methods"
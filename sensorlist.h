@@ -0,0 +1,43 @@
+/**
+*  @file      sensorlist.h
+*  @brief     The interface for the SensorList class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_SENSORLIST_H_
+#define CGOGGLES_SENSORLIST_H_
+
+#include "pch.h"
+#include "sensor.h"
+
+/**
+* @brief Represents a computer's collection of Sensor objects
+*/
+class SensorList
+{
+private:
+  void GetMac();
+  void GetWin();
+  void GetLux();
+  void AddHwmon(const std::string &dir);
+  void AddThermal(const std::string &dir);
+  std::size_t samples;
+
+public:
+  SensorList();
+  SensorList(std::uint8_t plt);
+  SensorList(const SensorList &o) = delete;
+  SensorList(SensorList &&o);
+  void operator=(const SensorList &o) = delete;
+  void operator=(SensorList &&o);
+  void Sample();
+  void Reset();
+  bool Ready();
+  std::vector<Sensor> sensors;
+};
+
+#endif // CGOGGLES_SENSORLIST_H_
@@ -0,0 +1,124 @@
+/**
+*  @file      snapshot.cpp
+*  @brief     The implementation for the Snapshot class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "snapshot.h"
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new, empty Snapshot object
+*/
+Snapshot::Snapshot()
+{
+  keys = std::vector<const char *>();
+  vals = std::vector<const char *>();
+  timings = Timings();
+}
+
+/**
+* @brief Construct a new Snapshot object from another Snapshot object
+*
+* @param o The Snapshot object to move from
+*/
+Snapshot::Snapshot(Snapshot &&o)
+{
+  arena = std::move(o.arena);
+  os = std::move(o.os);
+  sys = std::move(o.sys);
+  cpu = std::move(o.cpu);
+  cpuUsage = std::move(o.cpuUsage);
+  cpuPower = std::move(o.cpuPower);
+  chassis = std::move(o.chassis);
+  gpu = std::move(o.gpu);
+  ram = std::move(o.ram);
+  mem = std::move(o.mem);
+  sensors = std::move(o.sensors);
+  storage = std::move(o.storage);
+  disks = std::move(o.disks);
+  fs = std::move(o.fs);
+  net = std::move(o.net);
+  proc = std::move(o.proc);
+  numa = std::move(o.numa);
+  kernel = std::move(o.kernel);
+  cgroup = std::move(o.cgroup);
+  cgroups = std::move(o.cgroups);
+  pressure = std::move(o.pressure);
+  sched = std::move(o.sched);
+  irq = std::move(o.irq);
+  keys = std::move(o.keys);
+  vals = std::move(o.vals);
+  timings = std::move(o.timings);
+}
+#pragma endregion "Constructors"
+
+#pragma region "Operators"
+/**
+* @brief Moves another Snapshot object into this one
+*
+* @param o The Snapshot object to move from
+*/
+void Snapshot::operator=(Snapshot &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+  arena = std::move(o.arena);
+  os = std::move(o.os);
+  sys = std::move(o.sys);
+  cpu = std::move(o.cpu);
+  cpuUsage = std::move(o.cpuUsage);
+  cpuPower = std::move(o.cpuPower);
+  chassis = std::move(o.chassis);
+  gpu = std::move(o.gpu);
+  ram = std::move(o.ram);
+  mem = std::move(o.mem);
+  sensors = std::move(o.sensors);
+  storage = std::move(o.storage);
+  disks = std::move(o.disks);
+  fs = std::move(o.fs);
+  net = std::move(o.net);
+  proc = std::move(o.proc);
+  numa = std::move(o.numa);
+  kernel = std::move(o.kernel);
+  cgroup = std::move(o.cgroup);
+  cgroups = std::move(o.cgroups);
+  pressure = std::move(o.pressure);
+  sched = std::move(o.sched);
+  irq = std::move(o.irq);
+  keys = std::move(o.keys);
+  vals = std::move(o.vals);
+  timings = std::move(o.timings);
+}
+#pragma endregion "Operators"
+
+#pragma region "Methods"
+/**
+* @brief Adds a key/value pair, stored in the snapshot's arena
+*
+* @param key The key to add
+* @param val The value to add
+*/
+void Snapshot::Add(const std::string &key, const std::string &val)
+{
+  keys.push_back(arena.Store(key));
+  vals.push_back(arena.Store(val));
+}
+
+/**
+* @brief Removes all of the key/value pairs and releases their memory, keeping the timings so that they cover a whole watch
+*/
+void Snapshot::Clear()
+{
+  keys.clear();
+  vals.clear();
+  arena.Reset();
+}
+#pragma endregion "Methods"
@@ -0,0 +1,81 @@
+/**
+*  @file      snapshot.h
+*  @brief     The interface for the Snapshot class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_SNAPSHOT_H_
+#define CGOGGLES_SNAPSHOT_H_
+
+#include "pch.h"
+#include "arena.h"
+#include "os.h"
+#include "processor.h"
+#include "processorusage.h"
+#include "processorpower.h"
+#include "chassis.h"
+#include "ramlist.h"
+#include "memorystats.h"
+#include "sensorlist.h"
+#include "storagelist.h"
+#include "diskstats.h"
+#include "fslist.h"
+#include "networklist.h"
+#include "processlist.h"
+#include "numalist.h"
+#include "kernelconfig.h"
+#include "controlgroup.h"
+#include "controlgrouptree.h"
+#include "pressurestats.h"
+#include "schedulerstats.h"
+#include "interruptstats.h"
+#include "graphicslist.h"
+#include "system.h"
+#include "timings.h"
+
+/**
+* @brief Represents the data collected for a single set of requests
+*/
+class Snapshot
+{
+public:
+  Snapshot();
+  Snapshot(const Snapshot &o) = delete;
+  Snapshot(Snapshot &&o);
+  void operator=(const Snapshot &o) = delete;
+  void operator=(Snapshot &&o);
+  void Add(const std::string &key, const std::string &val);
+  void Clear();
+  Arena arena;
+  OperatingSystem os;
+  System sys;
+  Processor cpu;
+  ProcessorUsage cpuUsage;
+  ProcessorPower cpuPower;
+  Chassis chassis;
+  GraphicsList gpu;
+  RAMList ram;
+  MemoryStats mem;
+  SensorList sensors;
+  StorageList storage;
+  DiskStats disks;
+  FileSystemList fs;
+  NetworkList net;
+  ProcessList proc;
+  NumaList numa;
+  KernelConfig kernel;
+  ControlGroup cgroup;
+  ControlGroupTree cgroups;
+  PressureStats pressure;
+  SchedulerStats sched;
+  InterruptStats irq;
+  std::vector<const char *> keys;
+  std::vector<const char *> vals;
+  Timings timings;
+};
+
+#endif // CGOGGLES_SNAPSHOT_H_
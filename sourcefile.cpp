@@ -0,0 +1,444 @@
+/**
+*  @file      sourcefile.cpp
+*  @brief     The implementation for the SourceFile, SourceCache and Scanner classes.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "sourcefile.h"
+#include "os.h"
+#include "sysroot.h"
+#include "timings.h"
+
+#if CGOGGLES_OS != OS_WIN
+#include <unistd.h>
+#endif
+
+/**
+* @brief The SourceCache being read through by the current thread
+*/
+static thread_local SourceCache *currentSourceCache = nullptr;
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new, closed SourceFile object
+*/
+SourceFile::SourceFile()
+{
+  fd = -1;
+  path = "";
+  buffer = std::vector<char>();
+  size = 0;
+}
+
+/**
+* @brief Construct a new SourceFile object, opening the path through the active Sysroot
+*
+* @param p        The absolute path to open
+* @param capacity The starting size of the buffer, which grows if the file is larger
+*/
+SourceFile::SourceFile(const std::string &p, const std::size_t &capacity)
+{
+  SourceTiming timing(p);
+  fd = openPath(p);
+  path = p;
+  buffer = std::vector<char>(std::max<std::size_t>(1, capacity));
+  size = 0;
+}
+
+/**
+* @brief Construct a new SourceFile object from another SourceFile object
+*
+* @param o The SourceFile object to move from
+*/
+SourceFile::SourceFile(SourceFile &&o)
+{
+  fd = o.fd;
+  path = std::move(o.path);
+  buffer = std::move(o.buffer);
+  size = o.size;
+  o.fd = -1;
+  o.size = 0;
+}
+
+/**
+* @brief Destroy the SourceFile object, closing the file
+*/
+SourceFile::~SourceFile()
+{
+#if CGOGGLES_OS != OS_WIN
+  if (fd >= 0)
+  {
+    close(fd);
+  }
+#endif
+}
+
+/**
+* @brief Construct a new, empty SourceCache object
+*/
+SourceCache::SourceCache()
+{
+  files = std::unordered_map<std::string, std::pair<std::uint64_t, std::string>>();
+  tick = 0;
+}
+
+/**
+* @brief Construct a new SourceCacheScope object, making the SourceCache active and starting a new tick
+*
+* @param cache The SourceCache to read through, or nullptr to read every file
+*/
+SourceCacheScope::SourceCacheScope(SourceCache *cache)
+{
+  previous = currentSourceCache;
+  currentSourceCache = cache;
+  if (cache != nullptr)
+  {
+    cache->Advance();
+  }
+}
+
+/**
+* @brief Destroy the SourceCacheScope object, restoring the previous SourceCache
+*/
+SourceCacheScope::~SourceCacheScope()
+{
+  currentSourceCache = previous;
+}
+
+/**
+* @brief Construct a new ScanKey object
+*
+* @param n The key, exactly as it appears in the source
+* @param s The slot that the key's value is stored in
+*/
+ScanKey::ScanKey(const char *n, const std::size_t &s)
+{
+  name = n;
+  len = std::strlen(n);
+  slot = s;
+}
+
+/**
+* @brief Construct a new Scanner object over a buffer
+*
+* @param data The start of the buffer
+* @param size The size of the buffer
+*/
+Scanner::Scanner(const char *data, const std::size_t &size)
+{
+  pos = data;
+  end = data + size;
+}
+#pragma endregion "Constructors"
+
+#pragma region "Operators"
+/**
+* @brief Moves another SourceFile object into this one
+*
+* @param o The SourceFile object to move from
+*/
+void SourceFile::operator=(SourceFile &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+#if CGOGGLES_OS != OS_WIN
+  if (fd >= 0)
+  {
+    close(fd);
+  }
+#endif
+  fd = o.fd;
+  path = std::move(o.path);
+  buffer = std::move(o.buffer);
+  size = o.size;
+  o.fd = -1;
+  o.size = 0;
+}
+#pragma endregion "Operators"
+
+#pragma region "Methods"
+/**
+* @brief Checks whether or not the file is open
+*
+* @return true  The file is open
+* @return false The file could NOT be opened
+*/
+bool SourceFile::Good()
+{
+  return fd >= 0;
+}
+
+/**
+* @brief Re-reads the whole file from the start, growing the buffer only when it is too small
+*
+* @return true  The file was read successfully
+* @return false The file was NOT read successfully
+*/
+bool SourceFile::Read()
+{
+#if CGOGGLES_OS != OS_WIN
+  SourceTiming timing(path, false, false);
+  ssize_t len;
+
+  size = 0;
+  if (fd < 0)
+  {
+    return false;
+  }
+
+  // Another category due on the same tick already read this file
+  SourceCache *cache = activeSourceCache();
+  const std::string *hit = cache != nullptr ? cache->Find(path) : nullptr;
+  if (hit != nullptr)
+  {
+    if (hit->size() >= buffer.size())
+    {
+      buffer.resize(hit->size() + 1);
+    }
+    std::memcpy(buffer.data(), hit->data(), hit->size());
+    size = hit->size();
+    return true;
+  }
+  while ((len = pread(fd, buffer.data() + size, buffer.size() - size, size)) > 0)
+  {
+    size += len;
+    if (size == buffer.size())
+    {
+      buffer.resize(buffer.size() * 2);
+    }
+  }
+  timing.Read(size);
+  if (cache != nullptr && len == 0)
+  {
+    cache->Store(path, buffer.data(), size);
+  }
+  return len == 0;
+#else
+  size = 0;
+  return false;
+#endif
+}
+
+/**
+* @brief Starts a new tick, so that every file is read again once
+*/
+void SourceCache::Advance()
+{
+  ++tick;
+}
+
+/**
+* @brief Finds a file already read during this tick
+*
+* @param  p                  The absolute path of the file
+* @return const std::string* The contents of the file, or nullptr if it has not been read this tick
+*/
+const std::string *SourceCache::Find(const std::string &p)
+{
+  auto found = files.find(p);
+  return found != files.end() && found->second.first == tick ? &found->second.second : nullptr;
+}
+
+/**
+* @brief Keeps the contents of a file read during this tick, reusing the memory of its last tick
+*
+* @param p    The absolute path of the file
+* @param data The contents of the file
+* @param size The size of the contents
+*/
+void SourceCache::Store(const std::string &p, const char *data, const std::size_t &size)
+{
+  std::pair<std::uint64_t, std::string> &file = files[p];
+  file.first = tick;
+  file.second.assign(data, size);
+}
+
+/**
+* @brief Gets the contents of the last read
+*
+* @return const char* The start of the contents
+*/
+const char *SourceFile::Data()
+{
+  return buffer.data();
+}
+
+/**
+* @brief Gets the size of the last read
+*
+* @return std::size_t The size of the contents
+*/
+std::size_t SourceFile::Size()
+{
+  return size;
+}
+
+/**
+* @brief Checks whether or not the whole buffer has been scanned
+*
+* @return true  The end of the buffer has been reached
+* @return false There is more to scan
+*/
+bool Scanner::Done()
+{
+  return pos >= end;
+}
+
+/**
+* @brief Skips over a string if the buffer continues with it
+*
+* @param  s     The string to match
+* @return true  The string matched and was skipped
+* @return false The string did NOT match
+*/
+bool Scanner::Match(const char *s)
+{
+  const char *cur = pos;
+  while (*s)
+  {
+    if (cur >= end || *cur != *s)
+    {
+      return false;
+    }
+    ++cur;
+    ++s;
+  }
+  pos = cur;
+  return true;
+}
+
+/**
+* @brief Skips over any spaces and tabs
+*/
+void Scanner::SkipSpaces()
+{
+  while (pos < end && (*pos == ' ' || *pos == '\t'))
+  {
+    ++pos;
+  }
+}
+
+/**
+* @brief Skips to the start of the next line
+*/
+void Scanner::SkipLine()
+{
+  const char *nl = static_cast<const char *>(std::memchr(pos, '\n', end - pos));
+  pos = nl == nullptr ? end : nl + 1;
+}
+
+/**
+* @brief Reads an unsigned number, skipping any leading spaces
+*
+* @return std::uint64_t The number, or 0 if there was none
+*/
+std::uint64_t Scanner::Number()
+{
+  std::uint64_t ret = 0;
+  SkipSpaces();
+  while (pos < end && *pos >= '0' && *pos <= '9')
+  {
+    ret = ret * 10 + (*pos - '0');
+    ++pos;
+  }
+  return ret;
+}
+
+/**
+* @brief Reads a number which may be negative, skipping any leading spaces
+*
+* @return std::int64_t The number, or 0 if there was none
+*/
+std::int64_t Scanner::Signed()
+{
+  SkipSpaces();
+  if (pos < end && *pos == '-')
+  {
+    ++pos;
+    return -static_cast<std::int64_t>(Number());
+  }
+  return static_cast<std::int64_t>(Number());
+}
+
+/**
+* @brief Reads a word, skipping any leading spaces
+*
+* @param  s           The start of the word, pointing into the buffer
+* @return std::size_t The length of the word
+*/
+std::size_t Scanner::Word(const char **s)
+{
+  SkipSpaces();
+  (*s) = pos;
+  while (pos < end && *pos != ' ' && *pos != '\t' && *pos != '\n')
+  {
+    ++pos;
+  }
+  return pos - (*s);
+}
+
+/**
+* @brief Reads up to a delimiter on the same line, skipping any leading spaces and the delimiter itself
+*
+* @param  c           The delimiter
+* @param  s           The start of the text, pointing into the buffer
+* @return std::size_t The length of the text
+*/
+std::size_t Scanner::Until(const char &c, const char **s)
+{
+  std::size_t len;
+  SkipSpaces();
+  (*s) = pos;
+  while (pos < end && *pos != c && *pos != '\n')
+  {
+    ++pos;
+  }
+  len = pos - (*s);
+  if (pos < end && *pos == c)
+  {
+    ++pos;
+  }
+  return len;
+}
+
+/**
+* @brief Reads a word and finds it in a table of keys
+*
+* @param  keys        The keys to look for
+* @param  count       The number of keys
+* @return std::size_t The index of the matching key, or count if none matched
+*/
+std::size_t Scanner::Lookup(const ScanKey *keys, const std::size_t &count)
+{
+  const char *word;
+  std::size_t len = Word(&word);
+
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    if (keys[i].len == len && std::memcmp(keys[i].name, word, len) == 0)
+    {
+      return i;
+    }
+  }
+  return count;
+}
+#pragma endregion "Methods"
+
+#pragma region "Static Methods"
+/**
+* @brief Gets the SourceCache being read through by the current thread
+*
+* @return SourceCache* The active SourceCache, or nullptr if every file is read
+*/
+SourceCache *activeSourceCache()
+{
+  return currentSourceCache;
+}
+#pragma endregion "Static Methods"
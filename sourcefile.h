@@ -0,0 +1,110 @@
+/**
+*  @file      sourcefile.h
+*  @brief     The interface for the SourceFile, SourceCache and Scanner classes.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_SOURCEFILE_H_
+#define CGOGGLES_SOURCEFILE_H_
+
+#include "pch.h"
+
+/**
+* @brief Represents a data source which is held open and re-read in place
+*/
+class SourceFile
+{
+private:
+  int fd;
+  std::string path;
+  std::vector<char> buffer;
+  std::size_t size;
+
+public:
+  SourceFile();
+  SourceFile(const std::string &p, const std::size_t &capacity = 4096);
+  SourceFile(const SourceFile &o) = delete;
+  SourceFile(SourceFile &&o);
+  void operator=(const SourceFile &o) = delete;
+  void operator=(SourceFile &&o);
+  ~SourceFile();
+  bool Good();
+  bool Read();
+  const char *Data();
+  std::size_t Size();
+};
+
+/**
+* @brief Represents the files read during a single tick of watch, so that the categories due on it read each file once
+*/
+class SourceCache
+{
+private:
+  std::unordered_map<std::string, std::pair<std::uint64_t, std::string>> files;
+  std::uint64_t tick;
+
+public:
+  SourceCache();
+  SourceCache(const SourceCache &o) = delete;
+  void operator=(const SourceCache &o) = delete;
+  void Advance();
+  const std::string *Find(const std::string &p);
+  void Store(const std::string &p, const char *data, const std::size_t &size);
+};
+
+/**
+* @brief Makes a SourceCache active for the current thread for as long as it is in scope, starting a new tick
+*/
+class SourceCacheScope
+{
+private:
+  SourceCache *previous;
+
+public:
+  SourceCacheScope(SourceCache *cache);
+  SourceCacheScope(const SourceCacheScope &o) = delete;
+  void operator=(const SourceCacheScope &o) = delete;
+  ~SourceCacheScope();
+};
+
+/**
+* @brief Represents a key to look for at the start of a line, and where its value goes
+*/
+class ScanKey
+{
+public:
+  ScanKey(const char *n, const std::size_t &s);
+  const char *name;
+  std::size_t len;
+  std::size_t slot;
+};
+
+/**
+* @brief Reads numbers and words from a buffer without allocating
+*/
+class Scanner
+{
+private:
+  const char *pos;
+  const char *end;
+
+public:
+  Scanner(const char *data, const std::size_t &size);
+  bool Done();
+  bool Match(const char *s);
+  void SkipSpaces();
+  void SkipLine();
+  std::uint64_t Number();
+  std::int64_t Signed();
+  std::size_t Word(const char **s);
+  std::size_t Until(const char &c, const char **s);
+  std::size_t Lookup(const ScanKey *keys, const std::size_t &count);
+};
+
+SourceCache *activeSourceCache();
+
+#endif // CGOGGLES_SOURCEFILE_H_
@@ -53,102 +53,68 @@ Storage::Storage()
 */
 Storage::Storage(std::string nm, std::string id, std::string tp, std::string fs, std::string mnt, std::uint64_t ttl, std::string psy, std::string uid, std::string lbl, std::string mdl, std::string srl, bool rmv, std::string prt)
 {
-  name = nm;
-  identifier = id;
-  type = tp;
-  filesystem = fs;
-  mount = mnt;
+  name = std::move(nm);
+  identifier = std::move(id);
+  type = std::move(tp);
+  filesystem = std::move(fs);
+  mount = std::move(mnt);
   total = ttl;
-  physical = psy;
-  uuid = uid;
-  label = lbl;
-  model = mdl;
-  serial = srl;
+  physical = std::move(psy);
+  uuid = std::move(uid);
+  label = std::move(lbl);
+  model = std::move(mdl);
+  serial = std::move(srl);
   removable = rmv;
-  protocol = prt;
+  protocol = std::move(prt);
 }
 
 /**
 * @brief Construct a new Storage object from another Storage object
 *
-* @param o The Storage object to copy from
+* @param o The Storage object to move from
 */
-Storage::Storage(const Storage &o)
+Storage::Storage(Storage &&o)
 {
-  name = o.name;
-  identifier = o.identifier;
-  type = o.type;
-  filesystem = o.filesystem;
-  mount = o.mount;
+  name = std::move(o.name);
+  identifier = std::move(o.identifier);
+  type = std::move(o.type);
+  filesystem = std::move(o.filesystem);
+  mount = std::move(o.mount);
   total = o.total;
-  physical = o.physical;
-  uuid = o.uuid;
-  label = o.label;
-  model = o.model;
-  serial = o.serial;
+  physical = std::move(o.physical);
+  uuid = std::move(o.uuid);
+  label = std::move(o.label);
+  model = std::move(o.model);
+  serial = std::move(o.serial);
   removable = o.removable;
-  protocol = o.protocol;
+  protocol = std::move(o.protocol);
 }
 #pragma endregion "Contructors"
 
 #pragma region "Operators"
 /**
-* @brief Reserves memory for a new Storage object
+* @brief Moves another Storage object into this one
 *
-* @param  size  The amount of memory to allocate
-* @return void* A pointer to the allocated memory
+* @param o The Storage object to move from
 */
-void *Storage::operator new(std::size_t size)
-{
-  void *o = ::new (Storage);
-  return o;
-}
-
-/**
-* @brief Sets equal two Storage objects
-*
-* @param o The Storage object to copy from
-*/
-void Storage::operator=(const Storage &o)
+void Storage::operator=(Storage &&o)
 {
   if (&o == this)
   {
     return;
   }
-  name = o.name;
-  identifier = o.identifier;
-  type = o.type;
-  filesystem = o.filesystem;
-  mount = o.mount;
+  name = std::move(o.name);
+  identifier = std::move(o.identifier);
+  type = std::move(o.type);
+  filesystem = std::move(o.filesystem);
+  mount = std::move(o.mount);
   total = o.total;
-  physical = o.physical;
-  uuid = o.uuid;
-  label = o.label;
-  model = o.model;
-  serial = o.serial;
+  physical = std::move(o.physical);
+  uuid = std::move(o.uuid);
+  label = std::move(o.label);
+  model = std::move(o.model);
+  serial = std::move(o.serial);
   removable = o.removable;
-  protocol = o.protocol;
-}
-
-/**
-* @brief Sets equal two Storage objects
-*
-* @param o The Storage object to copy from
-*/
-void Storage::operator=(Storage *o)
-{
-  name = o->name;
-  identifier = o->identifier;
-  type = o->type;
-  filesystem = o->filesystem;
-  mount = o->mount;
-  total = o->total;
-  physical = o->physical;
-  uuid = o->uuid;
-  label = o->label;
-  model = o->model;
-  serial = o->serial;
-  removable = o->removable;
-  protocol = o->protocol;
+  protocol = std::move(o.protocol);
 }
 #pragma endregion "Operators"
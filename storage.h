@@ -21,10 +21,10 @@ class Storage
 public:
   Storage();
   Storage(std::string nm, std::string id, std::string tp, std::string fs, std::string mnt, std::uint64_t ttl, std::string psy, std::string uid, std::string lbl, std::string mdl, std::string srl, bool rmv, std::string prt);
-  Storage(const Storage &o);
-  void *operator new(std::size_t size);
-  void operator=(const Storage &o);
-  void operator=(Storage *o);
+  Storage(const Storage &o) = delete;
+  Storage(Storage &&o);
+  void operator=(const Storage &o) = delete;
+  void operator=(Storage &&o);
   std::string name;
   std::string identifier;
   std::string type;
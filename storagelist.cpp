@@ -13,6 +13,8 @@
 #include "storage.h"
 #include "os.h"
 #include "utils.h"
+#include "fslist.h"
+#include "sysroot.h"
 
 #pragma region "Contructors"
 /**
@@ -49,11 +51,11 @@ StorageList::StorageList(std::uint8_t plt)
 /**
 * @brief Construct a new StorageList object from another StorageList object
 *
-* @param o The StorageList object to copy from
+* @param o The StorageList object to move from
 */
-StorageList::StorageList(const StorageList &o)
+StorageList::StorageList(StorageList &&o)
 {
-  drives = o.drives;
+  drives = std::move(o.drives);
 }
 #pragma endregion "Contructors"
 
@@ -65,7 +67,6 @@ void StorageList::GetMac()
 {
   std::vector<std::string> eachDrive;
   std::vector<std::string> allDrives;
-  Storage tempDrive;
   std::string key;
   std::string val;
   std::string tempName = "";
@@ -166,8 +167,7 @@ void StorageList::GetMac()
         tempModel = val;
       }
     }
-    tempDrive = (new Storage(tempName, tempIdentifier, tempType, tempFilesystem, tempMount, tempTotal, tempPhysical, tempUuid, tempLabel, tempModel, tempSerial, tempRemovable, tempProtocol));
-    drives.push_back(tempDrive);
+    drives.emplace_back(tempName, tempIdentifier, tempType, tempFilesystem, tempMount, tempTotal, tempPhysical, tempUuid, tempLabel, tempModel, tempSerial, tempRemovable, tempProtocol);
   }
 }
 
@@ -180,7 +180,6 @@ void StorageList::GetWin()
   std::vector<std::string> eachDrive;
   std::vector<std::map<std::string, std::string>> allDrives = runListMultiWmic("logicaldisk get Caption, DriveType, FileSystem, Name, Size, VolumeName, VolumeSerialNumber", &wmic);
   std::string driveTypes[7] = {"Unknown", "NoRoot", "Removable", "Local", "Network", "CD/DVD", "RAM"};
-  Storage tempDrive;
   std::string tempName = "";
   std::string tempIdentifier = "";
   std::string tempType = "Disk";
@@ -213,8 +212,7 @@ void StorageList::GetWin()
     tempSerial = allDrives[i]["VolumeSerialNumber"];
     tempRemovable = allDrives[i]["DriveType"] == "2";
 
-    tempDrive = (new Storage(tempName, tempIdentifier, tempType, tempFilesystem, tempMount, tempTotal, tempPhysical, tempUuid, tempLabel, tempModel, tempSerial, tempRemovable, tempProtocol));
-    drives.push_back(tempDrive);
+    drives.emplace_back(tempName, tempIdentifier, tempType, tempFilesystem, tempMount, tempTotal, tempPhysical, tempUuid, tempLabel, tempModel, tempSerial, tempRemovable, tempProtocol);
   }
 }
 
@@ -222,11 +220,155 @@ void StorageList::GetWin()
 * @brief Fills in the StorageList information for Linux systems
 */
 void StorageList::GetLux()
+{
+  if (activeSysroot() != nullptr)
+  {
+    GetSysfs();
+    return;
+  }
+  ParseLux(runCommand("lsblk -bPo NAME,MAJ:MIN,TYPE,SIZE,FSTYPE,MOUNTPOINT,UUID,ROTA,RO,RM,TRAN,SERIAL,LABEL,MODEL,OWNER"));
+}
+
+/**
+* @brief Fills in the StorageList information from sysfs and the udev database, like lsblk
+*/
+void StorageList::GetSysfs()
+{
+  std::vector<std::string> disks;
+  std::vector<std::string> entries;
+  std::vector<std::string> allMounts;
+  std::vector<std::string> eachMount;
+  std::map<std::string, std::string> mounts;
+  std::string temp;
+  std::string dir;
+  std::string link;
+  std::string tempType;
+  std::string tempPhysical;
+  std::string tempProtocol;
+  bool tempRemovable;
+
+  // The first mount point of each device number
+  if (readMountInfo(&temp))
+  {
+    splitStringVector(temp, "\n", &allMounts);
+    for (std::size_t i = 0; i < allMounts.size(); ++i)
+    {
+      splitStringVector(allMounts[i], " ", &eachMount);
+      if (eachMount.size() > 4 && mounts.find(eachMount[2]) == mounts.end())
+      {
+        mounts[eachMount[2]] = unescapeMount(eachMount[4]);
+      }
+    }
+  }
+
+  listDirectory("/sys/block", &disks);
+  for (std::size_t i = 0; i < disks.size(); ++i)
+  {
+    dir = "/sys/block/" + disks[i];
+    link = readLink(dir, &link) ? link : "";
+    // Like lsblk, skip RAM disks and loop devices without a backing file
+    if (startswith(disks[i], "ram") || (startswith(disks[i], "loop") && (!readFile(dir + "/size", &temp) || trim(temp) == "0")))
+    {
+      continue;
+    }
+
+    tempType = "disk";
+    if (startswith(disks[i], "sr"))
+    {
+      tempType = "rom";
+    }
+    else if (startswith(disks[i], "loop"))
+    {
+      tempType = "loop";
+    }
+    else if (startswith(disks[i], "md"))
+    {
+      tempType = readFile(dir + "/md/level", &temp) ? trim(temp) : "md";
+    }
+    else if (startswith(disks[i], "dm-"))
+    {
+      temp = readFile(dir + "/dm/uuid", &temp) ? temp : "";
+      tempType = startswith(temp, "LVM-") ? "lvm" : startswith(temp, "CRYPT-") ? "crypt" : "dm";
+    }
+
+    tempProtocol = startswith(disks[i], "nvme")
+                       ? "nvme"
+                       : link.find("/usb") != std::string::npos
+                             ? "usb"
+                             : link.find("/ata") != std::string::npos
+                                   ? "sata"
+                                   : "";
+    tempPhysical = tempType == "disk"
+                       ? (readFile(dir + "/queue/rotational", &temp) && trim(temp) == "0" ? "SSD" : "HDD")
+                       : (tempType == "rom" ? "CD/DVD" : "");
+    tempRemovable = readFile(dir + "/removable", &temp) && trim(temp) == "1";
+
+    AddSysfs(dir, disks[i], tempType, tempPhysical, tempRemovable, tempProtocol, &mounts);
+    listDirectory(dir, &entries);
+    for (std::size_t j = 0; j < entries.size(); ++j)
+    {
+      if (startswith(entries[j], disks[i]) && readFile(dir + "/" + entries[j] + "/partition", &temp))
+      {
+        AddSysfs(dir + "/" + entries[j], entries[j], "part", "", tempRemovable, tempProtocol, &mounts);
+      }
+    }
+  }
+}
+
+/**
+* @brief Adds a single block device from sysfs and the udev database
+*
+* @param dir       The sysfs directory of the device
+* @param name      The kernel name of the device
+* @param type      The type of the device
+* @param physical  The physical type of the device
+* @param removable Whether or not the device is removable
+* @param protocol  The transport protocol of the device
+* @param mounts    The first mount point of each device number
+*/
+void StorageList::AddSysfs(const std::string &dir, const std::string &name, const std::string &type, const std::string &physical, const bool &removable, const std::string &protocol, std::map<std::string, std::string> *mounts)
+{
+  std::vector<std::string> lines;
+  std::map<std::string, std::string> udev;
+  std::string temp;
+  std::string key;
+  std::string val;
+  std::string dev = readFile(dir + "/dev", &temp) ? trim(temp) : "";
+  std::uint64_t tempTotal = readFile(dir + "/size", &temp) && !trim(temp).empty() ? std::stoull(temp) * 512 : 0;
+  std::string tempModel = "";
+  std::string tempSerial = "";
+
+  if (!dev.empty() && readFile("/run/udev/data/b" + dev, &temp))
+  {
+    splitStringVector(temp, "\n", &lines);
+    for (std::size_t i = 0; i < lines.size(); ++i)
+    {
+      if (startswith(lines[i], "E:") && splitKeyValuePair(lines[i].substr(2), &key, &val, false, '='))
+      {
+        udev[key] = val;
+      }
+    }
+  }
+
+  if (type != "part")
+  {
+    tempModel = readFile(dir + "/device/model", &temp) ? trim(temp) : std::regex_replace(udev["ID_MODEL"], std::regex("_"), " ");
+    tempSerial = readFile(dir + "/device/serial", &temp) ? trim(temp) : udev["ID_SERIAL_SHORT"];
+  }
+
+  drives.emplace_back(name, dev, type, udev["ID_FS_TYPE"], mounts->count(dev) ? (*mounts)[dev] : "", tempTotal, physical, udev["ID_FS_UUID"], udev["ID_FS_LABEL"], tempModel, tempSerial, removable, protocol);
+}
+
+/**
+* @brief Fills in the storage list information from the output of lsblk
+*
+* @param text The pairs output of lsblk
+*/
+void StorageList::ParseLux(const std::string &text)
 {
   std::vector<std::string> eachDrive;
   std::vector<std::string> allDrives;
   std::map<std::string, std::string> dataMap;
-  Storage tempDrive;
   std::string line;
   std::string key;
   std::string val;
@@ -244,7 +386,7 @@ void StorageList::GetLux()
   bool tempRemovable = false;
   std::string tempProtocol = "";
 
-  splitStringVector(runCommand("lsblk -bPo NAME,TYPE,SIZE,FSTYPE,MOUNTPOINT,UUID,ROTA,RO,RM,TRAN,SERIAL,LABEL,MODEL,OWNER"), "\n", &allDrives);
+  splitStringVector(text, "\n", &allDrives);
   for (std::size_t i = 0; i < allDrives.size(); ++i)
   {
     dataMap.clear();                // Reset the data collection
@@ -261,6 +403,7 @@ void StorageList::GetLux()
     }
 
     tempName = tryGetValue<std::string, std::string>(dataMap, "NAME", &val) ? val : "";
+    tempIdentifier = tryGetValue<std::string, std::string>(dataMap, "MAJ:MIN", &val) || tryGetValue<std::string, std::string>(dataMap, "MAJ_MIN", &val) ? val : "";
     tempType = tryGetValue<std::string, std::string>(dataMap, "TYPE", &val) ? val : "Unknown";
     tempFilesystem = tryGetValue<std::string, std::string>(dataMap, "FSTYPE", &val) ? val : "Unknown";
     tempMount = tryGetValue<std::string, std::string>(dataMap, "MOUNTPOINT", &val) ? val : "";
@@ -287,46 +430,23 @@ void StorageList::GetLux()
       }
     }
 
-    tempDrive = (new Storage(tempName, tempIdentifier, tempType, tempFilesystem, tempMount, tempTotal, tempPhysical, tempUuid, tempLabel, tempModel, tempSerial, tempRemovable, tempProtocol));
-    drives.push_back(tempDrive);
+    drives.emplace_back(tempName, tempIdentifier, tempType, tempFilesystem, tempMount, tempTotal, tempPhysical, tempUuid, tempLabel, tempModel, tempSerial, tempRemovable, tempProtocol);
   }
 }
 #pragma endregion
 
 #pragma region "Operators"
 /**
-* @brief Reserves memory for a new Storage System object
-*
-* @param  size  The amount of memory to allocate
-* @return void* A pointer to the allocated memory
-*/
-void *StorageList::operator new(std::size_t size)
-{
-  void *o = ::new (StorageList);
-  return o;
-}
-
-/**
-* @brief Sets equal two Storage System objects
+* @brief Moves another StorageList object into this one
 *
-* @param o The Storage System object to copy from
+* @param o The StorageList object to move from
 */
-void StorageList::operator=(const StorageList &o)
+void StorageList::operator=(StorageList &&o)
 {
   if (&o == this)
   {
     return;
   }
-  drives = o.drives;
-}
-
-/**
-* @brief Sets equal two Storage System objects
-*
-* @param o The Storage System object to copy from
-*/
-void StorageList::operator=(StorageList *o)
-{
-  drives = o->drives;
+  drives = std::move(o.drives);
 }
 #pragma endregion "Operators"
@@ -23,14 +23,17 @@ private:
   void GetMac();
   void GetWin();
   void GetLux();
+  void GetSysfs();
+  void AddSysfs(const std::string &dir, const std::string &name, const std::string &type, const std::string &physical, const bool &removable, const std::string &protocol, std::map<std::string, std::string> *mounts);
 
 public:
   StorageList();
   StorageList(std::uint8_t plt);
-  StorageList(const StorageList &o);
-  void *operator new(std::size_t size);
-  void operator=(const StorageList &o);
-  void operator=(StorageList *o);
+  StorageList(const StorageList &o) = delete;
+  StorageList(StorageList &&o);
+  void operator=(const StorageList &o) = delete;
+  void operator=(StorageList &&o);
+  void ParseLux(const std::string &text);
   std::vector<Storage> drives;
 };
 
@@ -0,0 +1,352 @@
+/**
+*  @file      sysroot.cpp
+*  @brief     The implementation for the Sysroot class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "sysroot.h"
+#include "os.h"
+#include "timings.h"
+
+#if CGOGGLES_OS != OS_WIN
+#include <cerrno>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#if defined(SYS_openat2) && defined(__has_include)
+#if __has_include(<linux/openat2.h>)
+#include <linux/openat2.h>
+/**
+* @brief Whether or not openat2 can keep lookups from escaping the root
+*/
+#define CGOGGLES_OPENAT2 1
+#endif
+#endif
+#endif
+
+/**
+* @brief The Sysroot being read from by the current thread
+*/
+static thread_local Sysroot *currentSysroot = nullptr;
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new, closed Sysroot object
+*/
+Sysroot::Sysroot()
+{
+  fd = -1;
+  path = "";
+}
+
+/**
+* @brief Construct a new Sysroot object, opening the root directory
+*
+* @param dir The directory to use as the root
+*/
+Sysroot::Sysroot(const std::string &dir)
+{
+  path = dir;
+#if CGOGGLES_OS != OS_WIN
+  fd = open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+#else
+  fd = -1;
+#endif
+}
+
+/**
+* @brief Construct a new Sysroot object from another Sysroot object
+*
+* @param o The Sysroot object to move from
+*/
+Sysroot::Sysroot(Sysroot &&o)
+{
+  fd = o.fd;
+  path = std::move(o.path);
+  o.fd = -1;
+}
+
+/**
+* @brief Destroy the Sysroot object, closing the root directory
+*/
+Sysroot::~Sysroot()
+{
+#if CGOGGLES_OS != OS_WIN
+  if (fd >= 0)
+  {
+    close(fd);
+  }
+#endif
+}
+
+/**
+* @brief Construct a new SysrootScope object, making the Sysroot active
+*
+* @param root The Sysroot to read from, or nullptr to read from the real root
+*/
+SysrootScope::SysrootScope(Sysroot *root)
+{
+  previous = currentSysroot;
+  currentSysroot = root;
+}
+
+/**
+* @brief Destroy the SysrootScope object, restoring the previous Sysroot
+*/
+SysrootScope::~SysrootScope()
+{
+  currentSysroot = previous;
+}
+#pragma endregion "Constructors"
+
+#pragma region "Operators"
+/**
+* @brief Moves another Sysroot object into this one
+*
+* @param o The Sysroot object to move from
+*/
+void Sysroot::operator=(Sysroot &&o)
+{
+  if (&o == this)
+  {
+    return;
+  }
+#if CGOGGLES_OS != OS_WIN
+  if (fd >= 0)
+  {
+    close(fd);
+  }
+#endif
+  fd = o.fd;
+  path = std::move(o.path);
+  o.fd = -1;
+}
+#pragma endregion "Operators"
+
+#pragma region "Methods"
+/**
+* @brief Checks whether or not the root directory is open
+*
+* @return true  The root directory is open
+* @return false The root directory could NOT be opened
+*/
+bool Sysroot::Good()
+{
+  return fd >= 0;
+}
+
+/**
+* @brief Gets the path of the root directory
+*
+* @return std::string The path of the root directory
+*/
+std::string Sysroot::Path()
+{
+  return path;
+}
+
+/**
+* @brief Opens a path as if the root directory were /
+*
+* @param  p     The absolute path to open
+* @param  flags The flags to open it with
+* @return int   The file descriptor, or -1 on failure
+*/
+int Sysroot::Open(const std::string &p, const int &flags)
+{
+#if CGOGGLES_OS != OS_WIN
+  std::string::size_type beg = p.find_first_not_of('/');
+  std::string rel = beg == std::string::npos ? "." : p.substr(beg);
+  int ret;
+
+#ifdef CGOGGLES_OPENAT2
+  struct open_how how;
+  std::memset(&how, 0, sizeof(how));
+  how.flags = flags | O_CLOEXEC;
+  how.resolve = RESOLVE_IN_ROOT;
+  ret = int(syscall(SYS_openat2, fd, rel.c_str(), &how, sizeof(how)));
+  if (ret >= 0 || (errno != ENOSYS && errno != EPERM))
+  {
+    return ret;
+  }
+#endif
+  ret = openat(fd, rel.c_str(), flags | O_CLOEXEC);
+  return ret;
+#else
+  return -1;
+#endif
+}
+#pragma endregion "Methods"
+
+#pragma region "Static Methods"
+/**
+* @brief Gets the Sysroot being read from by the current thread
+*
+* @return Sysroot* The active Sysroot, or nullptr if reading from the real root
+*/
+Sysroot *activeSysroot()
+{
+  return currentSysroot;
+}
+
+/**
+* @brief Opens an absolute path through the active Sysroot
+*
+* @param  p         The absolute path to open
+* @param  directory Whether or not to open it as a directory
+* @return int       The file descriptor, or -1 on failure
+*/
+int openPath(const std::string &p, const bool &directory)
+{
+#if CGOGGLES_OS != OS_WIN
+  int flags = O_RDONLY | (directory ? O_DIRECTORY : 0);
+  if (currentSysroot != nullptr)
+  {
+    return currentSysroot->Open(p, flags);
+  }
+  return open(p.c_str(), flags | O_CLOEXEC);
+#else
+  return -1;
+#endif
+}
+
+/**
+* @brief Lists the names in a directory, excluding . and ..
+*
+* @param  p     The absolute path of the directory
+* @param  names The names in the directory, sorted
+* @return true  The directory was listed successfully
+* @return false The directory could NOT be opened
+*/
+bool listDirectory(const std::string &p, std::vector<std::string> *names)
+{
+  names->clear();
+#if CGOGGLES_OS != OS_WIN
+  SourceTiming timing(p);
+  int fd = openPath(p, true);
+  DIR *dir = fd < 0 ? nullptr : fdopendir(fd);
+  struct dirent *ent;
+
+  if (dir == nullptr)
+  {
+    if (fd >= 0)
+    {
+      close(fd);
+    }
+    return false;
+  }
+  while ((ent = readdir(dir)) != nullptr)
+  {
+    if (std::strcmp(ent->d_name, ".") && std::strcmp(ent->d_name, ".."))
+    {
+      names->push_back(ent->d_name);
+    }
+  }
+  closedir(dir);
+  std::sort(names->begin(), names->end());
+  return true;
+#else
+  return false;
+#endif
+}
+
+/**
+* @brief Reads the target of a symbolic link
+*
+* @param  p     The absolute path of the link
+* @param  o     The target of the link, if read
+* @return true  The link was read successfully
+* @return false The link could NOT be read
+*/
+bool readLink(const std::string &p, std::string *o)
+{
+#if CGOGGLES_OS != OS_WIN
+  char buffer[4096];
+  int fd = currentSysroot != nullptr ? currentSysroot->Open(p, O_PATH | O_NOFOLLOW) : open(p.c_str(), O_PATH | O_NOFOLLOW | O_CLOEXEC);
+  ssize_t len;
+
+  if (fd < 0)
+  {
+    return false;
+  }
+  len = readlinkat(fd, "", buffer, sizeof(buffer));
+  close(fd);
+  if (len < 0)
+  {
+    return false;
+  }
+  o->assign(buffer, len);
+  return true;
+#else
+  return false;
+#endif
+}
+
+/**
+* @brief Gets the status of a path, following links
+*
+* @param  p     The absolute path
+* @param  st    The status of the path, if found
+* @return true  The path was found
+* @return false The path could NOT be found
+*/
+bool statPath(const std::string &p, struct stat *st)
+{
+#if CGOGGLES_OS != OS_WIN
+  int fd = currentSysroot != nullptr ? currentSysroot->Open(p, O_PATH) : open(p.c_str(), O_PATH | O_CLOEXEC);
+  bool ret;
+
+  if (fd < 0)
+  {
+    return false;
+  }
+  ret = fstat(fd, st) == 0;
+  close(fd);
+  return ret;
+#else
+  return false;
+#endif
+}
+
+/**
+* @brief Gets the size and usage of the file system mounted at a path
+*
+* @param  p     The absolute path of the mount
+* @param  size  The total size in bytes
+* @param  used  The used size in bytes
+* @return true  The file system was found
+* @return false The file system could NOT be found
+*/
+bool statFileSystem(const std::string &p, std::uint64_t *size, std::uint64_t *used)
+{
+#if CGOGGLES_OS != OS_WIN
+  SourceTiming timing(p);
+  int fd = currentSysroot != nullptr ? currentSysroot->Open(p, O_PATH) : open(p.c_str(), O_PATH | O_CLOEXEC);
+  struct statvfs st;
+  bool ret;
+
+  if (fd < 0)
+  {
+    return false;
+  }
+  ret = fstatvfs(fd, &st) == 0;
+  close(fd);
+  if (ret)
+  {
+    (*size) = std::uint64_t(st.f_blocks) * st.f_frsize;
+    (*used) = std::uint64_t(st.f_blocks - st.f_bfree) * st.f_frsize;
+  }
+  return ret;
+#else
+  return false;
+#endif
+}
+#pragma endregion "Static Methods"
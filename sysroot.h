@@ -0,0 +1,62 @@
+/**
+*  @file      sysroot.h
+*  @brief     The interface for the Sysroot class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_SYSROOT_H_
+#define CGOGGLES_SYSROOT_H_
+
+#include "pch.h"
+
+struct stat;
+
+/**
+* @brief Represents a directory that every absolute data source is read relative to
+*/
+class Sysroot
+{
+private:
+  int fd;
+  std::string path;
+
+public:
+  Sysroot();
+  Sysroot(const std::string &dir);
+  Sysroot(const Sysroot &o) = delete;
+  Sysroot(Sysroot &&o);
+  void operator=(const Sysroot &o) = delete;
+  void operator=(Sysroot &&o);
+  ~Sysroot();
+  bool Good();
+  std::string Path();
+  int Open(const std::string &p, const int &flags);
+};
+
+/**
+* @brief Makes a Sysroot the active one for the current thread for as long as it is in scope
+*/
+class SysrootScope
+{
+private:
+  Sysroot *previous;
+
+public:
+  SysrootScope(Sysroot *root);
+  SysrootScope(const SysrootScope &o) = delete;
+  void operator=(const SysrootScope &o) = delete;
+  ~SysrootScope();
+};
+
+Sysroot *activeSysroot();
+int openPath(const std::string &p, const bool &directory = false);
+bool listDirectory(const std::string &p, std::vector<std::string> *names);
+bool readLink(const std::string &p, std::string *o);
+bool statPath(const std::string &p, struct stat *st);
+bool statFileSystem(const std::string &p, std::uint64_t *size, std::uint64_t *used);
+
+#endif // CGOGGLES_SYSROOT_H_
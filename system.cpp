@@ -50,15 +50,15 @@ System::System(std::uint8_t plt)
 /**
 * @brief Construct a new System object from another System object
 *
-* @param o The System object to copy from
+* @param o The System object to move from
 */
-System::System(const System &o)
+System::System(System &&o)
 {
-  manufacturer = o.manufacturer;
-  model = o.model;
-  version = o.version;
-  serial = o.serial;
-  uuid = o.uuid;
+  manufacturer = std::move(o.manufacturer);
+  model = std::move(o.model);
+  version = std::move(o.version);
+  serial = std::move(o.serial);
+  uuid = std::move(o.uuid);
 }
 #pragma endregion "Constructors"
 
@@ -128,59 +128,32 @@ void System::GetWin()
 */
 void System::GetLux()
 {
-  std::ifstream tempFile;
-  std::string *temp = new std::string;
+  std::string temp;
 
-  manufacturer = readFile("/sys/devices/virtual/dmi/id/sys_vendor", temp) ? trim((*temp)) : "";
-  model = readFile("/sys/devices/virtual/dmi/id/product_name", temp) ? trim((*temp)) : "";
-  version = readFile("/sys/devices/virtual/dmi/id/product_version", temp) ? trim((*temp)) : "";
-  serial = readFile("/sys/devices/virtual/dmi/id/product_serial", temp) ? trim((*temp)) : "";
-  uuid = readFile("/sys/devices/virtual/dmi/id/product_uuid", temp) ? trim((*temp)) : "";
+  manufacturer = readFile("/sys/devices/virtual/dmi/id/sys_vendor", &temp) ? trim(temp) : "";
+  model = readFile("/sys/devices/virtual/dmi/id/product_name", &temp) ? trim(temp) : "";
+  version = readFile("/sys/devices/virtual/dmi/id/product_version", &temp) ? trim(temp) : "";
+  serial = readFile("/sys/devices/virtual/dmi/id/product_serial", &temp) ? trim(temp) : "";
+  uuid = readFile("/sys/devices/virtual/dmi/id/product_uuid", &temp) ? trim(temp) : "";
 }
 #pragma endregion
 
 #pragma region "Operators"
 /**
-* @brief Reserves memory for a new System object
-*
-* @param  size  The amount of memory to allocate
-* @return void* A pointer to the allocated memory
-*/
-void *System::operator new(std::size_t size)
-{
-  void *o = ::new (System);
-  return o;
-}
-
-/**
-* @brief Sets equal two System objects
+* @brief Moves another System object into this one
 *
-* @param o The System object to copy from
+* @param o The System object to move from
 */
-void System::operator=(const System &o)
+void System::operator=(System &&o)
 {
   if (&o == this)
   {
     return;
   }
-  manufacturer = o.manufacturer;
-  model = o.model;
-  version = o.version;
-  serial = o.serial;
-  uuid = o.uuid;
-}
-
-/**
-* @brief Sets equal two System objects
-*
-* @param o The System object to copy from
-*/
-void System::operator=(System *o)
-{
-  manufacturer = o->manufacturer;
-  model = o->model;
-  version = o->version;
-  serial = o->serial;
-  uuid = o->uuid;
+  manufacturer = std::move(o.manufacturer);
+  model = std::move(o.model);
+  version = std::move(o.version);
+  serial = std::move(o.serial);
+  uuid = std::move(o.uuid);
 }
 #pragma endregion "Operators"
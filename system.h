@@ -26,10 +26,10 @@ private:
 public:
   System();
   System(std::uint8_t plt);
-  System(const System &o);
-  void *operator new(std::size_t size);
-  void operator=(const System &o);
-  void operator=(System *o);
+  System(const System &o) = delete;
+  System(System &&o);
+  void operator=(const System &o) = delete;
+  void operator=(System &&o);
   std::string manufacturer;
   std::string model;
   std::string version;
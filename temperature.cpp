@@ -42,18 +42,6 @@ Temperature::Temperature(const Temperature &o)
 #pragma endregion
 
 #pragma region "Operators"
-/**
-* @brief Reserves memory for a new Temperature object
-*
-* @param  size  The amount of memory to allocate
-* @return void* A pointer to the allocated memory
-*/
-void *Temperature::operator new(std::size_t size)
-{
-  void *o = ::new (Temperature);
-  return o;
-}
-
 /**
 * @brief Sets equal two Temperature objects
 *
@@ -68,16 +56,6 @@ void Temperature::operator=(const Temperature &o)
   kelvin = o.kelvin;
 }
 
-/**
-* @brief Sets equal two Temperature objects
-*
-* @param o The Temperature object to copy from
-*/
-void Temperature::operator=(Temperature *o)
-{
-  kelvin = o->kelvin;
-}
-
 /**
 * @brief Compares the equality two Temperature objects
 *
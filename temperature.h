@@ -22,9 +22,7 @@ public:
   Temperature();
   Temperature(const float &c);
   Temperature(const Temperature &o);
-  void *operator new(std::size_t size);
   void operator=(const Temperature &o);
-  void operator=(Temperature *o);
   bool operator==(Temperature &t);
   bool operator!=(Temperature &t);
   bool operator<(Temperature &t);
@@ -0,0 +1,190 @@
+/**
+*  @file      timerwheel.cpp
+*  @brief     The implementation for the TimerWheel class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "timerwheel.h"
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new, empty TimerWheel object at tick zero
+*/
+TimerWheel::TimerWheel()
+{
+  now = 0;
+  seed = static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()) | 1;
+  timers = std::vector<WheelTimer>();
+  moving = std::vector<std::size_t>();
+}
+#pragma endregion "Constructors"
+
+#pragma region "Constructors' Assistants"
+/**
+* @brief Picks a pseudo-random offset for a firing, so that the timers do not beat against other periodic work
+*
+* The offset only depends on the nominal deadline and the range, so timers of
+* the same period still fire on the same tick and share their reads.
+*
+* @param  nominal       The deadline the firing would have without jitter
+* @param  range         The largest offset, in ticks
+* @return std::uint32_t The offset, from zero up to range
+*/
+std::uint32_t TimerWheel::Jitter(const std::uint64_t &nominal, const std::uint32_t &range)
+{
+  std::uint64_t x = (nominal ^ seed) * 0x9E3779B97F4A7C15ull;
+  if (range == 0)
+  {
+    return 0;
+  }
+  x ^= x >> 29;
+  return static_cast<std::uint32_t>(x % (range + 1ull));
+}
+
+/**
+* @brief Places a timer in the lowest level whose span still holds its deadline
+*
+* @param id The timer to place
+*/
+void TimerWheel::Insert(const std::size_t &id)
+{
+  std::uint64_t deadline = std::max(timers[id].deadline, now);
+  std::size_t level = 0;
+  while (level + 1 < wheelLevels && (deadline >> (wheelBits * (level + 1))) != (now >> (wheelBits * (level + 1))))
+  {
+    ++level;
+  }
+  timers[id].deadline = deadline;
+  slots[level * wheelSlots + ((deadline >> (wheelBits * level)) & (wheelSlots - 1))].push_back(id);
+}
+
+/**
+* @brief Moves the timers out of the current slot of a level, down into the levels below
+*
+* @param level The level to cascade
+*/
+void TimerWheel::Cascade(const std::size_t &level)
+{
+  std::vector<std::size_t> &slot = slots[level * wheelSlots + ((now >> (wheelBits * level)) & (wheelSlots - 1))];
+  moving.swap(slot);
+  for (std::size_t i = 0; i < moving.size(); ++i)
+  {
+    Insert(moving[i]);
+  }
+  moving.clear();
+}
+#pragma endregion "Constructors' Assistants"
+
+#pragma region "Methods"
+/**
+* @brief Adds a repeating timer, first firing one period from now
+*
+* @param  period      The ticks between each firing
+* @param  jitter      The most ticks each firing may be delayed by, without drifting the period
+* @return std::size_t The ID of the timer, handed back by Advance when it fires
+*/
+std::size_t TimerWheel::Add(const std::uint32_t &period, const std::uint32_t &jitter)
+{
+  WheelTimer timer;
+  timer.period = std::max<std::uint32_t>(1, std::min(period, wheelSpan / 2));
+  timer.jitter = std::min(jitter, timer.period / 2);
+  timer.nominal = now + timer.period;
+  timer.deadline = timer.nominal + Jitter(timer.nominal, timer.jitter);
+  timers.push_back(timer);
+  Insert(timers.size() - 1);
+  return timers.size() - 1;
+}
+
+/**
+* @brief Returns the current tick of the wheel
+*
+* @return std::uint64_t The current tick
+*/
+std::uint64_t TimerWheel::Now()
+{
+  return now;
+}
+
+/**
+* @brief Finds the tick at which the next timer fires
+*
+* Every timer on a level fires after those on the levels below, so the first
+* slot ahead of the current tick which holds any timer, on the lowest level
+* which has one, holds the earliest; only the top level, which may wrap, falls
+* back to checking every timer.
+*
+* @return std::uint64_t The earliest deadline, or the current tick if there are no timers
+*/
+std::uint64_t TimerWheel::Next()
+{
+  std::uint64_t next = UINT64_MAX;
+  for (std::size_t level = 0; level + 1 < wheelLevels; ++level)
+  {
+    for (std::size_t idx = ((now >> (wheelBits * level)) & (wheelSlots - 1)) + 1; idx < wheelSlots; ++idx)
+    {
+      const std::vector<std::size_t> &slot = slots[level * wheelSlots + idx];
+      for (std::size_t i = 0; i < slot.size(); ++i)
+      {
+        next = std::min(next, timers[slot[i]].deadline);
+      }
+      if (!slot.empty())
+      {
+        return next;
+      }
+    }
+  }
+  for (std::size_t i = 0; i < timers.size(); ++i)
+  {
+    next = std::min(next, timers[i].deadline);
+  }
+  return timers.empty() ? now : next;
+}
+
+/**
+* @brief Turns the wheel up to a tick, collecting the timers which fire and rescheduling them
+*
+* @param to  The tick to turn the wheel to
+* @param due The IDs of the timers which fired, in the order they fired
+*/
+void TimerWheel::Advance(const std::uint64_t &to, std::vector<std::size_t> *due)
+{
+  std::size_t first;
+  while (now < to)
+  {
+    ++now;
+    for (std::size_t level = wheelLevels - 1; level > 0; --level)
+    {
+      if ((now & ((1ull << (wheelBits * level)) - 1)) == 0)
+      {
+        Cascade(level);
+      }
+    }
+
+    std::vector<std::size_t> &slot = slots[now & (wheelSlots - 1)];
+    if (slot.empty())
+    {
+      continue;
+    }
+    first = due->size();
+    due->insert(due->end(), slot.begin(), slot.end());
+    slot.clear();
+    std::sort(due->begin() + first, due->end());
+    for (std::size_t i = first; i < due->size(); ++i)
+    {
+      WheelTimer &timer = timers[(*due)[i]];
+      timer.nominal += timer.period;
+      if (timer.nominal <= now)
+      {
+        timer.nominal += (now - timer.nominal) / timer.period * timer.period + timer.period;
+      }
+      timer.deadline = timer.nominal + Jitter(timer.nominal, timer.jitter);
+      Insert((*due)[i]);
+    }
+  }
+}
+#pragma endregion "Methods"
@@ -0,0 +1,71 @@
+/**
+*  @file      timerwheel.h
+*  @brief     The interface for the TimerWheel class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_TIMERWHEEL_H_
+#define CGOGGLES_TIMERWHEEL_H_
+
+#include "pch.h"
+
+/**
+* @brief The number of bits of the deadline each level of the wheel covers
+*/
+const std::size_t wheelBits = 6;
+
+/**
+* @brief The number of slots in each level of the wheel
+*/
+const std::size_t wheelSlots = 1 << wheelBits;
+
+/**
+* @brief The number of levels in the wheel, each covering wheelSlots times the span of the one below
+*/
+const std::size_t wheelLevels = 4;
+
+/**
+* @brief The longest period a timer can have, the span of the whole wheel (about 4.6 hours)
+*/
+const std::uint32_t wheelSpan = (1u << (wheelBits * wheelLevels)) - 1;
+
+/**
+* @brief Represents a single repeating timer on the wheel
+*/
+class WheelTimer
+{
+public:
+  std::uint64_t nominal;
+  std::uint64_t deadline;
+  std::uint32_t period;
+  std::uint32_t jitter;
+};
+
+/**
+* @brief Represents a hierarchical timer wheel of repeating timers, in ticks of one millisecond
+*/
+class TimerWheel
+{
+private:
+  std::uint64_t now;
+  std::uint64_t seed;
+  std::vector<WheelTimer> timers;
+  std::array<std::vector<std::size_t>, wheelLevels * wheelSlots> slots;
+  std::vector<std::size_t> moving;
+  std::uint32_t Jitter(const std::uint64_t &nominal, const std::uint32_t &range);
+  void Insert(const std::size_t &id);
+  void Cascade(const std::size_t &level);
+
+public:
+  TimerWheel();
+  std::size_t Add(const std::uint32_t &period, const std::uint32_t &jitter = 0);
+  std::uint64_t Now();
+  std::uint64_t Next();
+  void Advance(const std::uint64_t &to, std::vector<std::size_t> *due);
+};
+
+#endif // CGOGGLES_TIMERWHEEL_H_
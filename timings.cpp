@@ -0,0 +1,309 @@
+/**
+*  @file      timings.cpp
+*  @brief     The implementation for the Timings class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#include "pch.h"
+#include "timings.h"
+#include "os.h"
+#include "utils.h"
+
+#if CGOGGLES_OS != OS_WIN
+#include <sys/resource.h>
+#include <time.h>
+#endif
+
+thread_local std::uint64_t heapAllocations = 0;
+
+/**
+* @brief The Timings being recorded into by the current thread
+*/
+static thread_local Timings *currentTimings = nullptr;
+
+/**
+* @brief Gets the monotonic wall-clock time
+*
+* @return std::uint64_t The time in nanoseconds
+*/
+static std::uint64_t wallNow()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+* @brief Gets the CPU time used by the current thread and any finished subprocesses
+*
+* @return std::uint64_t The time in nanoseconds
+*/
+static std::uint64_t cpuNow()
+{
+#if CGOGGLES_OS == OS_WIN
+  return std::uint64_t(std::clock()) * (1000000000 / CLOCKS_PER_SEC);
+#else
+  struct timespec ts;
+  struct rusage ru;
+  std::uint64_t ret = 0;
+
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0)
+  {
+    ret += std::uint64_t(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+  }
+  if (getrusage(RUSAGE_CHILDREN, &ru) == 0)
+  {
+    ret += (std::uint64_t(ru.ru_utime.tv_sec) + ru.ru_stime.tv_sec) * 1000000000;
+    ret += (std::uint64_t(ru.ru_utime.tv_usec) + ru.ru_stime.tv_usec) * 1000;
+  }
+  return ret;
+#endif
+}
+
+#pragma region "Constructors"
+/**
+* @brief Construct a new, empty Timing object
+*/
+Timing::Timing()
+{
+  category = "";
+  source = "";
+  wall = 0;
+  cpu = 0;
+  bytes = 0;
+  opens = 0;
+  procs = 0;
+  allocs = 0;
+  runs = 1;
+}
+
+/**
+* @brief Construct a new, empty Timing object for a category and source
+*
+* @param cat The category being collected
+* @param src The data source, or empty for the whole category
+*/
+Timing::Timing(const std::string &cat, const std::string &src)
+{
+  category = cat;
+  source = src;
+  wall = 0;
+  cpu = 0;
+  bytes = 0;
+  opens = 0;
+  procs = 0;
+  allocs = 0;
+  runs = 1;
+}
+
+/**
+* @brief Construct a new, empty Timings object
+*/
+Timings::Timings()
+{
+  index = std::unordered_map<std::string, std::size_t>();
+  records = std::vector<Timing>();
+  category = "";
+  bytes = 0;
+  opens = 0;
+  procs = 0;
+}
+
+/**
+* @brief Construct a new TimingScope object and start timing a category
+*
+* @param t   The Timings to record into, or nullptr to record nothing
+* @param cat The category being collected
+*/
+TimingScope::TimingScope(Timings *t, const std::string &cat)
+{
+  timings = t;
+  previous = currentTimings;
+  if (timings == nullptr)
+  {
+    return;
+  }
+
+  previousCategory = timings->category;
+  timings->category = cat;
+  currentTimings = timings;
+
+  start = Timing(cat, "");
+  start.bytes = timings->bytes;
+  start.opens = timings->opens;
+  start.procs = timings->procs;
+  start.allocs = heapAllocations;
+  start.cpu = cpuNow();
+  start.wall = wallNow();
+}
+
+/**
+* @brief Destroy the TimingScope object, recording the category's cost
+*/
+TimingScope::~TimingScope()
+{
+  if (timings == nullptr)
+  {
+    return;
+  }
+
+  Timing rec(start.category, "");
+  rec.wall = wallNow() - start.wall;
+  rec.cpu = cpuNow() - start.cpu;
+  rec.allocs = heapAllocations - start.allocs;
+  rec.bytes = timings->bytes - start.bytes;
+  rec.opens = timings->opens - start.opens;
+  rec.procs = timings->procs - start.procs;
+  timings->Record(rec);
+
+  timings->category = previousCategory;
+  currentTimings = previous;
+}
+
+/**
+* @brief Construct a new SourceTiming object and start timing a data source
+*
+* @param src    The file or command being read
+* @param proc   Whether or not the source is a subprocess
+* @param opened Whether or not the source is opened, rather than re-read
+*/
+SourceTiming::SourceTiming(const std::string &src, const bool &proc, const bool &opened)
+{
+  timings = currentTimings;
+  if (timings == nullptr)
+  {
+    return;
+  }
+
+  start = Timing(timings->category, src);
+  start.bytes = timings->bytes;
+  start.opens = proc || !opened ? 0 : 1;
+  start.procs = proc ? 1 : 0;
+  start.allocs = heapAllocations;
+  start.cpu = cpuNow();
+  start.wall = wallNow();
+  timings->opens += start.opens;
+  timings->procs += start.procs;
+}
+
+/**
+* @brief Destroy the SourceTiming object, recording the source's cost
+*/
+SourceTiming::~SourceTiming()
+{
+  if (timings == nullptr)
+  {
+    return;
+  }
+
+  Timing rec(start.category, start.source);
+  rec.wall = wallNow() - start.wall;
+  rec.cpu = cpuNow() - start.cpu;
+  rec.allocs = heapAllocations - start.allocs;
+  rec.bytes = timings->bytes - start.bytes;
+  rec.opens = start.opens;
+  rec.procs = start.procs;
+  timings->Record(rec);
+}
+#pragma endregion "Constructors"
+
+#pragma region "Methods"
+/**
+* @brief Adds a cost to the record of its category and source, so that a watch keeps one row for each however long it runs
+*
+* @param rec The cost of a single run
+*/
+void Timings::Record(const Timing &rec)
+{
+  auto found = index.emplace(rec.category + '\n' + rec.source, records.size());
+  if (found.second)
+  {
+    records.push_back(rec);
+    return;
+  }
+  Timing &sum = records[found.first->second];
+  sum.wall += rec.wall;
+  sum.cpu += rec.cpu;
+  sum.bytes += rec.bytes;
+  sum.opens += rec.opens;
+  sum.procs += rec.procs;
+  sum.allocs += rec.allocs;
+  sum.runs += rec.runs;
+}
+
+/**
+* @brief Adds to the number of bytes read from the source
+*
+* @param n The number of bytes read
+*/
+void SourceTiming::Read(const std::uint64_t &n)
+{
+  if (timings != nullptr)
+  {
+    timings->bytes += n;
+  }
+}
+#pragma endregion "Methods"
+
+#pragma region "Static Methods"
+/**
+* @brief Gets the Timings being recorded into by the current thread
+*
+* @return Timings* The active Timings, or nullptr if none
+*/
+Timings *activeTimings()
+{
+  return currentTimings;
+}
+
+/**
+* @brief Outputs the recorded timings as a table or as JSON
+*
+* @param t      The timings to output
+* @param style  The style to output them in
+* @param stream The output stream
+*/
+void outputTimings(Timings *t, const TimingStyle &style, std::ostream &stream)
+{
+  if (style == TimingStyle::Json)
+  {
+    stream << "{\"timings\":[";
+    for (std::size_t i = 0; i < t->records.size(); ++i)
+    {
+      Timing &rec = t->records[i];
+      stream << (i ? "," : "")
+             << "{\"category\":\"" << jsonEscape(rec.category) << '"'
+             << ",\"source\":\"" << jsonEscape(rec.source) << '"'
+             << ",\"runs\":" << rec.runs
+             << ",\"wall_ns\":" << rec.wall
+             << ",\"cpu_ns\":" << rec.cpu
+             << ",\"bytes\":" << rec.bytes
+             << ",\"opens\":" << rec.opens
+             << ",\"procs\":" << rec.procs
+             << ",\"allocs\":" << rec.allocs << '}';
+    }
+    stream << "]}" << std::endl;
+    return;
+  }
+
+  stream << std::left << std::setw(12) << "category" << std::setw(42) << "source" << std::right
+         << std::setw(7) << "runs" << std::setw(11) << "wall ms" << std::setw(11) << "cpu ms" << std::setw(11) << "bytes"
+         << std::setw(7) << "opens" << std::setw(7) << "procs" << std::setw(9) << "allocs" << '\n';
+  for (std::size_t i = 0; i < t->records.size(); ++i)
+  {
+    Timing &rec = t->records[i];
+    std::string src = rec.source.empty() ? "*" : rec.source;
+    // Sources per CPU or per sensor share a long prefix, so the tail is what tells them apart
+    if (src.size() > 40)
+    {
+      src = "..." + src.substr(src.size() - 37);
+    }
+    stream << std::left << std::setw(12) << rec.category << std::setw(42) << src << std::right << std::fixed << std::setprecision(3)
+           << std::setw(7) << rec.runs << std::setw(11) << rec.wall / 1e6 << std::setw(11) << rec.cpu / 1e6 << std::setw(11) << rec.bytes
+           << std::setw(7) << rec.opens << std::setw(7) << rec.procs << std::setw(9) << rec.allocs << '\n';
+  }
+  stream << std::flush;
+}
+#pragma endregion "Static Methods"
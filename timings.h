@@ -0,0 +1,97 @@
+/**
+*  @file      timings.h
+*  @brief     The interface for the Timings class.
+*
+*  @author    Evan Elias Young
+*  @date      2026-10-19
+*  @date      2026-10-19
+*  @copyright Copyright 2019-2020 Evan Elias Young. All rights reserved.
+*/
+
+#ifndef CGOGGLES_TIMINGS_H_
+#define CGOGGLES_TIMINGS_H_
+
+#include "pch.h"
+#include "utils.h"
+
+/**
+* @brief The number of heap allocations made by the current thread
+*/
+extern thread_local std::uint64_t heapAllocations;
+
+/**
+* @brief Represents the cost of collecting a category, or one data source within it
+*/
+class Timing
+{
+public:
+  Timing();
+  Timing(const std::string &cat, const std::string &src);
+  std::string category;
+  std::string source;
+  std::uint64_t wall;
+  std::uint64_t cpu;
+  std::uint64_t bytes;
+  std::uint64_t opens;
+  std::uint64_t procs;
+  std::uint64_t allocs;
+  std::uint64_t runs;
+};
+
+/**
+* @brief Represents the costs recorded while collecting and outputting a snapshot
+*/
+class Timings
+{
+private:
+  std::unordered_map<std::string, std::size_t> index;
+
+public:
+  Timings();
+  void Record(const Timing &rec);
+  std::vector<Timing> records;
+  std::string category;
+  std::uint64_t bytes;
+  std::uint64_t opens;
+  std::uint64_t procs;
+};
+
+/**
+* @brief Records the cost of a category for as long as it is in scope
+*/
+class TimingScope
+{
+private:
+  Timings *timings;
+  Timings *previous;
+  std::string previousCategory;
+  Timing start;
+
+public:
+  TimingScope(Timings *t, const std::string &cat);
+  TimingScope(const TimingScope &o) = delete;
+  void operator=(const TimingScope &o) = delete;
+  ~TimingScope();
+};
+
+/**
+* @brief Records the cost of reading a single data source for as long as it is in scope
+*/
+class SourceTiming
+{
+private:
+  Timings *timings;
+  Timing start;
+
+public:
+  SourceTiming(const std::string &src, const bool &proc = false, const bool &opened = true);
+  SourceTiming(const SourceTiming &o) = delete;
+  void operator=(const SourceTiming &o) = delete;
+  ~SourceTiming();
+  void Read(const std::uint64_t &n);
+};
+
+Timings *activeTimings();
+void outputTimings(Timings *t, const TimingStyle &style, std::ostream &stream = std::cerr);
+
+#endif // CGOGGLES_TIMINGS_H_
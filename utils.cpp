@@ -11,16 +11,28 @@
 #include "pch.h"
 #include "argh.h"
 #include "utils.h"
+#include "context.h"
+#include "timings.h"
+#include "sysroot.h"
+#include "sourcefile.h"
+#include "os.h"
+#include "processorid.h"
+#include "pressurestats.h"
+
+#if CGOGGLES_OS != OS_WIN
+#include <unistd.h>
+#endif
 
 /**
 * @brief Splits a string into a vector of its parts
 *
 * @param s The string to slit
 * @param d The delimiter to split upon
-* @param v The vector to add to
+* @param v The vector to replace the contents of
 */
 void splitStringVector(const std::string &s, const std::string &d, std::vector<std::string> *v)
 {
+  (*v).clear();
   std::string::size_type beg = std::string::size_type(0);
   std::string::size_type end = std::string::size_type(s.find(d, 1));
 
@@ -183,6 +195,18 @@ bool endswith(const std::string &s, const std::string &r)
   return false;
 }
 
+/**
+* @brief Converts a string to upper case
+*
+* @param  s           The string to convert
+* @return std::string The string in upper case
+*/
+std::string toUpper(std::string s)
+{
+  std::transform(s.begin(), s.end(), s.begin(), ::toupper);
+  return s;
+}
+
 /**
 * @brief Splits a key/value pair base on a delimiter
 *
@@ -213,6 +237,17 @@ bool splitKeyValuePair(const std::string &base, std::string *k, std::string *v,
   return true;
 }
 
+/**
+* @brief Quotes a string so that the shell passes it through unchanged
+*
+* @param  s           The string to quote
+* @return std::string The quoted string
+*/
+std::string shellQuote(const std::string &s)
+{
+  return "'" + std::regex_replace(s, std::regex("'"), R"('\'')") + "'";
+}
+
 /**
 * @brief Attempts to read a file and get its contents
 *
@@ -223,6 +258,39 @@ bool splitKeyValuePair(const std::string &base, std::string *k, std::string *v,
 */
 bool readFile(const std::string &p, std::string *o)
 {
+  // Another category due on the same tick already read this file
+  SourceCache *cache = activeSourceCache();
+  const std::string *hit = cache != nullptr ? cache->Find(p) : nullptr;
+  if (hit != nullptr)
+  {
+    o->assign(*hit);
+    return true;
+  }
+
+  SourceTiming timing(p);
+#if CGOGGLES_OS != OS_WIN
+  char buffer[4096];
+  int fd = openPath(p);
+  ssize_t len;
+
+  if (fd < 0)
+  {
+    return false;
+  }
+
+  o->clear();
+  while ((len = read(fd, buffer, sizeof(buffer))) > 0)
+  {
+    o->append(buffer, len);
+  }
+  close(fd);
+  timing.Read(o->size());
+  if (cache != nullptr && len == 0)
+  {
+    cache->Store(p, o->data(), o->size());
+  }
+  return len == 0;
+#else
   std::ifstream t(p);
   std::stringstream buffer;
 
@@ -235,6 +303,7 @@ bool readFile(const std::string &p, std::string *o)
   {
     buffer << t.rdbuf();
     (*o) = buffer.str();
+    timing.Read(o->size());
   }
   catch (...)
   {
@@ -242,6 +311,7 @@ bool readFile(const std::string &p, std::string *o)
   }
 
   return true;
+#endif
 }
 
 /**
@@ -319,6 +389,156 @@ std::string siUnits(const float &num, const std::string &suff, const std::uint8_
   return ss.str();
 }
 
+/**
+* @brief Escapes a string for use in JSON
+*
+* @param  s           The string to escape
+* @return std::string The escaped string
+*/
+std::string jsonEscape(const std::string &s)
+{
+  std::stringstream buffer;
+  for (std::size_t i = 0; i < s.size(); ++i)
+  {
+    if (s[i] == '"' || s[i] == '\\')
+    {
+      buffer << '\\' << s[i];
+    }
+    else if (static_cast<unsigned char>(s[i]) < 0x20)
+    {
+      buffer << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(s[i]) << std::dec << std::setfill(' ');
+    }
+    else
+    {
+      buffer << s[i];
+    }
+  }
+  return buffer.str();
+}
+
+/**
+* @brief Parses a duration such as 250ms, 2s, 1m, 24h, 7d or 250 (milliseconds)
+*
+* @param  s     The duration to parse
+* @param  ms    The parsed duration in milliseconds
+* @return true  The duration was a positive number of milliseconds, seconds, minutes, hours or days
+* @return false The duration could not be parsed
+*/
+bool parseDuration(const std::string &s, std::uint32_t *ms)
+{
+  std::size_t end = 0;
+  double num;
+  try
+  {
+    num = std::stod(s, &end);
+  }
+  catch (...)
+  {
+    return false;
+  }
+  std::string unit = s.substr(end);
+  if (unit == "s")
+  {
+    num *= 1000;
+  }
+  else if (unit == "m")
+  {
+    num *= 60000;
+  }
+  else if (unit == "h")
+  {
+    num *= 3600000;
+  }
+  else if (unit == "d")
+  {
+    num *= 86400000;
+  }
+  else if (!unit.empty() && unit != "ms")
+  {
+    return false;
+  }
+  if (num < 1 || num > UINT32_MAX)
+  {
+    return false;
+  }
+  *ms = static_cast<std::uint32_t>(num);
+  return true;
+}
+
+/**
+* @brief Parses a kernel CPU list, like 0-3,8-11, into its CPUs
+*
+* @param  s     The CPU list
+* @param  cpus  The CPUs in the list, in order
+* @return true  The list was parsed
+* @return false The list was malformed
+*/
+bool parseCpuList(const std::string &s, std::vector<std::uint32_t> *cpus)
+{
+  std::vector<std::string> ranges;
+  std::string lo, hi;
+  std::uint32_t first, last;
+
+  cpus->clear();
+  splitStringVector(trim(s), ",", &ranges);
+  for (const std::string &range : ranges)
+  {
+    if (range.empty())
+    {
+      continue;
+    }
+    if (!splitKeyValuePair(range, &lo, &hi, false, '-'))
+    {
+      lo = hi = range;
+    }
+    try
+    {
+      first = static_cast<std::uint32_t>(std::stoul(lo));
+      last = static_cast<std::uint32_t>(std::stoul(hi));
+    }
+    catch (...)
+    {
+      return false;
+    }
+    if (last < first || last - first > 65535)
+    {
+      return false;
+    }
+    for (std::uint32_t cpu = first; cpu <= last; ++cpu)
+    {
+      cpus->push_back(cpu);
+    }
+  }
+  return true;
+}
+
+/**
+* @brief Formats sorted CPUs as a kernel CPU list, like 0-3,8-11
+*
+* @param  cpus        The CPUs, in ascending order
+* @return std::string The CPU list
+*/
+std::string formatCpuList(const std::vector<std::uint32_t> &cpus)
+{
+  std::stringstream ss;
+  std::size_t end;
+
+  for (std::size_t i = 0; i < cpus.size(); i = end + 1)
+  {
+    end = i;
+    while (end + 1 < cpus.size() && cpus[end + 1] == cpus[end] + 1)
+    {
+      ++end;
+    }
+    ss << (i > 0 ? "," : "") << cpus[i];
+    if (end > i)
+    {
+      ss << '-' << cpus[end];
+    }
+  }
+  return ss.str();
+}
+
 /**
 * @brief Outputs the version of CGoggles
 */
@@ -335,11 +555,22 @@ void outputVersion()
 */
 void outputHelp()
 {
-  std::cout << "usage: cgoggles [-v|--ver|--version] [-h|--help] [-l|--list|--value] [-r|--raw] <command> [<args>]" << '\n'
+  std::cout << "usage: cgoggles [-v|--ver|--version] [-h|--help] [-l|--list|--value|--json] [-r|--raw] [--timings[=json]] [--root DIR] [--window MS] [--top N] [--interval DUR] [--count N] [--every CAT=DUR,...] [--trigger RES.LINE=STALL/WINDOW,...] [--pid N,...] [--changes-only] [--history FILE] [--since DUR] [--features=FLAG,...] <command> [<args>]" << '\n'
             << "  get   Makes a query to the computer's internals" << '\n'
+            << "  watch Repeats a query every --interval, one line per sample" << '\n'
+            << "        with --history, also records the numeric values to FILE" << '\n'
+            << "        with --trigger, samples only when the kernel signals a pressure stall" << '\n'
+            << "  history Summarizes the values recorded in --history over the last --since" << '\n'
             << "  list  List the values that you can query to CGoggles" << '\n'
+            << "  --pid N,... follows the run-queue delay of those processes in sched.PID" << '\n'
+            << "  --features=FLAG,... exits 0 if the CPU has every flag, like avx2, or 1 naming those missing" << '\n'
             << '\n'
-            << "example: cgoggles get cpu.Brand, cpu.Cores, os.Version" << std::endl;
+            << "example: cgoggles get cpu.Brand, cpu.Cores, os.Version" << '\n'
+            << "example: cgoggles --interval 250ms --count 20 --json watch cpu.Usage.Busy, mem.Available" << '\n'
+            << "example: cgoggles --trigger memory.some=150ms/1s watch pressure, proc.TopRSS" << '\n'
+            << "example: cgoggles --pid 1,4242 watch sched.Wait, sched.PID" << '\n'
+            << "example: cgoggles --history cpu.hist --since 1h history cpu.Usage.Busy" << '\n'
+            << "example: cgoggles --features=avx2,avx512f" << std::endl;
 }
 
 /**
@@ -363,7 +594,26 @@ void outputList(const std::string &cat)
     "cpu.Architecture", "cpu.SocketType", "cpu.Brand",
     "cpu.Family", "cpu.Model", "cpu.Stepping",
     "cpu.Cores", "cpu.Threads", "cpu.Speed",
-    "cpu.MaxSpeed"};
+    "cpu.MaxSpeed", "cpu.Hypervisor", "cpu.Features",
+    "cpu.Topology", "cpu.Topology.Sockets", "cpu.Topology.Dies",
+    "cpu.Topology.Cores", "cpu.Topology.Threads", "cpu.Topology.L3Domains",
+    "cpu.Topology.Core", "cpu.Cache", "cpu.Cache.Level",
+    "cpu.Cache.Type", "cpu.Cache.Size", "cpu.Cache.Ways",
+    "cpu.Cache.LineSize", "cpu.Cache.Sets", "cpu.Cache.CPUs",
+    "cpu.Usage", "cpu.Usage.User", "cpu.Usage.Nice",
+    "cpu.Usage.System", "cpu.Usage.Idle", "cpu.Usage.IOWait",
+    "cpu.Usage.IRQ", "cpu.Usage.SoftIRQ", "cpu.Usage.Steal",
+    "cpu.Usage.Busy", "cpu.Usage.ContextSwitches", "cpu.Usage.Interrupts",
+    "cpu.CoreUsage", "cpu.CoreUsage.CPU", "cpu.CoreUsage.User",
+    "cpu.CoreUsage.Nice", "cpu.CoreUsage.System", "cpu.CoreUsage.Idle",
+    "cpu.CoreUsage.IOWait", "cpu.CoreUsage.IRQ", "cpu.CoreUsage.SoftIRQ",
+    "cpu.CoreUsage.Steal", "cpu.CoreUsage.Busy", "cpu.Power",
+    "cpu.Power.Driver", "cpu.Power.Boost", "cpu.Power.Governor",
+    "cpu.Power.DeepestIdle", "cpu.Power.CoreThrottles", "cpu.Power.PackageThrottles",
+    "cpu.CorePower", "cpu.CorePower.CPU", "cpu.CorePower.Speed",
+    "cpu.CorePower.MinSpeed", "cpu.CorePower.MaxSpeed", "cpu.CorePower.Governor",
+    "cpu.CorePower.EPP", "cpu.CorePower.Idle", "cpu.CorePower.CoreThrottles",
+    "cpu.CorePower.PackageThrottles"};
   std::vector<std::string> gpuList = {
       "gpu", "gpu.All", "gpu.Vendor",
       "gpu.Model", "gpu.Bus", "gpu.VRAM",
@@ -374,19 +624,84 @@ void outputList(const std::string &cat)
       "ram.FormFactor", "ram.Manufacturer", "ram.Part",
       "ram.Serial", "ram.VoltageConfigured", "ram.VoltageMin",
       "ram.VoltageMax"};
+  std::vector<std::string> memList = {
+      "mem", "mem.All", "mem.Total",
+      "mem.Free", "mem.Available", "mem.Buffers",
+      "mem.Cached", "mem.Dirty", "mem.Writeback",
+      "mem.Slab", "mem.SlabReclaimable", "mem.Anon",
+      "mem.Shmem", "mem.SwapTotal", "mem.SwapFree",
+      "mem.SwapCached", "mem.SwapUsed", "mem.PageFaults",
+      "mem.MajorFaults", "mem.SwapIns", "mem.SwapOuts",
+      "mem.ReclaimScans"};
+  std::vector<std::string> sensorsList = {
+      "sensors", "sensors.All", "sensors.Chip",
+      "sensors.Label", "sensors.Type", "sensors.Current",
+      "sensors.Min", "sensors.Max", "sensors.Average"};
   std::vector<std::string> storageList = {
       "storage", "storage.All", "storage.Name",
       "storage.Identifier", "storage.Type", "storage.FileSystem",
       "storage.Mount", "storage.Total", "storage.Physical",
       "storage.UUID", "storage.Label", "storage.Model",
-      "storage.Serial", "storage.Removable", "storage.Protocol"};
+      "storage.Serial", "storage.Removable", "storage.Protocol",
+      "storage.ReadIOPS", "storage.WriteIOPS", "storage.ReadBytes",
+      "storage.WriteBytes", "storage.ReadLatency", "storage.WriteLatency",
+      "storage.InFlight", "storage.Utilization"};
   std::vector<std::string> fsList = {
       "fs", "fs.All", "fs.FS",
       "fs.Type", "fs.Size", "fs.Used",
       "fs.Mount"};
+  std::vector<std::string> procList = {
+      "proc", "proc.All", "proc.Count",
+      "proc.Threads", "proc.TopCPU", "proc.TopRSS",
+      "proc.TopIO"};
+  std::vector<std::string> numaList = {
+      "numa", "numa.All", "numa.Count",
+      "numa.Imbalance", "numa.MissRatio", "numa.Node",
+      "numa.CPUs", "numa.CPUCount", "numa.MemTotal",
+      "numa.MemFree", "numa.Distance", "numa.Hit",
+      "numa.Miss", "numa.Foreign", "numa.InterleaveHit",
+      "numa.LocalNode", "numa.OtherNode", "numa.DIMMs"};
+  std::vector<std::string> kernelList = {
+      "kernel", "kernel.All", "kernel.CmdLine",
+      "kernel.Mitigations", "kernel.IsolCPUs", "kernel.NoHzFull",
+      "kernel.RcuNoCbs", "kernel.TransparentHugepage", "kernel.IRQAffinity",
+      "kernel.Vulnerable", "kernel.Mitigated", "kernel.Vulnerability",
+      "kernel.Vulnerability.State", "kernel.Vulnerability.Detail"};
+  std::vector<std::string> cgroupList = {
+      "cgroup", "cgroup.All", "cgroup.Version",
+      "cgroup.Path", "cgroup.CPUQuota", "cgroup.CPUPeriod",
+      "cgroup.CPUs", "cgroup.EffectiveCPUs", "cgroup.MemoryMax",
+      "cgroup.MemoryHigh", "cgroup.MemoryCurrent", "cgroup.Periods",
+      "cgroup.Throttled", "cgroup.ThrottledTime"};
+  std::vector<std::string> cgroupsList = {
+      "cgroups", "cgroups.All", "cgroups.Count",
+      "cgroups.TopCPU", "cgroups.TopMemory", "cgroups.TopIO",
+      "cgroups.TopPressure", "cgroups.Tree"};
+  std::vector<std::string> pressureList = {
+      "pressure", "pressure.All", "pressure.CPU",
+      "pressure.Memory", "pressure.IO"};
+  std::vector<std::string> schedList = {
+      "sched", "sched.All", "sched.Status",
+      "sched.Run", "sched.Wait", "sched.Timeslices",
+      "sched.WaitPerSlice", "sched.CPU", "sched.PID"};
+  std::vector<std::string> irqList = {
+      "irq", "irq.All", "irq.Interrupts",
+      "irq.System", "irq.Softirqs", "irq.Skew",
+      "irq.HotCPUs", "irq.CPU", "irq.Softirq",
+      "irq.TopIRQ", "irq.IRQ"};
+  std::vector<std::string> netList = {
+      "net", "net.All", "net.Name",
+      "net.Address", "net.State", "net.Speed",
+      "net.MTU", "net.RxBytes", "net.RxPackets",
+      "net.RxErrors", "net.RxDrops", "net.TxBytes",
+      "net.TxPackets", "net.TxErrors", "net.TxDrops",
+      "net.RxBytesRate", "net.RxPacketsRate", "net.RxErrorsRate",
+      "net.RxDropsRate", "net.TxBytesRate", "net.TxPacketsRate",
+      "net.TxErrorsRate", "net.TxDropsRate"};
   std::vector<std::vector<std::string>> liList = {
       osList, sysList, cpuList, gpuList,
-      ramList, storageList, fsList};
+      ramList, memList, sensorsList, storageList, netList, fsList,
+      procList, numaList, kernelList, cgroupList, cgroupsList, pressureList, schedList, irqList};
 
   if (cat == "" || cat == "all" || cat == "All")
   {
@@ -427,6 +742,20 @@ void outputList(const std::string &cat)
       std::cout << ramList[i] << '\n';
     }
   }
+  if (cat == "mem")
+  {
+    for (std::size_t i = 0; i < memList.size(); ++i)
+    {
+      std::cout << memList[i] << '\n';
+    }
+  }
+  if (cat == "sensors")
+  {
+    for (std::size_t i = 0; i < sensorsList.size(); ++i)
+    {
+      std::cout << sensorsList[i] << '\n';
+    }
+  }
   if (cat == "storage")
   {
     for (std::size_t i = 0; i < storageList.size(); ++i)
@@ -434,6 +763,13 @@ void outputList(const std::string &cat)
       std::cout << storageList[i] << '\n';
     }
   }
+  if (cat == "net")
+  {
+    for (std::size_t i = 0; i < netList.size(); ++i)
+    {
+      std::cout << netList[i] << '\n';
+    }
+  }
   if (cat == "fs")
   {
     for (std::size_t i = 0; i < fsList.size(); ++i)
@@ -441,6 +777,62 @@ void outputList(const std::string &cat)
       std::cout << fsList[i] << '\n';
     }
   }
+  if (cat == "proc")
+  {
+    for (std::size_t i = 0; i < procList.size(); ++i)
+    {
+      std::cout << procList[i] << '\n';
+    }
+  }
+  if (cat == "numa")
+  {
+    for (std::size_t i = 0; i < numaList.size(); ++i)
+    {
+      std::cout << numaList[i] << '\n';
+    }
+  }
+  if (cat == "kernel")
+  {
+    for (std::size_t i = 0; i < kernelList.size(); ++i)
+    {
+      std::cout << kernelList[i] << '\n';
+    }
+  }
+  if (cat == "cgroup")
+  {
+    for (std::size_t i = 0; i < cgroupList.size(); ++i)
+    {
+      std::cout << cgroupList[i] << '\n';
+    }
+  }
+  if (cat == "cgroups")
+  {
+    for (std::size_t i = 0; i < cgroupsList.size(); ++i)
+    {
+      std::cout << cgroupsList[i] << '\n';
+    }
+  }
+  if (cat == "pressure")
+  {
+    for (std::size_t i = 0; i < pressureList.size(); ++i)
+    {
+      std::cout << pressureList[i] << '\n';
+    }
+  }
+  if (cat == "sched")
+  {
+    for (std::size_t i = 0; i < schedList.size(); ++i)
+    {
+      std::cout << schedList[i] << '\n';
+    }
+  }
+  if (cat == "irq")
+  {
+    for (std::size_t i = 0; i < irqList.size(); ++i)
+    {
+      std::cout << irqList[i] << '\n';
+    }
+  }
 }
 
 /**
@@ -448,13 +840,18 @@ void outputList(const std::string &cat)
 *
 * @param argc    The count of arguments
 * @param argv    The value of arguments
+* @param ctx     The context to configure
 * @param request The request string
 * @return int    The exit code
 */
-int handleArgs(int argc, const char *argv[], std::string *request)
+int handleArgs(int argc, const char *argv[], Context *ctx, std::string *request)
 {
-  argh::parser cmdl(argv);
+  argh::parser cmdl;
+  std::vector<std::string> args;
   bool getArgs = false;
+  cmdl.add_params({"root", "window", "top", "interval", "count", "every", "trigger", "pid", "history", "since", "features"});
+  cmdl.parse(argc, argv);
+  args = cmdl.pos_args();
 
   if (argc <= 1)
   {
@@ -474,48 +871,209 @@ int handleArgs(int argc, const char *argv[], std::string *request)
     std::exit(EXIT_SUCCESS);
   }
 
+  if (cmdl({"features"}))
+  {
+    std::vector<std::string> flags;
+    ProcessorId id;
+    bool missing = false;
+    if (!id.supported)
+    {
+      std::cerr << "cgoggles: CPUID is not available on this processor" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    splitStringVector(cmdl({"features"}).str(), ",", &flags);
+    for (std::size_t i = 0; i < flags.size(); ++i)
+    {
+      std::transform(flags[i].begin(), flags[i].end(), flags[i].begin(), ::tolower);
+      trim(&flags[i]);
+      if (!flags[i].empty() && !id.Has(flags[i]))
+      {
+        std::cerr << (missing ? ", " : "cgoggles: missing ") << flags[i];
+        missing = true;
+      }
+    }
+    if (missing)
+    {
+      std::cerr << std::endl;
+    }
+    std::exit(missing ? EXIT_FAILURE : EXIT_SUCCESS);
+  }
+
   if (cmdl[{"l", "list"}])
   {
-    style = OutputStyle::List;
+    ctx->style = OutputStyle::List;
   }
 
   if (cmdl[{"value"}])
   {
-    style = OutputStyle::Value;
+    ctx->style = OutputStyle::Value;
+  }
+
+  if (cmdl[{"json"}])
+  {
+    ctx->style = OutputStyle::Json;
+  }
+
+  if (cmdl[{"changes-only"}])
+  {
+    if (ctx->style == OutputStyle::Value)
+    {
+      std::cerr << "cgoggles: --changes-only needs the keys, so it cannot be used with --value" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    ctx->changesOnly = true;
   }
 
   if (cmdl[{"r", "raw"}])
   {
-    pretty = false;
+    ctx->pretty = false;
   }
 
-  for (int i = 0; i < argc; ++i)
+  if (cmdl[{"timings"}])
   {
-    if (!std::strcmp(argv[i], "list"))
+    ctx->timings = TimingStyle::Text;
+  }
+
+  if (cmdl({"timings"}))
+  {
+    std::string timingStyle = cmdl({"timings"}).str();
+    ctx->timings = timingStyle == "json" ? TimingStyle::Json : TimingStyle::Text;
+  }
+
+  if (cmdl({"root"}))
+  {
+    ctx->root = cmdl({"root"}).str();
+    if (!Sysroot(ctx->root).Good())
     {
-      outputList(i + 1 < argc ? argv[++i] : "");
-      return EXIT_SUCCESS;
+      std::cerr << "cgoggles: cannot open root directory " << ctx->root << std::endl;
+      std::exit(EXIT_FAILURE);
     }
-    if (!getArgs || i == 0 || argv[i][0] == '-')
+  }
+
+  if (cmdl({"window"}))
+  {
+    if (!(cmdl({"window"}) >> ctx->window) || ctx->window == 0)
     {
-      continue;
+      std::cerr << "cgoggles: the window must be a positive number of milliseconds" << std::endl;
+      std::exit(EXIT_FAILURE);
     }
   }
 
-  for (int i = 0; i < argc; ++i)
+  if (cmdl({"top"}) && !(cmdl({"top"}) >> ctx->top))
+  {
+    std::cerr << "cgoggles: the top must be a number of processes" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  if (cmdl({"interval"}) && !parseDuration(cmdl({"interval"}).str(), &ctx->interval))
+  {
+    std::cerr << "cgoggles: the interval must be a positive duration, like 250ms or 2s" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  if (cmdl({"count"}) && !(cmdl({"count"}) >> ctx->count))
+  {
+    std::cerr << "cgoggles: the count must be a number of samples" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  if (cmdl({"history"}))
   {
-    if (!std::strcmp(argv[i], "get"))
+    ctx->history = cmdl({"history"}).str();
+  }
+
+  if (cmdl({"since"}) && !parseDuration(cmdl({"since"}).str(), &ctx->since))
+  {
+    std::cerr << "cgoggles: the since must be a positive duration, like 1h or 7d" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  if (cmdl({"every"}))
+  {
+    std::vector<std::string> every;
+    std::string cat;
+    std::string dur;
+    splitStringVector(cmdl({"every"}).str(), ",", &every);
+    for (std::size_t i = 0; i < every.size(); ++i)
+    {
+      if (!splitKeyValuePair(every[i], &cat, &dur, true, '=') || !parseDuration(dur, &ctx->periods[toUpper(cat)]))
+      {
+        std::cerr << "cgoggles: each period must be a category and a duration, like sensors=5s" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    }
+  }
+
+  if (cmdl({"trigger"}))
+  {
+    std::vector<std::string> specs;
+    std::string key;
+    std::string limit;
+    std::string stall;
+    std::string window;
+    std::pair<std::uint32_t, std::uint32_t> limits;
+    splitStringVector(cmdl({"trigger"}).str(), ",", &specs);
+    for (std::size_t i = 0; i < specs.size(); ++i)
+    {
+      // The kernel only takes windows from 500ms to 10s, and a stall shorter than its window
+      if (!splitKeyValuePair(specs[i], &key, &limit, true, '=') || !splitKeyValuePair(limit, &stall, &window, true, '/') ||
+          !parseDuration(stall, &limits.first) || !parseDuration(window, &limits.second) ||
+          limits.second < 500 || limits.second > 10000 || limits.first >= limits.second ||
+          std::none_of(pressureSources, pressureSources + pressureKinds, [&key](const char *src) { return key == std::string(src) + ".some" || key == std::string(src) + ".full"; }))
+      {
+        std::cerr << "cgoggles: each trigger must be a resource, a line and a stall within a window, like memory.some=150ms/1s" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      ctx->triggers[key] = limits;
+    }
+  }
+
+  if (cmdl({"pid"}))
+  {
+    std::vector<std::string> ids;
+    splitStringVector(cmdl({"pid"}).str(), ",", &ids);
+    for (std::size_t i = 0; i < ids.size(); ++i)
+    {
+      std::string id = trim(ids[i]);
+      if (id.empty() || id.size() > 9 || !std::all_of(id.begin(), id.end(), [](char c) { return std::isdigit(static_cast<unsigned char>(c)); }))
+      {
+        std::cerr << "cgoggles: each pid must be a process ID, like 1,4242" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      ctx->pids.push_back(std::stoul(id));
+    }
+  }
+
+  for (std::size_t i = 1; i < args.size(); ++i)
+  {
+    if (args[i] == "list")
+    {
+      outputList(i + 1 < args.size() ? args[i + 1] : "");
+      return EXIT_SUCCESS;
+    }
+  }
+
+  for (std::size_t i = 1; i < args.size(); ++i)
+  {
+    if (args[i] == "get" || args[i] == "watch" || args[i] == "history")
     {
       getArgs = true;
+      ctx->command = args[i] == "watch" ? Command::Watch : args[i] == "history" ? Command::History : Command::Get;
       continue;
     }
-    if (!getArgs || i == 0 || argv[i][0] == '-')
+    if (!getArgs)
     {
       continue;
     }
-    (*request) += argv[i];
+    (*request) += args[i];
   }
   std::transform(request->begin(), request->end(), request->begin(), ::toupper);
 
+  if (ctx->command == Command::History && ctx->history.empty())
+  {
+    std::cerr << "cgoggles: history needs the file to read, given by --history FILE" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
   return EXIT_SUCCESS;
 }
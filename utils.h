@@ -58,12 +58,31 @@ enum class OutputStyle : std::uint8_t
 {
   Default,
   List,
-  Value
+  Value,
+  Json
 };
 
-extern std::vector<std::string> requests;
-extern OutputStyle style;
-extern bool pretty;
+/**
+* @brief The command to run with the requests
+*/
+enum class Command : std::uint8_t
+{
+  Get,
+  Watch,
+  History
+};
+
+/**
+* @brief The method to use for outputting the collection timings
+*/
+enum class TimingStyle : std::uint8_t
+{
+  None,
+  Text,
+  Json
+};
+
+class Context;
 
 void splitStringVector(const std::string &s, const std::string &d, std::vector<std::string> *v);
 void removeDuplicates(std::vector<std::string> *v);
@@ -76,6 +95,7 @@ std::string ltrim(std::string s, const char *t = " \t\n\r\f\v");
 std::string trim(std::string s, const char *t = " \t\n\r\f\v");
 bool startswith(const std::string &s, const std::string &r);
 bool endswith(const std::string &s, const std::string &r);
+std::string toUpper(std::string s);
 bool splitKeyValuePair(const std::string &base, std::string *k, std::string *v, const bool &doTrim = true, const char &spl = ':');
 /**
 * @brief Tries to get a value from a map
@@ -99,13 +119,18 @@ bool tryGetValue(const std::map<T, R> &m, const T &k, R *v)
   }
   return false;
 }
+std::string shellQuote(const std::string &s);
 bool readFile(const std::string &p, std::string *o);
 std::string siUnits(const std::uint64_t &num, const std::string &suff = "", const std::uint8_t &plc = 2);
 std::string siUnits(const std::uint32_t &num, const std::string &suff = "", const std::uint8_t &plc = 2);
 std::string siUnits(const float &num, const std::string &suff = "", const std::uint8_t &plc = 2);
+std::string jsonEscape(const std::string &s);
+bool parseDuration(const std::string &s, std::uint32_t *ms);
+bool parseCpuList(const std::string &s, std::vector<std::uint32_t> *cpus);
+std::string formatCpuList(const std::vector<std::uint32_t> &cpus);
 void outputVersion();
 void outputList(const std::string &cat = "");
 void outputHelp();
-int handleArgs(int argc, const char *argv[], std::string *request);
+int handleArgs(int argc, const char *argv[], Context *ctx, std::string *request);
 
 #endif // CGOGGLES_UTILS_H_